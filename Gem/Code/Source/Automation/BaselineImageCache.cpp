@@ -0,0 +1,375 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Automation/BaselineImageCache.h>
+
+#include <Atom/Utils/PngFile.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/sort.h>
+#include <AzFramework/API/ApplicationAPI.h>
+
+namespace AtomSampleViewer
+{
+    namespace
+    {
+        static_assert(sizeof(BaselineImageCache::SidecarHeader) == 40, "SidecarHeader must match the documented file layout");
+
+        static constexpr size_t BytesPerPixel = 4;
+    }
+
+    BaselineImageCache::BaselineImageCache(size_t maxMemoryBytes, const AZStd::string& sidecarFolder, uint64_t maxSidecarBytes)
+        : m_maxMemoryBytes(maxMemoryBytes)
+        , m_maxSidecarBytes(maxSidecarBytes)
+        , m_sidecarFolder(sidecarFolder)
+    {
+    }
+
+    AZStd::shared_ptr<BaselineImageCache> BaselineImageCache::CreateFromSettings()
+    {
+        bool isSidecarEnabled = false;
+        AZ::u64 maxSidecarMegabytes = DefaultMaxSidecarBytes / (1024 * 1024);
+        if (auto settingsRegistry = AZ::SettingsRegistry::Get())
+        {
+            settingsRegistry->Get(isSidecarEnabled, SidecarSetting);
+            settingsRegistry->Get(maxSidecarMegabytes, MaxSidecarMegabytesSetting);
+        }
+
+        const AzFramework::CommandLine* commandLine = nullptr;
+        AzFramework::ApplicationRequests::Bus::BroadcastResult(commandLine, &AzFramework::ApplicationRequests::GetCommandLine);
+        if (commandLine && commandLine->HasSwitch(SidecarSwitch))
+        {
+            isSidecarEnabled = true;
+        }
+
+        return AZStd::make_shared<BaselineImageCache>(
+            DefaultMaxMemoryBytes, isSidecarEnabled ? DefaultSidecarFolder : "", maxSidecarMegabytes * 1024 * 1024);
+    }
+
+    BaselineImageCache::SidecarHeader BaselineImageCache::MakeSidecarHeader(const Image& image, uint64_t modificationTime, uint64_t fileSize)
+    {
+        SidecarHeader header = {};
+        memcpy(header.m_magic, SidecarMagic, sizeof(SidecarMagic));
+        header.m_version = SidecarVersion;
+        header.m_width = image.m_width;
+        header.m_height = image.m_height;
+        header.m_modificationTime = modificationTime;
+        header.m_fileSize = fileSize;
+        return header;
+    }
+
+    bool BaselineImageCache::IsSidecarHeaderValid(const SidecarHeader& header, uint64_t modificationTime, uint64_t fileSize)
+    {
+        return memcmp(header.m_magic, SidecarMagic, sizeof(SidecarMagic)) == 0 &&
+            header.m_version == SidecarVersion &&
+            header.m_modificationTime == modificationTime &&
+            header.m_fileSize == fileSize;
+    }
+
+    AZStd::vector<AZStd::string> BaselineImageCache::GetSidecarsToEvict(AZStd::vector<SidecarFileInfo> sidecars, uint64_t maxSidecarBytes)
+    {
+        uint64_t totalBytes = 0;
+        for (const SidecarFileInfo& sidecar : sidecars)
+        {
+            totalBytes += sidecar.m_fileSize;
+        }
+
+        AZStd::vector<AZStd::string> evicted;
+        if (totalBytes <= maxSidecarBytes)
+        {
+            return evicted;
+        }
+
+        // Files written in the same second are ordered by path, so the result doesn't depend on the folder enumeration order
+        AZStd::sort(sidecars.begin(), sidecars.end(), [](const SidecarFileInfo& a, const SidecarFileInfo& b)
+            {
+                return a.m_modificationTime != b.m_modificationTime ? a.m_modificationTime < b.m_modificationTime : a.m_filePath < b.m_filePath;
+            });
+
+        for (const SidecarFileInfo& sidecar : sidecars)
+        {
+            if (totalBytes <= maxSidecarBytes)
+            {
+                break;
+            }
+
+            totalBytes -= sidecar.m_fileSize;
+            evicted.push_back(sidecar.m_filePath);
+        }
+
+        return evicted;
+    }
+
+    BaselineImageCache::ImagePtr BaselineImageCache::Load(const AZStd::string& filePath)
+    {
+        AZ::IO::FileIOBase* io = AZ::IO::FileIOBase::GetInstance();
+        uint64_t fileSize = 0;
+        if (!io || !io->Exists(filePath.c_str()) || !io->Size(filePath.c_str(), fileSize))
+        {
+            return nullptr;
+        }
+
+        const uint64_t modificationTime = io->ModificationTime(filePath.c_str());
+
+        {
+            AZStd::scoped_lock lock(m_mutex);
+
+            auto lookup = m_entryLookup.find(filePath);
+            if (lookup != m_entryLookup.end())
+            {
+                EntryList::iterator entry = lookup->second;
+                if (entry->m_modificationTime == modificationTime && entry->m_fileSize == fileSize)
+                {
+                    m_entries.splice(m_entries.begin(), m_entries, entry);
+                    ++m_stats.m_memoryHits;
+                    return entry->m_image;
+                }
+
+                // The baseline changed on disk since it was cached
+                m_stats.m_cachedBytes -= entry->m_image->m_buffer.size();
+                m_entries.erase(entry);
+                m_entryLookup.erase(lookup);
+            }
+        }
+
+        // Decoding happens outside the lock so comparison jobs for different baselines don't serialize on it
+        const AZStd::string sidecarFilePath = GetSidecarFilePath(filePath);
+
+        ImagePtr image;
+        if (!sidecarFilePath.empty())
+        {
+            image = LoadSidecar(sidecarFilePath, modificationTime, fileSize);
+        }
+
+        const bool isSidecarHit = image != nullptr;
+
+        if (!image)
+        {
+            AZ::Utils::PngFile png = AZ::Utils::PngFile::Load(filePath.c_str());
+            if (!png.IsValid() || png.GetBufferFormat() != AZ::Utils::PngFile::Format::RGBA)
+            {
+                return nullptr;
+            }
+
+            AZStd::shared_ptr<Image> decoded = AZStd::make_shared<Image>();
+            decoded->m_width = png.GetWidth();
+            decoded->m_height = png.GetHeight();
+            decoded->m_buffer = png.TakeBuffer();
+            image = decoded;
+
+            if (!sidecarFilePath.empty())
+            {
+                SaveSidecar(sidecarFilePath, *image, modificationTime, fileSize);
+                EvictSidecars(sidecarFilePath);
+            }
+        }
+
+        AZStd::scoped_lock lock(m_mutex);
+
+        if (isSidecarHit)
+        {
+            ++m_stats.m_sidecarHits;
+        }
+        else
+        {
+            ++m_stats.m_misses;
+        }
+
+        Entry entry;
+        entry.m_filePath = filePath;
+        entry.m_modificationTime = modificationTime;
+        entry.m_fileSize = fileSize;
+        entry.m_image = image;
+        Insert(AZStd::move(entry));
+
+        return image;
+    }
+
+    void BaselineImageCache::Invalidate(const AZStd::string& filePath)
+    {
+        const AZStd::string sidecarFilePath = GetSidecarFilePath(filePath);
+
+        {
+            AZStd::scoped_lock lock(m_mutex);
+
+            auto lookup = m_entryLookup.find(filePath);
+            if (lookup != m_entryLookup.end())
+            {
+                m_stats.m_cachedBytes -= lookup->second->m_image->m_buffer.size();
+                m_entries.erase(lookup->second);
+                m_entryLookup.erase(lookup);
+            }
+        }
+
+        AZ::IO::FileIOBase* io = AZ::IO::FileIOBase::GetInstance();
+        if (io && !sidecarFilePath.empty() && io->Exists(sidecarFilePath.c_str()))
+        {
+            io->Remove(sidecarFilePath.c_str());
+        }
+    }
+
+    void BaselineImageCache::Clear()
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        m_entries.clear();
+        m_entryLookup.clear();
+        m_stats.m_cachedBytes = 0;
+    }
+
+    BaselineImageCache::Stats BaselineImageCache::GetStats() const
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        Stats stats = m_stats;
+        stats.m_cachedImageCount = m_entries.size();
+        return stats;
+    }
+
+    AZStd::string BaselineImageCache::GetSidecarFilePath(const AZStd::string& filePath)
+    {
+        AZStd::string sidecarFolder;
+
+        {
+            AZStd::scoped_lock lock(m_mutex);
+
+            if (!m_isSidecarFolderResolved && !m_sidecarFolder.empty())
+            {
+                AZ::IO::FileIOBase* io = AZ::IO::FileIOBase::GetInstance();
+                char resolvedPath[AZ::IO::MaxPathLength] = {0};
+                if (io && io->ResolvePath(m_sidecarFolder.c_str(), resolvedPath, AZ::IO::MaxPathLength))
+                {
+                    m_sidecarFolder = resolvedPath;
+                }
+                else
+                {
+                    AZ_TracePrintf("BaselineImageCache", "Could not resolve '%s', sidecar files are disabled.\n", m_sidecarFolder.c_str());
+                    m_sidecarFolder.clear();
+                }
+            }
+            m_isSidecarFolderResolved = true;
+
+            sidecarFolder = m_sidecarFolder;
+        }
+
+        if (sidecarFolder.empty())
+        {
+            return {};
+        }
+
+        const size_t pathHash = AZStd::hash<AZStd::string>{}(filePath);
+        return (AZ::IO::Path(sidecarFolder) / AZStd::string::format("%016llx.raw", static_cast<unsigned long long>(pathHash))).Native();
+    }
+
+    BaselineImageCache::ImagePtr BaselineImageCache::LoadSidecar(const AZStd::string& sidecarFilePath, uint64_t modificationTime, uint64_t fileSize) const
+    {
+        AZ::IO::FileIOBase* io = AZ::IO::FileIOBase::GetInstance();
+        if (!io->Exists(sidecarFilePath.c_str()))
+        {
+            return nullptr;
+        }
+
+        AZ::IO::FileIOStream fileStream(sidecarFilePath.c_str(), AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary);
+        if (!fileStream.IsOpen())
+        {
+            return nullptr;
+        }
+
+        SidecarHeader header;
+        if (fileStream.Read(sizeof(header), &header) != sizeof(header) || !IsSidecarHeaderValid(header, modificationTime, fileSize))
+        {
+            return nullptr;
+        }
+
+        const size_t pixelBytes = size_t(header.m_width) * header.m_height * BytesPerPixel;
+        if (fileStream.GetLength() != sizeof(header) + pixelBytes)
+        {
+            return nullptr;
+        }
+
+        AZStd::shared_ptr<Image> image = AZStd::make_shared<Image>();
+        image->m_width = header.m_width;
+        image->m_height = header.m_height;
+        image->m_buffer.resize_no_construct(pixelBytes);
+        if (fileStream.Read(pixelBytes, image->m_buffer.data()) != pixelBytes)
+        {
+            return nullptr;
+        }
+
+        return image;
+    }
+
+    void BaselineImageCache::SaveSidecar(const AZStd::string& sidecarFilePath, const Image& image, uint64_t modificationTime, uint64_t fileSize) const
+    {
+        const SidecarHeader header = MakeSidecarHeader(image, modificationTime, fileSize);
+
+        AZ::IO::FileIOStream fileStream(sidecarFilePath.c_str(),
+            AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary | AZ::IO::OpenMode::ModeCreatePath);
+
+        // The sidecar is only an optimization, so failures are traced rather than reported as errors against the running script
+        if (!fileStream.IsOpen() ||
+            fileStream.Write(sizeof(header), &header) != sizeof(header) ||
+            fileStream.Write(image.m_buffer.size(), image.m_buffer.data()) != image.m_buffer.size())
+        {
+            AZ_TracePrintf("BaselineImageCache", "Failed to write sidecar file '%s'.\n", sidecarFilePath.c_str());
+        }
+    }
+
+    void BaselineImageCache::EvictSidecars(const AZStd::string& sidecarFilePath)
+    {
+        AZStd::scoped_lock lock(m_sidecarEvictionMutex);
+
+        AZ::IO::FileIOBase* io = AZ::IO::FileIOBase::GetInstance();
+        const AZStd::string sidecarFolder = AZ::IO::PathView(sidecarFilePath).ParentPath().Native();
+
+        AZStd::vector<SidecarFileInfo> sidecars;
+        io->FindFiles(sidecarFolder.c_str(), "*.raw", [io, &sidecars](const char* filePath)
+            {
+                SidecarFileInfo& sidecar = sidecars.emplace_back();
+                sidecar.m_filePath = filePath;
+                sidecar.m_modificationTime = io->ModificationTime(filePath);
+                io->Size(filePath, sidecar.m_fileSize);
+                return true;
+            });
+
+        for (const AZStd::string& evictedFilePath : GetSidecarsToEvict(AZStd::move(sidecars), m_maxSidecarBytes))
+        {
+            io->Remove(evictedFilePath.c_str());
+        }
+    }
+
+    void BaselineImageCache::Insert(Entry&& entry)
+    {
+        auto lookup = m_entryLookup.find(entry.m_filePath);
+        if (lookup != m_entryLookup.end())
+        {
+            // Another job loaded the same baseline at the same time
+            m_stats.m_cachedBytes -= lookup->second->m_image->m_buffer.size();
+            m_entries.erase(lookup->second);
+            m_entryLookup.erase(lookup);
+        }
+
+        m_stats.m_cachedBytes += entry.m_image->m_buffer.size();
+        m_entries.push_front(AZStd::move(entry));
+        m_entryLookup[m_entries.front().m_filePath] = m_entries.begin();
+
+        EvictToBudget();
+    }
+
+    void BaselineImageCache::EvictToBudget()
+    {
+        // Always keep the most recent image, even if it alone is over budget
+        while (m_stats.m_cachedBytes > m_maxMemoryBytes && m_entries.size() > 1)
+        {
+            const Entry& oldest = m_entries.back();
+            m_stats.m_cachedBytes -= oldest.m_image->m_buffer.size();
+            m_entryLookup.erase(oldest.m_filePath);
+            m_entries.pop_back();
+        }
+    }
+} // namespace AtomSampleViewer
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/list.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/string/string.h>
+
+namespace AtomSampleViewer
+{
+    //! Keeps decoded baseline screenshots around so repeated comparisons don't decode the same PNG again.
+    //! Baselines rarely change between runs, so each entry is keyed by file path and validated against the file's
+    //! modification time and size before being reused.
+    //!
+    //! Decoded images live in a bounded, least-recently-used memory cache. Optionally each decoded image is also written
+    //! to a raw sidecar file, so a later process can skip the PNG decode too. Sidecar files are off unless enabled with
+    //! SidecarSetting or the SidecarSwitch command line switch, and the oldest ones are deleted once the folder holds more
+    //! than a size budget. Sidecar layout (all values little endian):
+    //!     char[8]     SidecarMagic
+    //!     uint32      SidecarVersion
+    //!     uint32      width
+    //!     uint32      height
+    //!     uint32      reserved, always 0
+    //!     uint64      modification time of the source PNG
+    //!     uint64      size of the source PNG
+    //!     uint8[width * height * 4]   RGBA8 pixels
+    //!
+    //! All functions are thread safe; the cache is used from the screenshot comparison jobs.
+    class BaselineImageCache
+    {
+    public:
+        static constexpr size_t DefaultMaxMemoryBytes = 256 * 1024 * 1024;
+        static constexpr uint64_t DefaultMaxSidecarBytes = 1024ull * 1024 * 1024;
+        static constexpr const char* DefaultSidecarFolder = "@user@/ScreenshotBaselineCache";
+        static constexpr const char* SidecarSetting = "/O3DE/AtomSampleViewer/BaselineImageCache/SidecarFiles";
+        static constexpr const char* MaxSidecarMegabytesSetting = "/O3DE/AtomSampleViewer/BaselineImageCache/MaxSidecarMegabytes";
+        static constexpr const char* SidecarSwitch = "baselinesidecarfiles";
+        static constexpr char SidecarMagic[8] = {'A', 'S', 'V', 'B', 'A', 'S', 'E', '\0'};
+        static constexpr uint32_t SidecarVersion = 1;
+
+        //! A decoded RGBA8 image
+        struct Image
+        {
+            uint32_t m_width = 0;
+            uint32_t m_height = 0;
+            AZStd::vector<uint8_t> m_buffer;
+        };
+
+        using ImagePtr = AZStd::shared_ptr<const Image>;
+
+        //! The start of a sidecar file, followed by the pixels
+        struct SidecarHeader
+        {
+            char m_magic[8];
+            uint32_t m_version;
+            uint32_t m_width;
+            uint32_t m_height;
+            uint32_t m_reserved;
+            uint64_t m_modificationTime;
+            uint64_t m_fileSize;
+        };
+
+        struct SidecarFileInfo
+        {
+            AZStd::string m_filePath;
+            uint64_t m_modificationTime = 0;
+            uint64_t m_fileSize = 0;
+        };
+
+        struct Stats
+        {
+            uint64_t m_memoryHits = 0;   //!< Requests served from the in-memory cache
+            uint64_t m_sidecarHits = 0;  //!< Requests served by reading a raw sidecar file
+            uint64_t m_misses = 0;       //!< Requests that had to decode the PNG
+            size_t m_cachedBytes = 0;    //!< Pixel bytes currently held in memory
+            size_t m_cachedImageCount = 0;
+        };
+
+        //! @param maxMemoryBytes the in-memory cache evicts least recently used images once it holds more pixel data than this
+        //! @param sidecarFolder folder for raw sidecar files, may start with an alias like "@user@". Empty disables sidecar files.
+        //! @param maxSidecarBytes the oldest sidecar files are deleted once the folder holds more than this
+        explicit BaselineImageCache(
+            size_t maxMemoryBytes = DefaultMaxMemoryBytes, const AZStd::string& sidecarFolder = {}, uint64_t maxSidecarBytes = DefaultMaxSidecarBytes);
+
+        //! Creates a cache that writes sidecar files to DefaultSidecarFolder if they are enabled in the settings registry or on the command line
+        static AZStd::shared_ptr<BaselineImageCache> CreateFromSettings();
+
+        static SidecarHeader MakeSidecarHeader(const Image& image, uint64_t modificationTime, uint64_t fileSize);
+
+        //! Returns whether a sidecar header is of the current version and was written for the given version of the source PNG
+        static bool IsSidecarHeaderValid(const SidecarHeader& header, uint64_t modificationTime, uint64_t fileSize);
+
+        //! Returns the sidecar files to delete, oldest first, so the remaining ones add up to at most maxSidecarBytes
+        static AZStd::vector<AZStd::string> GetSidecarsToEvict(AZStd::vector<SidecarFileInfo> sidecars, uint64_t maxSidecarBytes);
+
+        //! Returns the decoded image for a baseline PNG, or null if it doesn't exist, can't be loaded, or isn't RGBA8.
+        ImagePtr Load(const AZStd::string& filePath);
+
+        //! Forgets any cached data for a file, including its sidecar. Call this after replacing a baseline image, since copying
+        //! a file may preserve its modification time.
+        void Invalidate(const AZStd::string& filePath);
+
+        //! Drops everything held in memory. Sidecar files are kept.
+        void Clear();
+
+        Stats GetStats() const;
+
+    private:
+        struct Entry
+        {
+            AZStd::string m_filePath;
+            uint64_t m_modificationTime = 0;
+            uint64_t m_fileSize = 0;
+            ImagePtr m_image;
+        };
+
+        using EntryList = AZStd::list<Entry>;
+
+        AZStd::string GetSidecarFilePath(const AZStd::string& filePath);
+        ImagePtr LoadSidecar(const AZStd::string& sidecarFilePath, uint64_t modificationTime, uint64_t fileSize) const;
+        void SaveSidecar(const AZStd::string& sidecarFilePath, const Image& image, uint64_t modificationTime, uint64_t fileSize) const;
+        void EvictSidecars(const AZStd::string& sidecarFilePath);
+        void Insert(Entry&& entry);
+        void EvictToBudget();
+
+        mutable AZStd::mutex m_mutex;
+        AZStd::mutex m_sidecarEvictionMutex; //!< Only one job at a time scans the sidecar folder
+        size_t m_maxMemoryBytes;
+        uint64_t m_maxSidecarBytes;
+        AZStd::string m_sidecarFolder;
+        bool m_isSidecarFolderResolved = false;
+
+        EntryList m_entries; //!< Most recently used first
+        AZStd::unordered_map<AZStd::string, EntryList::iterator> m_entryLookup;
+        Stats m_stats;
+    };
+} // namespace AtomSampleViewer
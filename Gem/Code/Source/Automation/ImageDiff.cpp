@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Automation/ImageDiff.h>
+
+#include <Atom/Utils/ImageComparison.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+#include <emmintrin.h>
+#elif AZ_TRAIT_USE_PLATFORM_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+namespace AtomSampleViewer
+{
+    namespace ImageDiff
+    {
+        namespace
+        {
+            // The diff and default pixels as packed little-endian RGBA
+            static constexpr uint32_t OpaqueAlpha = 0xFF000000u;
+            static constexpr uint32_t DefaultPixel = OpaqueAlpha | (DefaultPixelValue << 16) | (DefaultPixelValue << 8) | DefaultPixelValue;
+        }
+
+        void GenerateImageDiffScalar(AZStd::span<const uint8_t> imageA, AZStd::span<const uint8_t> imageB, AZStd::span<uint8_t> output)
+        {
+            AZ_Assert(imageA.size() == imageB.size() && imageA.size() == output.size(), "Image sizes must match");
+
+            for (size_t i = 0; i < imageA.size(); i += BytesPerPixel)
+            {
+                const int16_t maxDiff = AZ::Utils::CalcMaxChannelDifference(imageA, imageB, i);
+
+                if (maxDiff >= MinHighlightedDifference)
+                {
+                    output[i] = aznumeric_cast<uint8_t>(maxDiff);
+                    output[i + 1] = 0;
+                    output[i + 2] = 0;
+                }
+                else
+                {
+                    output[i] = DefaultPixelValue;
+                    output[i + 1] = DefaultPixelValue;
+                    output[i + 2] = DefaultPixelValue;
+                }
+                output[i + 3] = 255;
+            }
+        }
+
+        void GenerateImageDiffVectorized(AZStd::span<const uint8_t> imageA, AZStd::span<const uint8_t> imageB, AZStd::span<uint8_t> output)
+        {
+            AZ_Assert(imageA.size() == imageB.size() && imageA.size() == output.size(), "Image sizes must match");
+
+            size_t i = 0;
+
+            // Both paths handle 4 pixels at a time. The max of the 4 channels of each pixel is folded into the low byte
+            // of its 32-bit lane with two shift+max steps, then each lane is selected between the diff and default pixel.
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+            const __m128i lowByteMask = _mm_set1_epi32(0xFF);
+            const __m128i threshold = _mm_set1_epi32(MinHighlightedDifference - 1);
+            const __m128i opaqueAlpha = _mm_set1_epi32(static_cast<int32_t>(OpaqueAlpha));
+            const __m128i defaultPixel = _mm_set1_epi32(static_cast<int32_t>(DefaultPixel));
+
+            for (; i + 16 <= imageA.size(); i += 16)
+            {
+                const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(imageA.data() + i));
+                const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(imageB.data() + i));
+                const __m128i absDiff = _mm_or_si128(_mm_subs_epu8(a, b), _mm_subs_epu8(b, a));
+
+                __m128i maxDiff = _mm_max_epu8(absDiff, _mm_srli_epi32(absDiff, 8));
+                maxDiff = _mm_max_epu8(maxDiff, _mm_srli_epi32(maxDiff, 16));
+                maxDiff = _mm_and_si128(maxDiff, lowByteMask);
+
+                const __m128i highlight = _mm_cmpgt_epi32(maxDiff, threshold);
+                const __m128i diffPixel = _mm_or_si128(maxDiff, opaqueAlpha);
+                const __m128i result = _mm_or_si128(_mm_and_si128(highlight, diffPixel), _mm_andnot_si128(highlight, defaultPixel));
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output.data() + i), result);
+            }
+#elif AZ_TRAIT_USE_PLATFORM_SIMD_NEON
+            const uint32x4_t lowByteMask = vdupq_n_u32(0xFF);
+            const uint32x4_t threshold = vdupq_n_u32(MinHighlightedDifference - 1);
+            const uint32x4_t opaqueAlpha = vdupq_n_u32(OpaqueAlpha);
+            const uint32x4_t defaultPixel = vdupq_n_u32(DefaultPixel);
+
+            for (; i + 16 <= imageA.size(); i += 16)
+            {
+                const uint8x16_t absDiff = vabdq_u8(vld1q_u8(imageA.data() + i), vld1q_u8(imageB.data() + i));
+
+                uint8x16_t maxDiffBytes = vmaxq_u8(absDiff, vreinterpretq_u8_u32(vshrq_n_u32(vreinterpretq_u32_u8(absDiff), 8)));
+                maxDiffBytes = vmaxq_u8(maxDiffBytes, vreinterpretq_u8_u32(vshrq_n_u32(vreinterpretq_u32_u8(maxDiffBytes), 16)));
+                const uint32x4_t maxDiff = vandq_u32(vreinterpretq_u32_u8(maxDiffBytes), lowByteMask);
+
+                const uint32x4_t highlight = vcgtq_u32(maxDiff, threshold);
+                const uint32x4_t result = vbslq_u32(highlight, vorrq_u32(maxDiff, opaqueAlpha), defaultPixel);
+
+                vst1q_u8(output.data() + i, vreinterpretq_u8_u32(result));
+            }
+#endif
+
+            // Remaining pixels, and the whole image on platforms without SIMD support
+            if (i < imageA.size())
+            {
+                GenerateImageDiffScalar(imageA.subspan(i), imageB.subspan(i), output.subspan(i));
+            }
+        }
+
+        AZStd::vector<RowBand> GetRowBands(size_t imageSize, size_t bytesPerRow, size_t workerCount)
+        {
+            AZ_Assert(bytesPerRow > 0 && bytesPerRow % BytesPerPixel == 0, "Row pitch must be a whole number of pixels");
+
+            const size_t rowCount = imageSize / bytesPerRow;
+            if (workerCount <= 1 || rowCount < MinRowsPerJob * 2)
+            {
+                return { RowBand{ 0, imageSize } };
+            }
+
+            const size_t rowsPerJob = AZStd::max(MinRowsPerJob, (rowCount + workerCount - 1) / workerCount);
+
+            AZStd::vector<RowBand> bands;
+            for (size_t firstRow = 0; firstRow < rowCount; firstRow += rowsPerJob)
+            {
+                RowBand& band = bands.emplace_back();
+                band.m_offset = firstRow * bytesPerRow;
+                band.m_size = (firstRow + rowsPerJob >= rowCount) ? imageSize - band.m_offset : rowsPerJob * bytesPerRow;
+            }
+            return bands;
+        }
+
+        void GenerateImageDiff(AZStd::span<const uint8_t> imageA, AZStd::span<const uint8_t> imageB, AZStd::span<uint8_t> output, size_t bytesPerRow)
+        {
+            AZ_Assert(imageA.size() == imageB.size() && imageA.size() == output.size(), "Image sizes must match");
+
+            AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+            const size_t workerCount = jobContext ? jobContext->GetJobManager().GetNumWorkerThreads() : 0;
+
+            const AZStd::vector<RowBand> bands = GetRowBands(imageA.size(), bytesPerRow, workerCount);
+            if (bands.size() == 1)
+            {
+                GenerateImageDiffVectorized(imageA, imageB, output);
+                return;
+            }
+
+            AZ::JobCompletion jobCompletion;
+            for (const RowBand& band : bands)
+            {
+                AZ::Job* job = AZ::CreateJobFunction([imageA, imageB, output, band]()
+                    {
+                        GenerateImageDiffVectorized(
+                            imageA.subspan(band.m_offset, band.m_size), imageB.subspan(band.m_offset, band.m_size), output.subspan(band.m_offset, band.m_size));
+                    }, true, jobContext);
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
+            jobCompletion.StartAndWaitForCompletion();
+        }
+    } // namespace ImageDiff
+} // namespace AtomSampleViewer
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AtomSampleViewer
+{
+    //! Kernels for building the visual diff image that ScriptReporter exports for failed screenshots.
+    //! Each output pixel is red, with intensity equal to the max channel difference, where the two images differ
+    //! noticeably, and mid-gray where they don't.
+    namespace ImageDiff
+    {
+        static constexpr size_t BytesPerPixel = 4;
+
+        //! Differences at or above this value are highlighted. This is the smallest 8-bit difference d where d / 255.0f > 0.01,
+        //! which is the filter ScriptReporter has always used.
+        static constexpr uint8_t MinHighlightedDifference = 3;
+
+        //! The channel value used for pixels that don't differ noticeably.
+        static constexpr uint8_t DefaultPixelValue = 122;
+
+        //! Below this many rows per job the job overhead outweighs the work
+        static constexpr size_t MinRowsPerJob = 64;
+
+        //! A range of bytes in the image buffers that one job diffs
+        struct RowBand
+        {
+            size_t m_offset = 0;
+            size_t m_size = 0;
+        };
+
+        //! Reference implementation, one pixel at a time using AZ::Utils::CalcMaxChannelDifference.
+        //! All three buffers must be RGBA8 and the same size.
+        void GenerateImageDiffScalar(AZStd::span<const uint8_t> imageA, AZStd::span<const uint8_t> imageB, AZStd::span<uint8_t> output);
+
+        //! Same result as GenerateImageDiffScalar(), using SSE or NEON where available.
+        void GenerateImageDiffVectorized(AZStd::span<const uint8_t> imageA, AZStd::span<const uint8_t> imageB, AZStd::span<uint8_t> output);
+
+        //! Returns the bands of rows that GenerateImageDiff() splits an image into for workerCount threads. A single band means
+        //! the diff runs on the calling thread. The last band also covers any trailing bytes that don't make a whole row.
+        AZStd::vector<RowBand> GetRowBands(size_t imageSize, size_t bytesPerRow, size_t workerCount);
+
+        //! Splits the image into bands of rows and runs GenerateImageDiffVectorized() on each band across the job system.
+        //! Falls back to a single call on the calling thread when there is no job context or the image is small.
+        //! @param bytesPerRow the row pitch of all three buffers
+        void GenerateImageDiff(AZStd::span<const uint8_t> imageA, AZStd::span<const uint8_t> imageB, AZStd::span<uint8_t> output, size_t bytesPerRow);
+    } // namespace ImageDiff
+} // namespace AtomSampleViewer
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Automation/ImageSignature.h>
+
+#include <Atom/Utils/ImageComparison.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Utils/TypeHash.h>
+
+namespace AtomSampleViewer
+{
+    namespace
+    {
+        struct SignatureFileHeader
+        {
+            char m_magic[8];
+            uint32_t m_version;
+            uint32_t m_width;
+            uint32_t m_height;
+            uint32_t m_tileSize;
+            uint64_t m_imageModificationTime;
+            uint64_t m_imageFileSize;
+            uint64_t m_contentHash;
+        };
+
+        static_assert(sizeof(SignatureFileHeader) == 48, "SignatureFileHeader must match the documented file layout");
+
+        bool GetImageFileStamp(const AZStd::string& imageFilePath, uint64_t& modificationTime, uint64_t& fileSize)
+        {
+            AZ::IO::FileIOBase* io = AZ::IO::FileIOBase::GetInstance();
+            if (!io || !io->Exists(imageFilePath.c_str()) || !io->Size(imageFilePath.c_str(), fileSize))
+            {
+                return false;
+            }
+
+            modificationTime = io->ModificationTime(imageFilePath.c_str());
+            return true;
+        }
+    }
+
+    ImageSignature ImageSignature::Compute(AZStd::span<const uint8_t> pixels, uint32_t width, uint32_t height)
+    {
+        AZ_Assert(pixels.size() == size_t(width) * height * BytesPerPixel, "Image size doesn't match its dimensions");
+
+        ImageSignature signature;
+        signature.m_width = width;
+        signature.m_height = height;
+
+        const uint32_t tileCountX = signature.GetTileCountX();
+        const uint32_t tileCountY = signature.GetTileCountY();
+        signature.m_tileHashes.resize(size_t(tileCountX) * tileCountY);
+
+        const size_t bytesPerRow = size_t(width) * BytesPerPixel;
+
+        for (uint32_t tileY = 0; tileY < tileCountY; ++tileY)
+        {
+            const uint32_t firstRow = tileY * TileSize;
+            const uint32_t lastRow = AZStd::min(firstRow + TileSize, height);
+
+            for (uint32_t tileX = 0; tileX < tileCountX; ++tileX)
+            {
+                const uint32_t firstColumn = tileX * TileSize;
+                const size_t segmentSize = size_t(AZStd::min(TileSize, width - firstColumn)) * BytesPerPixel;
+
+                // Tile data is fed in one row segment at a time, chaining the previous result as the seed
+                AZ::HashValue64 hash{ 0 };
+                for (uint32_t row = firstRow; row < lastRow; ++row)
+                {
+                    hash = AZ::TypeHash64(pixels.data() + row * bytesPerRow + firstColumn * BytesPerPixel, segmentSize, hash);
+                }
+
+                signature.m_tileHashes[size_t(tileY) * tileCountX + tileX] = static_cast<uint64_t>(hash);
+            }
+        }
+
+        AZ::HashValue64 contentHash = AZ::TypeHash64(width);
+        contentHash = AZ::TypeHash64(height, contentHash);
+        contentHash = AZ::TypeHash64(
+            reinterpret_cast<const uint8_t*>(signature.m_tileHashes.data()), signature.m_tileHashes.size() * sizeof(uint64_t), contentHash);
+        signature.m_contentHash = static_cast<uint64_t>(contentHash);
+
+        return signature;
+    }
+
+    bool ImageSignature::IsComparableTo(const ImageSignature& other) const
+    {
+        return m_width == other.m_width && m_height == other.m_height && m_tileHashes.size() == other.m_tileHashes.size();
+    }
+
+    float ImageSignature::CalcDiffRmsOfMismatchedTiles(
+        const ImageSignature& signatureA, AZStd::span<const uint8_t> pixelsA,
+        const ImageSignature& signatureB, AZStd::span<const uint8_t> pixelsB)
+    {
+        AZ_Assert(signatureA.IsComparableTo(signatureB), "Signatures must describe images of the same size");
+        AZ_Assert(pixelsA.size() == pixelsB.size(), "Images must be the same size");
+
+        const size_t pixelCount = size_t(signatureA.m_width) * signatureA.m_height;
+        if (pixelCount == 0)
+        {
+            return 0.0f;
+        }
+
+        const uint32_t tileCountX = signatureA.GetTileCountX();
+        const size_t bytesPerRow = size_t(signatureA.m_width) * BytesPerPixel;
+        double sumSquares = 0.0;
+
+        for (size_t tileIndex = 0; tileIndex < signatureA.m_tileHashes.size(); ++tileIndex)
+        {
+            if (signatureA.m_tileHashes[tileIndex] == signatureB.m_tileHashes[tileIndex])
+            {
+                continue;
+            }
+
+            const uint32_t firstColumn = aznumeric_cast<uint32_t>(tileIndex % tileCountX) * TileSize;
+            const uint32_t lastColumn = AZStd::min(firstColumn + TileSize, signatureA.m_width);
+            const uint32_t firstRow = aznumeric_cast<uint32_t>(tileIndex / tileCountX) * TileSize;
+            const uint32_t lastRow = AZStd::min(firstRow + TileSize, signatureA.m_height);
+
+            for (uint32_t row = firstRow; row < lastRow; ++row)
+            {
+                for (uint32_t column = firstColumn; column < lastColumn; ++column)
+                {
+                    const size_t index = row * bytesPerRow + column * BytesPerPixel;
+                    const float diff = AZ::Utils::CalcMaxChannelDifference(pixelsA, pixelsB, index) / 255.0f;
+                    sumSquares += diff * diff;
+                }
+            }
+        }
+
+        return aznumeric_cast<float>(sqrt(sumSquares / pixelCount));
+    }
+
+    AZStd::string ImageSignature::GetSignatureFilePath(const AZStd::string& imageFilePath)
+    {
+        return imageFilePath + SignatureFileExtension;
+    }
+
+    bool ImageSignature::Save(const AZStd::string& imageFilePath) const
+    {
+        SignatureFileHeader header = {};
+        if (!GetImageFileStamp(imageFilePath, header.m_imageModificationTime, header.m_imageFileSize))
+        {
+            return false;
+        }
+
+        memcpy(header.m_magic, FileMagic, sizeof(FileMagic));
+        header.m_version = FileVersion;
+        header.m_width = m_width;
+        header.m_height = m_height;
+        header.m_tileSize = TileSize;
+        header.m_contentHash = m_contentHash;
+
+        const size_t tileHashBytes = m_tileHashes.size() * sizeof(uint64_t);
+        const AZStd::string signatureFilePath = GetSignatureFilePath(imageFilePath);
+
+        AZ::IO::FileIOStream fileStream(signatureFilePath.c_str(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary);
+        return fileStream.IsOpen() &&
+            fileStream.Write(sizeof(header), &header) == sizeof(header) &&
+            fileStream.Write(tileHashBytes, m_tileHashes.data()) == tileHashBytes;
+    }
+
+    bool ImageSignature::Load(const AZStd::string& imageFilePath)
+    {
+        uint64_t modificationTime = 0;
+        uint64_t fileSize = 0;
+        if (!GetImageFileStamp(imageFilePath, modificationTime, fileSize))
+        {
+            return false;
+        }
+
+        const AZStd::string signatureFilePath = GetSignatureFilePath(imageFilePath);
+        if (!AZ::IO::FileIOBase::GetInstance()->Exists(signatureFilePath.c_str()))
+        {
+            return false;
+        }
+
+        AZ::IO::FileIOStream fileStream(signatureFilePath.c_str(), AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary);
+        if (!fileStream.IsOpen())
+        {
+            return false;
+        }
+
+        SignatureFileHeader header;
+        if (fileStream.Read(sizeof(header), &header) != sizeof(header) ||
+            memcmp(header.m_magic, FileMagic, sizeof(FileMagic)) != 0 ||
+            header.m_version != FileVersion ||
+            header.m_tileSize != TileSize ||
+            header.m_imageModificationTime != modificationTime ||
+            header.m_imageFileSize != fileSize)
+        {
+            return false;
+        }
+
+        m_width = header.m_width;
+        m_height = header.m_height;
+        m_contentHash = header.m_contentHash;
+        m_tileHashes.resize(size_t(GetTileCountX()) * GetTileCountY());
+
+        const size_t tileHashBytes = m_tileHashes.size() * sizeof(uint64_t);
+        return fileStream.GetLength() == sizeof(header) + tileHashBytes &&
+            fileStream.Read(tileHashBytes, m_tileHashes.data()) == tileHashBytes;
+    }
+} // namespace AtomSampleViewer
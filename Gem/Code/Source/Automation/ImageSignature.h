@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+namespace AtomSampleViewer
+{
+    //! A content hash of a decoded RGBA8 image plus a grid of per-tile hashes.
+    //! The local baseline check only needs to know whether a screenshot is bit-identical to its baseline, so comparing
+    //! signatures answers it without decoding the baseline. When the signatures differ, only tiles whose hashes differ
+    //! need to be diffed.
+    //!
+    //! Signatures are stored next to the image they describe, in SignatureFileExtension files (all values little endian):
+    //!     char[8]     FileMagic
+    //!     uint32      FileVersion
+    //!     uint32      width
+    //!     uint32      height
+    //!     uint32      TileSize
+    //!     uint64      modification time of the image file
+    //!     uint64      size of the image file
+    //!     uint64      content hash
+    //!     uint64[tile count]  tile hashes, row major
+    struct ImageSignature
+    {
+        static constexpr char FileMagic[8] = {'A', 'S', 'V', 'S', 'I', 'G', '\0', '\0'};
+        static constexpr uint32_t FileVersion = 2;
+        static constexpr const char* SignatureFileExtension = ".sig";
+        static constexpr uint32_t TileSize = 64;
+        static constexpr size_t BytesPerPixel = 4;
+
+        uint32_t m_width = 0;
+        uint32_t m_height = 0;
+        uint64_t m_contentHash = 0;
+        AZStd::vector<uint64_t> m_tileHashes;
+
+        uint32_t GetTileCountX() const { return (m_width + TileSize - 1) / TileSize; }
+        uint32_t GetTileCountY() const { return (m_height + TileSize - 1) / TileSize; }
+
+        //! Hashes an RGBA8 image. The content hash is derived from the tile hashes and the image size.
+        static ImageSignature Compute(AZStd::span<const uint8_t> pixels, uint32_t width, uint32_t height);
+
+        //! Returns whether two signatures describe the same image size and tiling, so their tiles can be compared.
+        bool IsComparableTo(const ImageSignature& other) const;
+
+        //! Returns the m_diffScore of AZ::Utils::CalcImageDiffRms() (up to rounding), but only visits the tiles whose hashes
+        //! differ; tiles with matching hashes are identical and contribute nothing. Both images must match their signatures.
+        static float CalcDiffRmsOfMismatchedTiles(
+            const ImageSignature& signatureA, AZStd::span<const uint8_t> pixelsA,
+            const ImageSignature& signatureB, AZStd::span<const uint8_t> pixelsB);
+
+        //! Returns the path of the signature file stored next to an image
+        static AZStd::string GetSignatureFilePath(const AZStd::string& imageFilePath);
+
+        //! Writes the signature for an image file next to it. The image's current modification time and size are recorded,
+        //! so a signature that was not updated along with its image is ignored by Load().
+        bool Save(const AZStd::string& imageFilePath) const;
+
+        //! Reads the signature stored next to an image file. Returns false if there is none or it is out of date.
+        bool Load(const AZStd::string& imageFilePath);
+    };
+} // namespace AtomSampleViewer
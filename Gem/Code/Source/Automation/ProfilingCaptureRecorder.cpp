@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Automation/ProfilingCaptureRecorder.h>
+
+#include <Atom/RHI/Limits.h>
+#include <Atom/RHI/RHISystemInterface.h>
+#include <Atom/RPI.Public/Pass/ParentPass.h>
+#include <Atom/RPI.Public/Pass/PassSystemInterface.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/FileIO.h>
+
+namespace AtomSampleViewer
+{
+    namespace
+    {
+        template<typename T>
+        void AppendValue(AZStd::vector<uint8_t>& buffer, T value)
+        {
+            const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+            buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+        }
+
+        template<typename T>
+        void AppendArray(AZStd::vector<uint8_t>& buffer, const AZStd::vector<T>& values)
+        {
+            const uint8_t* bytes = reinterpret_cast<const uint8_t*>(values.data());
+            buffer.insert(buffer.end(), bytes, bytes + values.size() * sizeof(T));
+        }
+    }
+
+    bool ProfilingCaptureRecorder::Begin(const AZStd::string& outputFilePath, uint32_t frameCount)
+    {
+        if (m_isCapturing)
+        {
+            AZ_Error("ProfilingCaptureRecorder", false, "A profiling capture is already in progress for '%s'.", m_outputFilePath.c_str());
+            return false;
+        }
+
+        if (frameCount == 0)
+        {
+            AZ_Error("ProfilingCaptureRecorder", false, "Profiling capture for '%s' needs at least one frame.", outputFilePath.c_str());
+            return false;
+        }
+
+        AZ::RPI::PassSystemInterface* passSystem = AZ::RPI::PassSystemInterface::Get();
+        if (!passSystem || !passSystem->GetRootPass())
+        {
+            AZ_Error("ProfilingCaptureRecorder", false, "Profiling capture requires the pass system.");
+            return false;
+        }
+
+        passSystem->GetRootPass()->SetTimestampQueryEnabled(true);
+
+        m_isCapturing = true;
+        m_outputFilePath = outputFilePath;
+        m_frameCount = frameCount;
+        m_recordedFrameCount = 0;
+
+        // Timestamp results are read back a few frames after they are queried, so wait until the queries issued
+        // after enabling them are available before recording anything.
+        m_warmUpFramesRemaining = AZ::RHI::Limits::Device::FrameCountMax;
+
+        m_cpuFrameTimes.clear();
+        m_cpuFrameTimes.reserve(m_frameCount);
+        m_passNames.clear();
+        m_passColumnIndices.clear();
+        m_passColumns.clear();
+
+        return true;
+    }
+
+    bool ProfilingCaptureRecorder::Tick()
+    {
+        if (!m_isCapturing)
+        {
+            return false;
+        }
+
+        if (m_warmUpFramesRemaining > 0)
+        {
+            --m_warmUpFramesRemaining;
+            return false;
+        }
+
+        RecordFrame();
+
+        if (m_recordedFrameCount < m_frameCount)
+        {
+            return false;
+        }
+
+        if (WriteToFile())
+        {
+            AZ_TracePrintf("ProfilingCaptureRecorder", "Wrote %u frames of profiling data for %zu passes to '%s'\n",
+                m_recordedFrameCount, m_passNames.size(), m_outputFilePath.c_str());
+        }
+
+        EndCapture();
+        return true;
+    }
+
+    void ProfilingCaptureRecorder::Abort()
+    {
+        if (m_isCapturing)
+        {
+            EndCapture();
+        }
+    }
+
+    void ProfilingCaptureRecorder::EndCapture()
+    {
+        if (AZ::RPI::PassSystemInterface* passSystem = AZ::RPI::PassSystemInterface::Get(); passSystem && passSystem->GetRootPass())
+        {
+            passSystem->GetRootPass()->SetTimestampQueryEnabled(false);
+        }
+
+        m_isCapturing = false;
+
+        // Release the capture memory; a suite can run many captures back to back.
+        m_cpuFrameTimes = {};
+        m_passNames = {};
+        m_passColumnIndices = {};
+        m_passColumns = {};
+    }
+
+    void ProfilingCaptureRecorder::RecordFrame()
+    {
+        const uint32_t frameIndex = m_recordedFrameCount;
+
+        double frameTimeMs = 0.0;
+        if (const AZ::RHI::CpuTimingStatistics* stats = AZ::RHI::RHISystemInterface::Get()->GetCpuTimingStatistics())
+        {
+            frameTimeMs = stats->GetFrameToFrameTimeMilliseconds();
+        }
+        m_cpuFrameTimes.push_back(frameTimeMs);
+
+        // Every column gets a slot for this frame up front so passes that didn't run this frame read as missing
+        for (AZStd::vector<uint64_t>& column : m_passColumns)
+        {
+            column.push_back(MissingTimestamp);
+        }
+
+        RecordPass(AZ::RPI::PassSystemInterface::Get()->GetRootPass().get(), frameIndex);
+
+        ++m_recordedFrameCount;
+    }
+
+    void ProfilingCaptureRecorder::RecordPass(const AZ::RPI::Pass* pass, uint32_t frameIndex)
+    {
+        if (!pass || !pass->IsEnabled())
+        {
+            return;
+        }
+
+        if (pass->IsTimestampQueryEnabled())
+        {
+            const AZ::Name& passName = pass->GetPathName();
+            auto columnIter = m_passColumnIndices.find(passName);
+            if (columnIter == m_passColumnIndices.end())
+            {
+                // A pass that shows up part way through the capture is missing for all prior frames
+                columnIter = m_passColumnIndices.emplace(passName, aznumeric_cast<uint32_t>(m_passColumns.size())).first;
+                m_passNames.push_back(passName);
+                m_passColumns.emplace_back(frameIndex + 1, MissingTimestamp);
+                m_passColumns.back().reserve(m_frameCount);
+            }
+
+            m_passColumns[columnIter->second][frameIndex] = pass->GetLatestTimestampResult().GetDurationInNanoseconds();
+        }
+
+        if (const AZ::RPI::ParentPass* parentPass = pass->AsParent())
+        {
+            for (const AZ::RPI::Ptr<AZ::RPI::Pass>& child : parentPass->GetChildren())
+            {
+                RecordPass(child.get(), frameIndex);
+            }
+        }
+    }
+
+    bool ProfilingCaptureRecorder::WriteToFile() const
+    {
+        // The whole file is assembled in memory so it goes out in a single write
+        AZStd::vector<uint8_t> buffer;
+        size_t nameTableSize = 0;
+        for (const AZ::Name& passName : m_passNames)
+        {
+            nameTableSize += sizeof(uint16_t) + passName.GetStringView().size();
+        }
+        buffer.reserve(sizeof(FileMagic) + 4 * sizeof(uint32_t) + nameTableSize +
+            m_recordedFrameCount * (sizeof(double) + m_passColumns.size() * sizeof(uint64_t)));
+
+        buffer.insert(buffer.end(), FileMagic, FileMagic + sizeof(FileMagic));
+        AppendValue<uint32_t>(buffer, FileVersion);
+        AppendValue<uint32_t>(buffer, m_recordedFrameCount);
+        AppendValue<uint32_t>(buffer, aznumeric_cast<uint32_t>(m_passNames.size()));
+        AppendValue<uint32_t>(buffer, 0);
+
+        for (const AZ::Name& passName : m_passNames)
+        {
+            const AZStd::string_view name = passName.GetStringView();
+            const uint16_t length = aznumeric_cast<uint16_t>(AZStd::min<size_t>(name.size(), AZStd::numeric_limits<uint16_t>::max()));
+            AppendValue<uint16_t>(buffer, length);
+            buffer.insert(buffer.end(), name.data(), name.data() + length);
+        }
+
+        AppendArray(buffer, m_cpuFrameTimes);
+        for (const AZStd::vector<uint64_t>& column : m_passColumns)
+        {
+            AppendArray(buffer, column);
+        }
+
+        AZ::IO::FileIOStream fileStream(m_outputFilePath.c_str(),
+            AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary | AZ::IO::OpenMode::ModeCreatePath);
+        if (!fileStream.IsOpen())
+        {
+            AZ_Error("ProfilingCaptureRecorder", false, "Failed to open '%s' for writing.", m_outputFilePath.c_str());
+            return false;
+        }
+
+        if (fileStream.Write(buffer.size(), buffer.data()) != buffer.size())
+        {
+            AZ_Error("ProfilingCaptureRecorder", false, "Failed to write profiling capture to '%s'.", m_outputFilePath.c_str());
+            return false;
+        }
+
+        return true;
+    }
+} // namespace AtomSampleViewer
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Name/Name.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ::RPI
+{
+    class Pass;
+}
+
+namespace AtomSampleViewer
+{
+    //! Records pass timestamps and CPU frame times for a fixed number of frames, keeping everything in memory
+    //! until the capture is complete and then writing all frames to a single columnar file in one pass.
+    //! This replaces calling CapturePassTimestamp/CaptureCpuFrameTime every frame, where each call writes its own
+    //! JSON file and the file writes disturb the very frames being measured.
+    //!
+    //! File layout (all values little endian):
+    //!     char[8]                     FileMagic
+    //!     uint32                      FileVersion
+    //!     uint32                      frame count
+    //!     uint32                      pass count
+    //!     uint32                      reserved, always 0
+    //!     pass count x {uint16 length, char[length] pass path name}
+    //!     float64[frame count]        CPU frame-to-frame time in milliseconds
+    //!     pass count x uint64[frame count]    GPU duration of each pass in nanoseconds, MissingTimestamp where the pass didn't run
+    //!
+    //! See Standalone/PythonTests/Automated/profiling_capture_reader.py for the matching reader.
+    class ProfilingCaptureRecorder
+    {
+    public:
+        static constexpr char FileMagic[8] = {'A', 'S', 'V', 'P', 'R', 'O', 'F', '\0'};
+        static constexpr uint32_t FileVersion = 1;
+        static constexpr uint64_t MissingTimestamp = AZStd::numeric_limits<uint64_t>::max();
+
+        //! Starts a new capture. Timestamp queries are enabled on all passes and, after a short warm-up so the
+        //! first recorded frame has valid GPU results, one sample is recorded per call to Tick().
+        //! @param outputFilePath the file that will be written when the capture completes
+        //! @param frameCount the number of frames to record
+        bool Begin(const AZStd::string& outputFilePath, uint32_t frameCount);
+
+        //! Records the current frame if a capture is in progress.
+        //! Returns true on the frame the capture completes and the file has been written (or failed to write).
+        bool Tick();
+
+        //! Stops the current capture without writing anything.
+        void Abort();
+
+        bool IsCapturing() const { return m_isCapturing; }
+
+    private:
+        void RecordFrame();
+        void RecordPass(const AZ::RPI::Pass* pass, uint32_t frameIndex);
+        bool WriteToFile() const;
+        void EndCapture();
+
+        bool m_isCapturing = false;
+        uint32_t m_warmUpFramesRemaining = 0;
+        uint32_t m_frameCount = 0;
+        uint32_t m_recordedFrameCount = 0;
+        AZStd::string m_outputFilePath;
+
+        AZStd::vector<double> m_cpuFrameTimes;
+        AZStd::vector<AZ::Name> m_passNames;
+        AZStd::unordered_map<AZ::Name, uint32_t> m_passColumnIndices;
+        AZStd::vector<AZStd::vector<uint64_t>> m_passColumns;
+    };
+} // namespace AtomSampleViewer
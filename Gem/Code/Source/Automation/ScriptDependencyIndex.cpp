@@ -0,0 +1,362 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Automation/ScriptDependencyIndex.h>
+#include <Utils/Utils.h>
+
+#include <AzCore/Asset/AssetManagerBus.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/Serialization/Json/JsonUtils.h>
+#include <AzCore/std/string/conversions.h>
+#include <AzFramework/IO/LocalFileIO.h>
+#include <AzFramework/StringFunc/StringFunc.h>
+
+namespace AtomSampleViewer
+{
+    ScriptDependencyIndex::ScriptDependencyIndex()
+        : m_getModificationTime([](const AZStd::string& productPath) -> AZ::u64
+            {
+                // Products in the cache are always lower case
+                AZStd::string cachePath = "@products@/" + productPath;
+                AZStd::to_lower(cachePath.begin(), cachePath.end());
+
+                AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+                return fileIO && fileIO->Exists(cachePath.c_str()) ? fileIO->ModificationTime(cachePath.c_str()) : 0;
+            })
+        , m_getSharedProducts([]()
+            {
+                AZStd::vector<AZStd::string> productPaths;
+                AZ::Data::AssetCatalogRequestBus::Broadcast(&AZ::Data::AssetCatalogRequestBus::Events::EnumerateAssets, nullptr,
+                    [&productPaths](const AZ::Data::AssetId&, const AZ::Data::AssetInfo& assetInfo)
+                    {
+                        if (IsSharedProduct(assetInfo.m_relativePath))
+                        {
+                            productPaths.push_back(assetInfo.m_relativePath);
+                        }
+                    },
+                    nullptr);
+                return productPaths;
+            })
+    {
+    }
+
+    ScriptDependencyIndex::ScriptDependencyIndex(ModificationTimeFunction getModificationTime, SharedProductsFunction getSharedProducts)
+        : m_getModificationTime(AZStd::move(getModificationTime))
+        , m_getSharedProducts(AZStd::move(getSharedProducts))
+    {
+    }
+
+    bool ScriptDependencyIndex::IsSharedProduct(const AZStd::string& productPath)
+    {
+        return AzFramework::StringFunc::Path::IsExtension(productPath.c_str(), "azshader")
+            || AzFramework::StringFunc::Path::IsExtension(productPath.c_str(), "pass");
+    }
+
+    AZ::u64 ScriptDependencyIndex::GetSharedProductsHash() const
+    {
+        if (m_sharedProductsHash == 0)
+        {
+            // The catalog doesn't list products in a set order
+            AZStd::vector<AZStd::string> productPaths = m_getSharedProducts();
+            AZStd::sort(productPaths.begin(), productPaths.end());
+
+            size_t hash = productPaths.size();
+            for (const AZStd::string& productPath : productPaths)
+            {
+                AZStd::hash_combine(hash, productPath, m_getModificationTime(productPath));
+            }
+            m_sharedProductsHash = hash != 0 ? hash : 1;
+        }
+        return m_sharedProductsHash;
+    }
+
+    void ScriptDependencyIndex::BeginScript(const AZStd::string& scriptPath)
+    {
+        ScriptEntry& entry = m_scripts[scriptPath];
+        entry.m_modificationTime = m_getModificationTime(scriptPath);
+        entry.m_sharedProductsHash = GetSharedProductsHash();
+        entry.m_samples.clear();
+        m_recordedScripts.insert(scriptPath);
+    }
+
+    void ScriptDependencyIndex::RecordScriptSample(const AZStd::string& scriptPath, const AZStd::string& sampleName)
+    {
+        auto scriptIter = m_scripts.find(scriptPath);
+        if (scriptIter == m_scripts.end())
+        {
+            AZ_Assert(false, "BeginScript() was not called for '%s'", scriptPath.c_str());
+            return;
+        }
+
+        AZStd::vector<AZStd::string>& samples = scriptIter->second.m_samples;
+        if (AZStd::find(samples.begin(), samples.end(), sampleName) == samples.end())
+        {
+            samples.push_back(sampleName);
+        }
+    }
+
+    void ScriptDependencyIndex::ForgetScript(const AZStd::string& scriptPath)
+    {
+        m_scripts.erase(scriptPath);
+        m_recordedScripts.insert(scriptPath);
+    }
+
+    void ScriptDependencyIndex::RecordSampleAssets(const AZStd::string& sampleName, const AZStd::vector<AZStd::string>& assetPaths)
+    {
+        ProductTimes& productTimes = m_sampleAssets[sampleName];
+        productTimes.clear();
+        productTimes.reserve(assetPaths.size());
+        for (const AZStd::string& assetPath : assetPaths)
+        {
+            productTimes.emplace_back(assetPath, m_getModificationTime(assetPath));
+        }
+        m_sampleSharedProductsHashes[sampleName] = GetSharedProductsHash();
+        m_recordedSamples.insert(sampleName);
+    }
+
+    bool ScriptDependencyIndex::IsProductChanged(const AZStd::string& productPath, AZ::u64 recordedTime) const
+    {
+        const AZ::u64 currentTime = m_getModificationTime(productPath);
+
+        // A product that is missing now can't be trusted to produce the same results either
+        return currentTime == 0 || currentTime != recordedTime;
+    }
+
+    bool ScriptDependencyIndex::IsScriptAffected(const AZStd::string& scriptPath) const
+    {
+        auto scriptIter = m_scripts.find(scriptPath);
+        if (scriptIter == m_scripts.end())
+        {
+            return true;
+        }
+
+        const ScriptEntry& entry = scriptIter->second;
+        if (IsProductChanged(scriptPath, entry.m_modificationTime) || entry.m_sharedProductsHash != GetSharedProductsHash())
+        {
+            return true;
+        }
+
+        for (const AZStd::string& sampleName : entry.m_samples)
+        {
+            if (IsSampleAffected(sampleName))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    bool ScriptDependencyIndex::IsSampleAffected(const AZStd::string& sampleName) const
+    {
+        auto sampleIter = m_sampleAssets.find(sampleName);
+        if (sampleIter == m_sampleAssets.end())
+        {
+            return true;
+        }
+
+        auto sharedHashIter = m_sampleSharedProductsHashes.find(sampleName);
+        if (sharedHashIter == m_sampleSharedProductsHashes.end() || sharedHashIter->second != GetSharedProductsHash())
+        {
+            return true;
+        }
+
+        for (const auto& [productPath, recordedTime] : sampleIter->second)
+        {
+            if (IsProductChanged(productPath, recordedTime))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void ScriptDependencyIndex::ReadJson(const rapidjson::Value& value)
+    {
+        m_scripts.clear();
+        m_sampleAssets.clear();
+        m_sampleSharedProductsHashes.clear();
+        m_recordedScripts.clear();
+        m_recordedSamples.clear();
+
+        if (!value.IsObject())
+        {
+            return;
+        }
+
+        if (value.HasMember("scripts") && value["scripts"].IsObject())
+        {
+            for (const auto& scriptMember : value["scripts"].GetObject())
+            {
+                const rapidjson::Value& scriptValue = scriptMember.value;
+                if (!scriptValue.IsObject() || !scriptValue.HasMember("modificationTime") || !scriptValue["modificationTime"].IsUint64())
+                {
+                    continue;
+                }
+
+                ScriptEntry& entry = m_scripts[scriptMember.name.GetString()];
+                entry.m_modificationTime = scriptValue["modificationTime"].GetUint64();
+                if (scriptValue.HasMember("sharedProductsHash") && scriptValue["sharedProductsHash"].IsUint64())
+                {
+                    entry.m_sharedProductsHash = scriptValue["sharedProductsHash"].GetUint64();
+                }
+                if (scriptValue.HasMember("samples") && scriptValue["samples"].IsArray())
+                {
+                    for (const auto& sampleValue : scriptValue["samples"].GetArray())
+                    {
+                        if (sampleValue.IsString())
+                        {
+                            entry.m_samples.emplace_back(sampleValue.GetString());
+                        }
+                    }
+                }
+            }
+        }
+
+        if (value.HasMember("samples") && value["samples"].IsObject())
+        {
+            for (const auto& sampleMember : value["samples"].GetObject())
+            {
+                if (!sampleMember.value.IsObject())
+                {
+                    continue;
+                }
+
+                ProductTimes& productTimes = m_sampleAssets[sampleMember.name.GetString()];
+                for (const auto& assetMember : sampleMember.value.GetObject())
+                {
+                    if (assetMember.value.IsUint64())
+                    {
+                        productTimes.emplace_back(assetMember.name.GetString(), assetMember.value.GetUint64());
+                    }
+                }
+            }
+        }
+
+        if (value.HasMember("sampleSharedProductsHashes") && value["sampleSharedProductsHashes"].IsObject())
+        {
+            for (const auto& sampleMember : value["sampleSharedProductsHashes"].GetObject())
+            {
+                if (sampleMember.value.IsUint64())
+                {
+                    m_sampleSharedProductsHashes[sampleMember.name.GetString()] = sampleMember.value.GetUint64();
+                }
+            }
+        }
+    }
+
+    void ScriptDependencyIndex::WriteJson(rapidjson::Document& document) const
+    {
+        document.SetObject();
+        auto& allocator = document.GetAllocator();
+
+        rapidjson::Value scripts(rapidjson::kObjectType);
+        for (const auto& [scriptPath, entry] : m_scripts)
+        {
+            rapidjson::Value samples(rapidjson::kArrayType);
+            for (const AZStd::string& sampleName : entry.m_samples)
+            {
+                samples.PushBack(rapidjson::Value(sampleName.c_str(), allocator), allocator);
+            }
+
+            rapidjson::Value scriptValue(rapidjson::kObjectType);
+            scriptValue.AddMember("modificationTime", rapidjson::Value(entry.m_modificationTime), allocator);
+            scriptValue.AddMember("sharedProductsHash", rapidjson::Value(entry.m_sharedProductsHash), allocator);
+            scriptValue.AddMember("samples", samples, allocator);
+            scripts.AddMember(rapidjson::Value(scriptPath.c_str(), allocator), scriptValue, allocator);
+        }
+        document.AddMember("scripts", scripts, allocator);
+
+        rapidjson::Value samples(rapidjson::kObjectType);
+        for (const auto& [sampleName, productTimes] : m_sampleAssets)
+        {
+            rapidjson::Value assets(rapidjson::kObjectType);
+            for (const auto& [productPath, modificationTime] : productTimes)
+            {
+                assets.AddMember(rapidjson::Value(productPath.c_str(), allocator), rapidjson::Value(modificationTime), allocator);
+            }
+            samples.AddMember(rapidjson::Value(sampleName.c_str(), allocator), assets, allocator);
+        }
+        document.AddMember("samples", samples, allocator);
+
+        rapidjson::Value sampleSharedProductsHashes(rapidjson::kObjectType);
+        for (const auto& [sampleName, sharedProductsHash] : m_sampleSharedProductsHashes)
+        {
+            sampleSharedProductsHashes.AddMember(rapidjson::Value(sampleName.c_str(), allocator), rapidjson::Value(sharedProductsHash), allocator);
+        }
+        document.AddMember("sampleSharedProductsHashes", sampleSharedProductsHashes, allocator);
+    }
+
+    bool ScriptDependencyIndex::Load()
+    {
+        const AZStd::string filePath = Utils::ResolvePath(IndexFilePath);
+        if (!AZ::IO::LocalFileIO::GetInstance()->Exists(filePath.c_str()))
+        {
+            ReadJson(rapidjson::Value());
+            return false;
+        }
+
+        auto readResult = AZ::JsonSerializationUtils::ReadJsonFile(filePath);
+        if (!readResult.IsSuccess())
+        {
+            AZ_Warning("Automation", false, "Could not read the script dependency index '%s'. All scripts will be treated as affected.", filePath.c_str());
+            ReadJson(rapidjson::Value());
+            return false;
+        }
+
+        ReadJson(readResult.GetValue());
+        return true;
+    }
+
+    bool ScriptDependencyIndex::Save() const
+    {
+        const AZStd::string filePath = Utils::ResolvePath(IndexFilePath);
+
+        ScriptDependencyIndex merged(m_getModificationTime, m_getSharedProducts);
+        if (AZ::IO::LocalFileIO::GetInstance()->Exists(filePath.c_str()))
+        {
+            auto readResult = AZ::JsonSerializationUtils::ReadJsonFile(filePath);
+            if (readResult.IsSuccess())
+            {
+                merged.ReadJson(readResult.GetValue());
+            }
+        }
+
+        for (const AZStd::string& scriptPath : m_recordedScripts)
+        {
+            if (auto scriptIter = m_scripts.find(scriptPath); scriptIter != m_scripts.end())
+            {
+                merged.m_scripts[scriptPath] = scriptIter->second;
+            }
+            else
+            {
+                merged.m_scripts.erase(scriptPath);
+            }
+        }
+        for (const AZStd::string& sampleName : m_recordedSamples)
+        {
+            merged.m_sampleAssets[sampleName] = m_sampleAssets.at(sampleName);
+            merged.m_sampleSharedProductsHashes[sampleName] = m_sampleSharedProductsHashes.at(sampleName);
+        }
+
+        rapidjson::Document document;
+        merged.WriteJson(document);
+
+        AZStd::string folderPath;
+        AzFramework::StringFunc::Path::GetFolderPath(filePath.c_str(), folderPath);
+        AZ::IO::LocalFileIO::GetInstance()->CreatePath(folderPath.c_str());
+
+        auto writeResult = AZ::JsonSerializationUtils::WriteJsonFile(document, filePath);
+        AZ_Warning("Automation", writeResult.IsSuccess(), "Could not write the script dependency index '%s'.", filePath.c_str());
+        return writeResult.IsSuccess();
+    }
+} // namespace AtomSampleViewer
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/JSON/document.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/string/string.h>
+
+namespace AtomSampleViewer
+{
+    //! Remembers what each test script depended on the last time it ran, so a later run can skip the scripts whose
+    //! dependencies haven't been rebuilt since.
+    //!
+    //! A script depends on its own product, on the samples it opened, and on the asset products each of those samples preloaded
+    //! (see CommonSampleComponentBase::PreloadAssets()). The modification time of every product is stored when it is recorded.
+    //! A script is affected if any of those products has a different modification time now. Anything the index doesn't know
+    //! about counts as affected: a script that never ran, or a sample that never reported its assets.
+    //!
+    //! Shaders and passes are loaded by the render pipelines and feature processors rather than preloaded by samples, so they
+    //! can't be attributed to a sample. A hash of the modification times of all of those shared products is stored with every
+    //! script and sample instead, and when any of them changed, every script and sample is affected.
+    class ScriptDependencyIndex
+    {
+    public:
+        static constexpr const char* IndexFilePath = "@user@/ScriptDependencyIndex.json";
+
+        //! Returns the current modification time of an asset product, or 0 if it doesn't exist
+        using ModificationTimeFunction = AZStd::function<AZ::u64(const AZStd::string& productPath)>;
+
+        //! Returns the paths of the products that every script depends on
+        using SharedProductsFunction = AZStd::function<AZStd::vector<AZStd::string>()>;
+
+        //! Uses the modification times of the files in the asset cache, and the shader and pass products in the asset catalog
+        //! as shared products
+        ScriptDependencyIndex();
+        ScriptDependencyIndex(ModificationTimeFunction getModificationTime, SharedProductsFunction getSharedProducts);
+
+        //! Returns whether a product is a shader or pass, see SharedProductsFunction
+        static bool IsSharedProduct(const AZStd::string& productPath);
+
+        //! Starts a new record for a script that is about to run, replacing what was recorded for it before
+        void BeginScript(const AZStd::string& scriptPath);
+
+        //! Records that a running script opened a sample
+        void RecordScriptSample(const AZStd::string& scriptPath, const AZStd::string& sampleName);
+
+        //! Drops what was recorded for a script, so it stays affected until it runs cleanly. Used for scripts that reported errors.
+        void ForgetScript(const AZStd::string& scriptPath);
+
+        //! Records the asset products a sample preloaded, replacing what was recorded for it before
+        void RecordSampleAssets(const AZStd::string& sampleName, const AZStd::vector<AZStd::string>& assetPaths);
+
+        bool IsScriptAffected(const AZStd::string& scriptPath) const;
+        bool IsSampleAffected(const AZStd::string& sampleName) const;
+
+        //! Replaces the contents of the index with what's in the JSON value
+        void ReadJson(const rapidjson::Value& value);
+        void WriteJson(rapidjson::Document& document) const;
+
+        //! Reads IndexFilePath
+        bool Load();
+
+        //! Writes IndexFilePath. Other processes may have updated it since it was loaded, e.g. other test suite shards,
+        //! so only the entries recorded by this process replace the ones in the file.
+        bool Save() const;
+
+        //! Whether anything was recorded since the index was loaded
+        bool HasRecordedChanges() const { return !m_recordedScripts.empty() || !m_recordedSamples.empty(); }
+
+    private:
+        struct ScriptEntry
+        {
+            AZ::u64 m_modificationTime = 0;
+            AZ::u64 m_sharedProductsHash = 0;
+            AZStd::vector<AZStd::string> m_samples;
+        };
+
+        using ProductTimes = AZStd::vector<AZStd::pair<AZStd::string, AZ::u64>>;
+
+        bool IsProductChanged(const AZStd::string& productPath, AZ::u64 recordedTime) const;
+
+        //! Hashes the paths and modification times of the shared products. It is computed once, so what is recorded during a
+        //! run is compared with the products as they were when the run started. Never 0, which stands for unknown.
+        AZ::u64 GetSharedProductsHash() const;
+
+        ModificationTimeFunction m_getModificationTime;
+        SharedProductsFunction m_getSharedProducts;
+        mutable AZ::u64 m_sharedProductsHash = 0;
+
+        AZStd::unordered_map<AZStd::string, ScriptEntry> m_scripts;
+        AZStd::unordered_map<AZStd::string, ProductTimes> m_sampleAssets;
+        AZStd::unordered_map<AZStd::string, AZ::u64> m_sampleSharedProductsHashes;
+
+        // What was recorded by this process, as opposed to loaded from the file
+        AZStd::unordered_set<AZStd::string> m_recordedScripts;
+        AZStd::unordered_set<AZStd::string> m_recordedSamples;
+    };
+} // namespace AtomSampleViewer
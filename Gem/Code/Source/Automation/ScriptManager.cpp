@@ -19,22 +19,32 @@
 #include <Atom/Feature/ImGui/SystemBus.h>
 #include <Atom/RPI.Reflect/Asset/AssetUtils.h>
 #include <Atom/RHI/Factory.h>
+#include <Atom/RHI/StreamingImagePool.h>
+#include <Atom/RPI.Public/Image/ImageSystemInterface.h>
+#include <Atom/RPI.Public/Image/StreamingImagePool.h>
+#include <AzCore/Asset/AssetManager.h>
 
 #include <AzCore/Component/Entity.h>
+#include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/Settings/SettingsRegistryScriptUtils.h>
 #include <AzCore/Script/ScriptContext.h>
 #include <AzCore/Script/ScriptSystemBus.h>
 #include <AzCore/Script/ScriptAsset.h>
+#include <AzCore/Script/lua/lua.h>
+#include <AzCore/Serialization/Json/JsonUtils.h>
 #include <AzCore/Math/MathReflection.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Time/ITime.h>
+#include <AzCore/Utils/Utils.h>
 
 #include <AzFramework/API/ApplicationAPI.h>
+#include <AzFramework/CommandLine/CommandLine.h>
 #include <AzFramework/Components/ConsoleBus.h>
 #include <AzFramework/IO/LocalFileIO.h>
 #include <AzFramework/Windowing/WindowBus.h>
 
 #include <AtomSampleViewerRequestBus.h>
+#include <Utils/SampleAssetPrefetcher.h>
 #include <Utils/Utils.h>
 
 namespace AtomSampleViewer
@@ -72,6 +82,10 @@ namespace AtomSampleViewer
         ScriptRunnerRequestBus::Handler::BusConnect();
 
         m_imageComparisonOptions.Activate();
+
+        m_dependencyIndex.Load();
+
+        m_prefetchUpcomingSamples = SampleAssetPrefetcher::IsLookAheadEnabled();
     }
 
     void ScriptManager::Deactivate()
@@ -109,6 +123,142 @@ namespace AtomSampleViewer
         m_scriptPaused = false;
     }
 
+    int ScriptManager::GetRandomTestSeed()
+    {
+        return m_testSuiteRunConfig.m_randomSeed;
+    }
+
+    void ScriptManager::SetSceneComposition(AZ::u64 randomSeed, AZ::u64 compositionHash)
+    {
+        m_sceneComposition.m_isValid = true;
+        m_sceneComposition.m_randomSeed = randomSeed;
+        m_sceneComposition.m_compositionHash = compositionHash;
+    }
+
+    void ScriptManager::ClearSceneComposition()
+    {
+        m_sceneComposition = {};
+    }
+
+    void ScriptManager::SetSampleStatistic(const AZStd::string& name, double value)
+    {
+        m_sampleStatistics[name] = value;
+    }
+
+    void ScriptManager::ClearSampleStatistics()
+    {
+        m_sampleStatistics.clear();
+    }
+
+    void ScriptManager::SetPendingSampleAssetCount(uint32_t pendingAssetCount)
+    {
+        m_pendingSampleAssetCount = pendingAssetCount;
+    }
+
+    const char* ScriptManager::GetWaitConditionName(WaitCondition condition)
+    {
+        switch (condition)
+        {
+        case WaitCondition::SampleAssetsLoaded:
+            return "sample assets loaded";
+        case WaitCondition::AssetLoadsFinished:
+            return "asset loads finished";
+        case WaitCondition::ImageStreamingSettled:
+            return "image streaming settled";
+        case WaitCondition::FrameTimeStable:
+            return "frame time stable";
+        default:
+            return "none";
+        }
+    }
+
+    void ScriptManager::BeginWaitCondition(WaitCondition condition, float timeout)
+    {
+        AZ_Assert(m_waitCondition == WaitCondition::None, "It shouldn't be possible to run the next command until m_waitCondition is None");
+
+        m_waitCondition = condition;
+        m_waitConditionTimeout = timeout;
+        m_waitConditionSettledFrames = 0;
+        m_lastStreamingResidentBytes = 0;
+    }
+
+    bool ScriptManager::UpdateWaitCondition(float deltaTime, float frameTime)
+    {
+        auto isAssetManagerIdle = []()
+        {
+            return !AZ::Data::AssetManager::IsReady() || !AZ::Data::AssetManager::Instance().HasActiveJobsOrStreamerRequests();
+        };
+
+        bool isMet = false;
+        switch (m_waitCondition)
+        {
+        case WaitCondition::SampleAssetsLoaded:
+            isMet = m_pendingSampleAssetCount == 0;
+            break;
+
+        case WaitCondition::AssetLoadsFinished:
+            m_waitConditionSettledFrames = isAssetManagerIdle() ? m_waitConditionSettledFrames + 1 : 0;
+            isMet = m_waitConditionSettledFrames >= AssetLoadsSettleFrames;
+            break;
+
+        case WaitCondition::ImageStreamingSettled:
+        {
+            size_t residentBytes = 0;
+            if (auto* imageSystem = AZ::RPI::ImageSystemInterface::Get())
+            {
+                if (const AZ::Data::Instance<AZ::RPI::StreamingImagePool>& streamingPool = imageSystem->GetSystemStreamingPool())
+                {
+                    residentBytes = streamingPool->GetRHIPool()->GetHeapMemoryUsage(AZ::RHI::HeapMemoryLevel::Device).m_usedResidentInBytes.load();
+                }
+            }
+
+            const bool unchanged = residentBytes == m_lastStreamingResidentBytes && isAssetManagerIdle();
+            m_waitConditionSettledFrames = unchanged ? m_waitConditionSettledFrames + 1 : 0;
+            m_lastStreamingResidentBytes = residentBytes;
+            isMet = m_waitConditionSettledFrames >= ImageStreamingSettleFrames;
+            break;
+        }
+
+        case WaitCondition::FrameTimeStable:
+            m_frameTimeWindow.PushFrameTime(frameTime);
+            isMet = m_frameTimeWindow.IsStable();
+            break;
+
+        default:
+            isMet = true;
+            break;
+        }
+
+        if (isMet)
+        {
+            AZ_Printf("Automation", "Wait for %s finished with %f seconds remaining.\n", GetWaitConditionName(m_waitCondition), m_waitConditionTimeout);
+            m_waitCondition = WaitCondition::None;
+            return true;
+        }
+
+        m_waitConditionTimeout -= deltaTime;
+        if (m_waitConditionTimeout < 0)
+        {
+            if (m_waitCondition == WaitCondition::FrameTimeStable)
+            {
+                AZ_Error("Automation", false, "Script timed out waiting for frame time to be stable; frames still vary by up to %.1f%% from the mean of %.2fms. Continuing...",
+                    m_frameTimeWindow.GetMaxDeviation() * 100.0f, m_frameTimeWindow.GetMean() * 1000.0f);
+            }
+            else if (m_waitCondition == WaitCondition::SampleAssetsLoaded)
+            {
+                AZ_Error("Automation", false, "Script timed out waiting for %u sample assets to load. Continuing...", m_pendingSampleAssetCount);
+            }
+            else
+            {
+                AZ_Error("Automation", false, "Script timed out waiting for %s. Continuing...", GetWaitConditionName(m_waitCondition));
+            }
+            m_waitCondition = WaitCondition::None;
+            return true;
+        }
+
+        return false;
+    }
+
     void ScriptManager::ReportScriptError([[maybe_unused]] const AZStd::string& message)
     {
         AZ_Error("Automation", false, "Script: %s", message.c_str());
@@ -303,11 +453,33 @@ namespace AtomSampleViewer
         ScriptableImGui::CheckAllActionsConsumed();
         ScriptableImGui::ClearActions();
 
+        if (m_profilingCaptureRecorder.Tick())
+        {
+            m_isCapturePending = false;
+            if (m_scriptPaused)
+            {
+                ResumeScript();
+            }
+        }
+
+        // Screenshot comparisons run in the background; record any that finished since the last frame
+        m_scriptReporter.ProcessCompletedScreenshotChecks();
+
+        const auto tickTime = AZStd::chrono::steady_clock::now();
+        const float frameTime = m_lastTickTime == AZStd::chrono::steady_clock::time_point{}
+            ? deltaTime : AZStd::chrono::duration<float>(tickTime - m_lastTickTime).count();
+        m_lastTickTime = tickTime;
+
         // We delayed PopScript() until after the above CheckAllActionsConsumed(), so that any errors
         // reported by that function will be associated with the proper script.
         if (m_shouldPopScript)
         {
             m_scriptReporter.PopScript();
+            m_operationTrace.EndScript();
+            if (!m_runningScripts.empty())
+            {
+                m_runningScripts.pop_back();
+            }
             m_shouldPopScript = false;
         }
 
@@ -318,6 +490,7 @@ namespace AtomSampleViewer
                 // If we just finished executing a script, the remaining m_scriptOperations are for some other script.
                 // We need to proceed to the next frame and allow that PopScript() to happen, otherwise any errors related
                 // to subsequent operations would be reported against the prior script.
+                m_operationTrace.RecordWait(ScriptOperationTrace::WaitReason::ScriptBoundary);
                 break;
             }
 
@@ -328,9 +501,17 @@ namespace AtomSampleViewer
                 {
                     AZ_Error("Automation", false, "Script pause timed out. Continuing...");
                     m_scriptPaused = false;
+
+                    // Otherwise the capture keeps running and the next BeginProfilingCapture() fails
+                    if (m_profilingCaptureRecorder.IsCapturing())
+                    {
+                        m_profilingCaptureRecorder.Abort();
+                    }
+                    m_isCapturePending = false;
                 }
                 else
                 {
+                    m_operationTrace.RecordWait(m_isCapturePending ? ScriptOperationTrace::WaitReason::Capture : ScriptOperationTrace::WaitReason::Pause);
                     break;
                 }
             }
@@ -353,24 +534,36 @@ namespace AtomSampleViewer
                 }
                 else
                 {
+                    m_operationTrace.RecordWait(ScriptOperationTrace::WaitReason::AssetTracker);
                     break;
                 }
             }
 
+            if (m_waitCondition != WaitCondition::None && !UpdateWaitCondition(deltaTime, frameTime))
+            {
+                m_operationTrace.RecordWait(ScriptOperationTrace::WaitReason::Condition);
+                break;
+            }
+
             if (m_scriptIdleFrames > 0)
             {
                 m_scriptIdleFrames--;
+                m_operationTrace.RecordWait(ScriptOperationTrace::WaitReason::IdleFrames);
                 break;
             }
 
             if (m_scriptIdleSeconds > 0)
             {
                 m_scriptIdleSeconds -= deltaTime;
+                m_operationTrace.RecordWait(ScriptOperationTrace::WaitReason::IdleSeconds);
                 break;
             }
 
             // Execute the next operation
+            const uint32_t traceIndex = m_scriptOperations.GetFrontTraceIndex();
+            m_operationTrace.RecordDispatch(traceIndex);
             m_scriptOperations.front()();
+            m_operationTrace.RecordComplete(traceIndex);
 
             m_scriptOperations.pop();
 
@@ -396,6 +589,7 @@ namespace AtomSampleViewer
                 AZ_Assert(m_scriptIdleFrames == 0, "Script manager is in an unexpected state.");
                 AZ_Assert(m_scriptIdleSeconds <= 0.0f, "Script manager is in an unexpected state.");
                 AZ_Assert(m_waitForAssetTracker == false, "Script manager is in an unexpected state.");
+                AZ_Assert(m_waitCondition == WaitCondition::None, "Script manager is in an unexpected state.");
                 AZ_Assert(!m_scriptReporter.HasActiveScript(), "Script manager is in an unexpected state.");
                 AZ_Assert(m_executingScripts.size() == 0, "Script manager is in an unexpected state");
 
@@ -416,16 +610,21 @@ namespace AtomSampleViewer
                 // In case scripts were aborted while ImGui was temporarily hidden, show it again.
                 SetShowImGui(true);
 
-                m_scriptReporter.SortScriptReports();
                 m_scriptReporter.OpenReportDialog();
 
                 m_shouldPopScript = false;
                 m_doFinalScriptCleanup = false;
 
+                WriteOperationTrace();
+                FinishTestResultsExport();
+                SaveDependencyIndex();
+
                 if (m_testSuiteRunConfig.m_automatedRunEnabled && m_testSuiteRunConfig.m_closeOnTestScriptFinish)
                 {
                     m_testSuiteRunConfig.m_automatedRunEnabled = false;
 
+                    RecordTestSuiteResults();
+
                     if (m_scriptReporter.HasErrorsAssertsInReport())
                     {
                         AtomSampleViewerRequestsBus::Broadcast(&AtomSampleViewerRequestsBus::Events::SetExitCode, 1);
@@ -462,28 +661,238 @@ namespace AtomSampleViewer
         m_showPrecommitWizard = true;
     }
 
-    void ScriptManager::RunMainTestSuite(const AZStd::string& suiteFilePath, bool exitOnTestEnd, int randomSeed)
+    void ScriptManager::RunMainTestSuite(const AZStd::string& suiteFilePath, bool exitOnTestEnd, int randomSeed, int shardIndex, int shardCount)
     {
         m_testSuiteRunConfig.m_automatedRunEnabled = true;
         m_testSuiteRunConfig.m_testSuitePath = suiteFilePath;
         m_testSuiteRunConfig.m_closeOnTestScriptFinish = exitOnTestEnd;
         m_testSuiteRunConfig.m_randomSeed = randomSeed;
+        m_testSuiteRunConfig.m_shardIndex = shardIndex;
+        m_testSuiteRunConfig.m_shardCount = shardCount;
+
+        if (shardCount > 1)
+        {
+            AZ_Printf("Automation", "Running shard %d of %d of test suite '%s'\n", shardIndex, shardCount, suiteFilePath.c_str());
+
+            // Results left by an earlier run would be merged as this run's if this shard doesn't get to export its own
+            const AZStd::string shardResultsFilePath = GetShardResultsFilePath();
+            if (AZ::IO::LocalFileIO::GetInstance()->Exists(shardResultsFilePath.c_str()))
+            {
+                AZ::IO::LocalFileIO::GetInstance()->Remove(shardResultsFilePath.c_str());
+            }
+        }
+
+        // Every shard has to see the same durations to agree on which tests it runs, so they are loaded once up front
+        LoadRecordedScriptDurations();
+    }
+
+    void ScriptManager::RecordSampleAssets(const AZStd::string& sampleName, const AZStd::vector<AZStd::string>& assetPaths)
+    {
+        m_dependencyIndex.RecordSampleAssets(sampleName, assetPaths);
+    }
+
+    AZStd::string ScriptManager::GetTestResultsFilePath(const AZStd::string& fileName)
+    {
+        AZStd::string filePath;
+        AzFramework::StringFunc::Path::Join(AZ::Utils::GetProjectPath().c_str(), ScriptReporter::TestResultsFolder, filePath);
+        AzFramework::StringFunc::Path::Join(filePath.c_str(), fileName.c_str(), filePath);
+        return filePath;
+    }
+
+    AZStd::string ScriptManager::GetShardResultsFilePath() const
+    {
+        return GetTestResultsFilePath(AZStd::string::format(
+            "shard_%d_of_%d.json", m_testSuiteRunConfig.m_shardIndex, m_testSuiteRunConfig.m_shardCount));
+    }
+
+    void ScriptManager::LoadRecordedScriptDurations()
+    {
+        m_recordedScriptDurations.clear();
+
+        const AZStd::string filePath = GetTestResultsFilePath(ScriptDurationsFileName);
+        if (!AZ::IO::LocalFileIO::GetInstance()->Exists(filePath.c_str()))
+        {
+            return;
+        }
+
+        auto readResult = AZ::JsonSerializationUtils::ReadJsonFile(filePath);
+        if (!readResult.IsSuccess() || !readResult.GetValue().IsObject())
+        {
+            AZ_Warning("Automation", false, "Could not read script durations from '%s'. Test shards will be balanced by script count.", filePath.c_str());
+            return;
+        }
+
+        for (const auto& member : readResult.GetValue().GetObject())
+        {
+            if (member.value.IsNumber())
+            {
+                m_recordedScriptDurations[member.name.GetString()] = member.value.GetFloat();
+            }
+        }
+    }
+
+    void ScriptManager::SaveRecordedScriptDurations()
+    {
+        // Scripts that didn't run this time keep their previous duration
+        for (const ScriptReporter::ScriptReport& scriptReport : m_scriptReporter.GetScriptReport())
+        {
+            m_recordedScriptDurations[scriptReport.m_scriptAssetPath] = aznumeric_cast<float>(scriptReport.m_durationSeconds);
+        }
+        for (const auto& [testName, seconds] : m_scriptReporter.GetTestDurations())
+        {
+            m_recordedScriptDurations[testName] = aznumeric_cast<float>(seconds);
+        }
+
+        rapidjson::Document document;
+        document.SetObject();
+        for (const auto& [scriptFilePath, duration] : m_recordedScriptDurations)
+        {
+            document.AddMember(
+                rapidjson::Value(scriptFilePath.c_str(), document.GetAllocator()),
+                rapidjson::Value(duration),
+                document.GetAllocator());
+        }
+
+        const AZStd::string filePath = GetTestResultsFilePath(ScriptDurationsFileName);
+        AZStd::string folderPath;
+        AzFramework::StringFunc::Path::GetFolderPath(filePath.c_str(), folderPath);
+        AZ::IO::LocalFileIO::GetInstance()->CreatePath(folderPath.c_str());
+
+        auto writeResult = AZ::JsonSerializationUtils::WriteJsonFile(document, filePath);
+        AZ_Warning("Automation", writeResult.IsSuccess(), "Could not write script durations to '%s'.", filePath.c_str());
+    }
+
+    void ScriptManager::RecordTestSuiteResults()
+    {
+        if (m_testSuiteRunConfig.m_shardCount > 1)
+        {
+            // Shards run at the same time, so rather than all updating the durations file, each exports its results
+            // for the merge step to combine.
+            m_scriptReporter.ExportTestResultsJson(GetShardResultsFilePath());
+        }
+        else
+        {
+            SaveRecordedScriptDurations();
+        }
+    }
+
+    void ScriptManager::ScriptOperationQueue::push(ScriptOp operation)
+    {
+        ScriptManager* scriptManager = GetInstance();
+        lua_State* luaState = scriptManager->m_scriptContext ? scriptManager->m_scriptContext->NativeContext() : nullptr;
+        m_operations.push({ AZStd::move(operation), scriptManager->m_operationTrace.RecordEnqueue(luaState) });
+    }
+
+    void ScriptManager::WriteOperationTrace()
+    {
+        if (!m_operationTrace.IsRecording())
+        {
+            return;
+        }
+
+        m_operationTrace.End();
+
+        AZStd::string scriptFilePath;
+        if (!m_operationTrace.GetScriptSpans().empty())
+        {
+            scriptFilePath = m_operationTrace.GetStrings()[m_operationTrace.GetScriptSpans().front().m_nameIndex];
+        }
+
+        const AZStd::string filePath = GetScriptRunFilePath("ScriptTrace", scriptFilePath, ".json");
+        AZStd::string folderPath;
+        AzFramework::StringFunc::Path::GetFolderPath(filePath.c_str(), folderPath);
+        AZ::IO::LocalFileIO::GetInstance()->CreatePath(folderPath.c_str());
+
+        if (m_operationTrace.WriteChromeTrace(filePath))
+        {
+            AZ_Printf("Automation", "Script operation trace written to %s\n", filePath.c_str());
+        }
+    }
+
+    AZStd::string ScriptManager::GetScriptRunFilePath(const char* prefix, const AZStd::string& scriptFilePath, const char* extension) const
+    {
+        AZStd::string scriptName;
+        AzFramework::StringFunc::Path::GetFileName(scriptFilePath.c_str(), scriptName);
+        AzFramework::StringFunc::Path::StripExtension(scriptName); // .bv.luac has two extensions
+
+        AZStd::string fileName = AZStd::string::format("%s_%s", prefix, scriptName.c_str());
+        if (m_testSuiteRunConfig.m_shardCount > 1)
+        {
+            fileName += AZStd::string::format("_shard_%d_of_%d", m_testSuiteRunConfig.m_shardIndex, m_testSuiteRunConfig.m_shardCount);
+        }
+        fileName += extension;
+
+        return GetTestResultsFilePath(fileName);
+    }
+
+    void ScriptManager::FinishTestResultsExport()
+    {
+        m_scriptReporter.EndResultsStream();
+
+        bool exportJUnit = false;
+        if (auto settingsRegistry = AZ::SettingsRegistry::Get())
+        {
+            settingsRegistry->Get(exportJUnit, ExportJUnitSetting);
+        }
+
+        const AzFramework::CommandLine* commandLine = nullptr;
+        AzFramework::ApplicationRequests::Bus::BroadcastResult(commandLine, &AzFramework::ApplicationRequests::GetCommandLine);
+        if (commandLine && commandLine->HasSwitch(ExportJUnitSwitch))
+        {
+            exportJUnit = true;
+        }
+
+        if (exportJUnit)
+        {
+            m_scriptReporter.ExportJUnitXml(GetScriptRunFilePath("TestResults", m_runScriptFilePath, ".junit.xml"));
+        }
+    }
+
+    void ScriptManager::SaveDependencyIndex()
+    {
+        for (const ScriptReporter::ScriptReport& scriptReport : m_scriptReporter.GetScriptReport())
+        {
+            if (scriptReport.m_assertCount > 0 || scriptReport.m_generalErrorCount > 0 || scriptReport.m_screenshotErrorCount > 0)
+            {
+                m_dependencyIndex.ForgetScript(scriptReport.m_scriptAssetPath);
+            }
+        }
+
+        if (m_dependencyIndex.HasRecordedChanges())
+        {
+            m_dependencyIndex.Save();
+        }
     }
 
     void ScriptManager::AbortScripts(const AZStd::string& reason)
     {
         m_scriptReporter.SetInvalidationMessage(reason);
 
-        m_scriptOperations = {};
+        m_scriptOperations.clear();
+        m_upcomingSamples.clear();
         m_executingScripts.clear();
         m_scriptPaused = false;
         m_scriptIdleFrames = 0;
         m_scriptIdleSeconds = 0.0f;
         m_waitForAssetTracker = false;
+        m_waitCondition = WaitCondition::None;
+        if (m_profilingCaptureRecorder.IsCapturing())
+        {
+            m_profilingCaptureRecorder.Abort();
+            m_isCapturePending = false;
+        }
         while (m_scriptReporter.HasActiveScript())
         {
             m_scriptReporter.PopScript();
+            m_operationTrace.EndScript();
+        }
+
+        // Scripts that didn't get to finish haven't opened all of their samples
+        for (const AZStd::string& scriptFilePath : m_runningScripts)
+        {
+            m_dependencyIndex.ForgetScript(scriptFilePath);
         }
+        m_runningScripts.clear();
 
         m_doFinalScriptCleanup = true;
     }
@@ -895,20 +1304,24 @@ namespace AtomSampleViewer
     {
         ReportScriptableAction(AZStd::string::format("RunScript('%s')", scriptFilePath.c_str()));
 
-        // Save the window size so we can restore it after running the script, in case the script calls ResizeViewport
-        AzFramework::NativeWindowHandle defaultWindowHandle;
-        AzFramework::WindowSize windowSize;
-        AzFramework::WindowSystemRequestBus::BroadcastResult(defaultWindowHandle, &AzFramework::WindowSystemRequestBus::Events::GetDefaultWindowHandle);
-        AzFramework::WindowRequestBus::EventResult(windowSize, defaultWindowHandle, &AzFramework::WindowRequests::GetClientAreaSize);
-        m_savedViewportWidth = windowSize.m_width;
-        m_savedViewportHeight = windowSize.m_height;
-        if (m_savedViewportWidth == 0 || m_savedViewportHeight == 0)
+        // Save the window size so we can restore it after running the script, in case the script calls ResizeViewport.
+        // Headless runs may have no window, and ResizeViewport does nothing there anyway.
+        if (!Utils::IsHeadless())
         {
-            AZ_Assert(false, "Could not get current window size");
-        }
-        else
-        {
-            m_shouldRestoreViewportSize = true;
+            AzFramework::NativeWindowHandle defaultWindowHandle;
+            AzFramework::WindowSize windowSize;
+            AzFramework::WindowSystemRequestBus::BroadcastResult(defaultWindowHandle, &AzFramework::WindowSystemRequestBus::Events::GetDefaultWindowHandle);
+            AzFramework::WindowRequestBus::EventResult(windowSize, defaultWindowHandle, &AzFramework::WindowRequests::GetClientAreaSize);
+            m_savedViewportWidth = windowSize.m_width;
+            m_savedViewportHeight = windowSize.m_height;
+            if (m_savedViewportWidth == 0 || m_savedViewportHeight == 0)
+            {
+                AZ_Assert(false, "Could not get current window size");
+            }
+            else
+            {
+                m_shouldRestoreViewportSize = true;
+            }
         }
 
         // Setup the ScriptReporter to track and report the results
@@ -929,6 +1342,13 @@ namespace AtomSampleViewer
 
         AZ_Assert(m_executingScripts.empty(), "There should be no active scripts at this point");
 
+        m_operationTrace.Begin();
+        m_runningScripts.clear();
+
+        // Results are streamed as each script finishes, so they can be followed while a long run is still going
+        m_runScriptFilePath = scriptFilePath;
+        m_scriptReporter.BeginResultsStream(GetScriptRunFilePath("TestResults", scriptFilePath, ".jsonl"));
+
         ExecuteScript(scriptFilePath);
     }
 
@@ -960,6 +1380,9 @@ namespace AtomSampleViewer
         s_instance->m_scriptOperations.push([scriptFilePath]()
             {
                 GetInstance()->m_scriptReporter.PushScript(scriptFilePath);
+                GetInstance()->m_operationTrace.BeginScript(scriptFilePath);
+                GetInstance()->m_runningScripts.push_back(scriptFilePath);
+                GetInstance()->m_dependencyIndex.BeginScript(scriptFilePath);
             }
         );
 
@@ -1072,6 +1495,10 @@ namespace AtomSampleViewer
         behaviorContext->Method("Print", &Script_Print);
         behaviorContext->Method("IdleFrames", &Script_IdleFrames);
         behaviorContext->Method("IdleSeconds", &Script_IdleSeconds);
+        behaviorContext->Method("IdleUntilSampleAssetsLoaded", &Script_IdleUntilSampleAssetsLoaded);
+        behaviorContext->Method("IdleUntilAssetLoadsFinish", &Script_IdleUntilAssetLoadsFinish);
+        behaviorContext->Method("IdleUntilImageStreamingSettles", &Script_IdleUntilImageStreamingSettles);
+        behaviorContext->Method("IdleUntilFrameTimeStable", &Script_IdleUntilFrameTimeStable);
         behaviorContext->Method("LockFrameTime", &Script_LockFrameTime);
         behaviorContext->Method("UnlockFrameTime", &Script_UnlockFrameTime);
         behaviorContext->Method("ResizeViewport", &Script_ResizeViewport);
@@ -1083,10 +1510,21 @@ namespace AtomSampleViewer
         behaviorContext->Method("NormalizePath", &Script_NormalizePath);
         behaviorContext->Method("DegToRad", &Script_DegToRad);
         behaviorContext->Method("GetRenderApiName", &Script_GetRenderApiName);
+        behaviorContext->Method("IsHeadless", &Script_IsHeadless);
         behaviorContext->Method("GetRandomTestSeed", &Script_GetRandomTestSeed);
+        behaviorContext->Method("GetTestShardIndex", &Script_GetTestShardIndex);
+        behaviorContext->Method("GetTestShardCount", &Script_GetTestShardCount);
+        behaviorContext->Method("GetRecordedScriptDuration", &Script_GetRecordedScriptDuration);
+        behaviorContext->Method("BeginTestTimer", &Script_BeginTestTimer);
+        behaviorContext->Method("EndTestTimer", &Script_EndTestTimer);
+        behaviorContext->Method("ShouldRunOnlyAffectedTests", &Script_ShouldRunOnlyAffectedTests);
+        behaviorContext->Method("IsScriptAffected", &Script_IsScriptAffected);
+        behaviorContext->Method("IsSampleAffected", &Script_IsSampleAffected);
 
         // Samples...
         behaviorContext->Method("OpenSample", &Script_OpenSample);
+        behaviorContext->Method("PrefetchSample", &Script_PrefetchSample);
+        behaviorContext->Method("SetScenePoolingEnabled", &Script_SetScenePoolingEnabled);
         behaviorContext->Method("SetImguiValue", &Script_SetImguiValue);
 
         // Debug profilers...
@@ -1109,6 +1547,8 @@ namespace AtomSampleViewer
         behaviorContext->Method("CapturePassPipelineStatistics", &Script_CapturePassPipelineStatistics);
         behaviorContext->Method("CaptureCpuProfilingStatistics", &Script_CaptureCpuProfilingStatistics);
         behaviorContext->Method("CaptureBenchmarkMetadata", &Script_CaptureBenchmarkMetadata);
+        behaviorContext->Method("BeginProfilingCapture", &Script_BeginProfilingCapture);
+        behaviorContext->Method("CaptureSampleStatistics", &Script_CaptureSampleStatistics);
 
         // Camera...
         behaviorContext->Method("ArcBallCameraController_SetCenter", &Script_ArcBallCameraController_SetCenter);
@@ -1186,8 +1626,27 @@ namespace AtomSampleViewer
                 bool foundSample = false;
                 SampleComponentManagerRequestBus::BroadcastResult(foundSample, &SampleComponentManagerRequests::OpenSample, sampleName);
 
+                auto& upcomingSamples = GetInstance()->m_upcomingSamples;
+                if (!upcomingSamples.empty() && upcomingSamples.front() == sampleName)
+                {
+                    upcomingSamples.pop_front();
+                }
+
                 if (foundSample)
                 {
+                    // The sample is a dependency of the script that opened it and of every script that ran that one
+                    for (const AZStd::string& scriptFilePath : GetInstance()->m_runningScripts)
+                    {
+                        GetInstance()->m_dependencyIndex.RecordScriptSample(scriptFilePath, sampleName);
+                    }
+
+                    // While this sample loads and runs, start loading the assets of the one the script opens next. This is opt-in,
+                    // the extra loads would skew captures and keep the IdleUntil* functions waiting on another sample's assets.
+                    if (GetInstance()->m_prefetchUpcomingSamples && !upcomingSamples.empty())
+                    {
+                        SampleComponentManagerRequestBus::Broadcast(&SampleComponentManagerRequests::PrefetchSample, upcomingSamples.front());
+                    }
+
                     // Samples need a few frames to initialize before consuming actions from ScriptableImGui,
                     // so we need to wait before letting the script schedule ScriptableImGui actions.
                     // They need 1 frame to activate, 1 frame to start ticking, and 1 frame to guarantee
@@ -1199,6 +1658,35 @@ namespace AtomSampleViewer
             }
         };
 
+        // Scripts queue all their operations before any of them run, so the order samples will open in is known now
+        if (!sampleName.empty())
+        {
+            GetInstance()->m_upcomingSamples.push_back(sampleName);
+        }
+
+        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+    }
+
+    void ScriptManager::Script_PrefetchSample(const AZStd::string& sampleName)
+    {
+        auto operation = [sampleName]()
+        {
+            bool isPrefetching = false;
+            SampleComponentManagerRequestBus::BroadcastResult(isPrefetching, &SampleComponentManagerRequests::PrefetchSample, sampleName);
+            AZ_TracePrintf("Automation", "PrefetchSample('%s'): %s\n", sampleName.c_str(),
+                isPrefetching ? "prefetching" : "prefetching is disabled or the sample's assets aren't known yet");
+        };
+
+        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+    }
+
+    void ScriptManager::Script_SetScenePoolingEnabled(bool enabled)
+    {
+        auto operation = [enabled]()
+        {
+            SampleComponentManagerRequestBus::Broadcast(&SampleComponentManagerRequests::SetScenePoolingEnabled, enabled);
+        };
+
         GetInstance()->m_scriptOperations.push(AZStd::move(operation));
     }
 
@@ -1243,6 +1731,53 @@ namespace AtomSampleViewer
         GetInstance()->m_scriptOperations.push(AZStd::move(operation));
     }
 
+    void ScriptManager::Script_IdleUntilSampleAssetsLoaded(float timeout)
+    {
+        auto operation = [timeout]()
+        {
+            GetInstance()->BeginWaitCondition(WaitCondition::SampleAssetsLoaded, timeout);
+        };
+
+        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+    }
+
+    void ScriptManager::Script_IdleUntilAssetLoadsFinish(float timeout)
+    {
+        auto operation = [timeout]()
+        {
+            GetInstance()->BeginWaitCondition(WaitCondition::AssetLoadsFinished, timeout);
+        };
+
+        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+    }
+
+    void ScriptManager::Script_IdleUntilImageStreamingSettles(float timeout)
+    {
+        auto operation = [timeout]()
+        {
+            GetInstance()->BeginWaitCondition(WaitCondition::ImageStreamingSettled, timeout);
+        };
+
+        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+    }
+
+    void ScriptManager::Script_IdleUntilFrameTimeStable(float tolerancePercent, int windowFrames, float timeout)
+    {
+        auto operation = [tolerancePercent, windowFrames, timeout]()
+        {
+            if (windowFrames <= 0)
+            {
+                ReportScriptError(AZStd::string::format("IdleUntilFrameTimeStable needs a window of at least one frame, got %d", windowFrames));
+                return;
+            }
+
+            GetInstance()->m_frameTimeWindow.Reset(windowFrames, tolerancePercent / 100.0f);
+            GetInstance()->BeginWaitCondition(WaitCondition::FrameTimeStable, timeout);
+        };
+
+        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+    }
+
     void ScriptManager::Script_LockFrameTime(float seconds)
     {
         auto operation = [seconds]()
@@ -1355,7 +1890,11 @@ namespace AtomSampleViewer
     {
         auto operation = [width,height]()
         {
-            if (Utils::SupportsResizeClientArea())
+            if (Utils::IsHeadless())
+            {
+                AZ_TracePrintf("Automation", "Headless: ignoring ResizeViewport(%d, %d)\n", width, height);
+            }
+            else if (Utils::SupportsResizeClientArea())
             {
                 AzFramework::WindowPosOptions options;
                 options.m_ignoreScreenSizeLimit = true;
@@ -1431,6 +1970,13 @@ namespace AtomSampleViewer
         ScriptManager* s_instance = GetInstance();
         s_instance->m_scriptReporter.AddScreenshotTest(imageName);
 
+        if (Utils::IsHeadless())
+        {
+            // The screenshot still shows up in the report so headless and rendering runs list the same tests
+            s_instance->m_scriptReporter.SkipLatestScreenshot("headless");
+            return false;
+        }
+
         s_instance->m_isCapturePending = true;
         s_instance->PauseScript();
 
@@ -1839,13 +2385,60 @@ namespace AtomSampleViewer
         ResumeScript();
     }
 
-    void ScriptManager::OnCaptureBenchmarkMetadataFinished([[maybe_unused]] bool result, [[maybe_unused]] const AZStd::string& info)
+    void ScriptManager::OnCaptureBenchmarkMetadataFinished(bool result, [[maybe_unused]] const AZStd::string& info)
     {
+        if (result && m_sceneComposition.m_isValid)
+        {
+            AddSceneCompositionToBenchmarkMetadata(m_benchmarkMetadataFilePath);
+        }
+        m_benchmarkMetadataFilePath.clear();
+
         m_isCapturePending = false;
         AZ::Render::ProfilingCaptureNotificationBus::Handler::BusDisconnect();
         ResumeScript();
     }
 
+    void ScriptManager::AddSceneCompositionToBenchmarkMetadata(const AZStd::string& outputFilePath)
+    {
+        char resolvedPath[AZ::IO::MaxPathLength] = {0};
+        if (!AZ::IO::FileIOBase::GetInstance()->ResolvePath(outputFilePath.c_str(), resolvedPath, AZ::IO::MaxPathLength))
+        {
+            ReportScriptWarning(AZStd::string::format("Could not resolve benchmark metadata path '%s'.", outputFilePath.c_str()));
+            return;
+        }
+
+        auto readResult = AZ::JsonSerializationUtils::ReadJsonFile(resolvedPath);
+        if (!readResult.IsSuccess() || !readResult.GetValue().IsObject())
+        {
+            ReportScriptWarning(AZStd::string::format("Could not add the scene composition to '%s'.", resolvedPath));
+            return;
+        }
+
+        rapidjson::Document document = readResult.TakeValue();
+
+        // The metadata fields live under ClassData when the file was written by the json serializer
+        rapidjson::Value* metadata = &document;
+        if (auto classData = document.FindMember("ClassData"); classData != document.MemberEnd() && classData->value.IsObject())
+        {
+            metadata = &classData->value;
+        }
+
+        // The hash is written as a hex string because json readers commonly store numbers as doubles
+        const AZStd::string compositionHash = AZStd::string::format("%016llx", static_cast<unsigned long long>(m_sceneComposition.m_compositionHash));
+
+        auto& allocator = document.GetAllocator();
+        metadata->RemoveMember("randomSeed");
+        metadata->RemoveMember("sceneCompositionHash");
+        metadata->AddMember("randomSeed", rapidjson::Value(static_cast<uint64_t>(m_sceneComposition.m_randomSeed)), allocator);
+        metadata->AddMember("sceneCompositionHash", rapidjson::Value(compositionHash.c_str(), allocator), allocator);
+
+        auto writeResult = AZ::JsonSerializationUtils::WriteJsonFile(document, resolvedPath);
+        if (!writeResult.IsSuccess())
+        {
+            ReportScriptWarning(AZStd::string::format("Could not write the scene composition to '%s': %s", resolvedPath, writeResult.GetError().c_str()));
+        }
+    }
+
     void ScriptManager::Script_CapturePassTimestamp(AZ::ScriptDataContext& dc)
     {
         AZStd::string outputFilePath;
@@ -1857,6 +2450,13 @@ namespace AtomSampleViewer
 
         auto operation = [outputFilePath]()
         {
+            // Timestamp queries never complete on the null RHI
+            if (Utils::IsHeadless())
+            {
+                AZ_TracePrintf("Automation", "Headless: skipping pass timestamp capture '%s'\n", outputFilePath.c_str());
+                return;
+            }
+
             GetInstance()->m_isCapturePending = true;
             GetInstance()->AZ::Render::ProfilingCaptureNotificationBus::Handler::BusConnect();
             GetInstance()->PauseScript();
@@ -1899,6 +2499,13 @@ namespace AtomSampleViewer
 
         auto operation = [outputFilePath]()
         {
+            // Pipeline statistics queries never complete on the null RHI
+            if (Utils::IsHeadless())
+            {
+                AZ_TracePrintf("Automation", "Headless: skipping pipeline statistics capture '%s'\n", outputFilePath.c_str());
+                return;
+            }
+
             GetInstance()->m_isCapturePending = true;
             GetInstance()->AZ::Render::ProfilingCaptureNotificationBus::Handler::BusConnect();
             GetInstance()->PauseScript();
@@ -1959,6 +2566,7 @@ namespace AtomSampleViewer
         auto operation = [benchmarkName, outputFilePath]()
         {
             GetInstance()->m_isCapturePending = true;
+            GetInstance()->m_benchmarkMetadataFilePath = outputFilePath;
             GetInstance()->AZ::Render::ProfilingCaptureNotificationBus::Handler::BusConnect();
             GetInstance()->PauseScript();
 
@@ -1968,6 +2576,69 @@ namespace AtomSampleViewer
         GetInstance()->m_scriptOperations.push(AZStd::move(operation));
     }
 
+    void ScriptManager::Script_BeginProfilingCapture(const AZStd::string& outputFilePath, int frameCount)
+    {
+        if (frameCount <= 0)
+        {
+            Script_Error(AZStd::string::format("BeginProfilingCapture needs a positive frame count, got %d.", frameCount));
+            return;
+        }
+
+        auto operation = [outputFilePath, frameCount]()
+        {
+            ScriptManager* s_instance = GetInstance();
+            if (s_instance->m_profilingCaptureRecorder.Begin(outputFilePath, aznumeric_cast<uint32_t>(frameCount)))
+            {
+                s_instance->m_isCapturePending = true;
+
+                // Allow plenty of time per frame since benchmark samples can run at very low frame rates
+                s_instance->PauseScriptWithTimeout(DefaultPauseTimeout + aznumeric_cast<float>(frameCount));
+            }
+        };
+
+        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+    }
+
+    void ScriptManager::Script_CaptureSampleStatistics(const AZStd::string& outputFilePath)
+    {
+        auto operation = [outputFilePath]()
+        {
+            const auto& statistics = GetInstance()->m_sampleStatistics;
+            if (statistics.empty())
+            {
+                ReportScriptWarning(AZStd::string::format("CaptureSampleStatistics: the active sample doesn't publish any statistics, '%s' was not written.", outputFilePath.c_str()));
+                return;
+            }
+
+            char resolvedPath[AZ::IO::MaxPathLength] = {0};
+            if (!AZ::IO::FileIOBase::GetInstance()->ResolvePath(outputFilePath.c_str(), resolvedPath, AZ::IO::MaxPathLength))
+            {
+                ReportScriptError(AZStd::string::format("Could not resolve sample statistics path '%s'.", outputFilePath.c_str()));
+                return;
+            }
+
+            rapidjson::Document document;
+            document.SetObject();
+            auto& allocator = document.GetAllocator();
+            for (const auto& [name, value] : statistics)
+            {
+                document.AddMember(rapidjson::Value(name.c_str(), allocator), rapidjson::Value(value), allocator);
+            }
+
+            AZStd::string folderPath;
+            AzFramework::StringFunc::Path::GetFolderPath(resolvedPath, folderPath);
+            AZ::IO::LocalFileIO::GetInstance()->CreatePath(folderPath.c_str());
+
+            auto writeResult = AZ::JsonSerializationUtils::WriteJsonFile(document, resolvedPath);
+            if (!writeResult.IsSuccess())
+            {
+                ReportScriptError(AZStd::string::format("Could not write sample statistics to '%s': %s", resolvedPath, writeResult.GetError().c_str()));
+            }
+        };
+
+        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+    }
+
     bool ScriptManager::ValidateProfilingCaptureScripContexts(AZ::ScriptDataContext& dc, AZStd::string& outputFilePath)
     {
         if (dc.GetNumArguments() != 1)
@@ -2000,6 +2671,11 @@ namespace AtomSampleViewer
         return AZ::DegToRad(degrees);
     }
 
+    bool ScriptManager::Script_IsHeadless()
+    {
+        return Utils::IsHeadless();
+    }
+
     AZStd::string ScriptManager::Script_GetRenderApiName()
     {
         AZ::RPI::RPISystemInterface* rpiSystem = AZ::RPI::RPISystemInterface::Get();
@@ -2012,6 +2688,81 @@ namespace AtomSampleViewer
         return GetInstance()->m_testSuiteRunConfig.m_randomSeed;
     }
 
+    int ScriptManager::Script_GetTestShardIndex()
+    {
+        return GetInstance()->m_testSuiteRunConfig.m_shardIndex;
+    }
+
+    int ScriptManager::Script_GetTestShardCount()
+    {
+        return GetInstance()->m_testSuiteRunConfig.m_shardCount;
+    }
+
+    float ScriptManager::Script_GetRecordedScriptDuration(const AZStd::string& scriptFilePath)
+    {
+        const auto& durations = GetInstance()->m_recordedScriptDurations;
+        auto iter = durations.find(scriptFilePath);
+        return iter != durations.end() ? iter->second : 0.0f;
+    }
+
+    void ScriptManager::Script_BeginTestTimer(const AZStd::string& testName)
+    {
+        auto operation = [testName]()
+        {
+            GetInstance()->m_testTimerStarts[testName] = AZStd::chrono::steady_clock::now();
+        };
+
+        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+    }
+
+    void ScriptManager::Script_EndTestTimer(const AZStd::string& testName)
+    {
+        auto operation = [testName]()
+        {
+            auto& timerStarts = GetInstance()->m_testTimerStarts;
+            auto timerIter = timerStarts.find(testName);
+            if (timerIter == timerStarts.end())
+            {
+                AZ_Error("Automation", false, "EndTestTimer('%s') was called without BeginTestTimer()", testName.c_str());
+                return;
+            }
+
+            const double seconds = AZStd::chrono::duration<double>(AZStd::chrono::steady_clock::now() - timerIter->second).count();
+            GetInstance()->m_scriptReporter.RecordTestDuration(testName, seconds);
+            timerStarts.erase(timerIter);
+        };
+
+        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+    }
+
+    bool ScriptManager::Script_ShouldRunOnlyAffectedTests()
+    {
+        bool runOnlyAffectedTests = false;
+        if (auto settingsRegistry = AZ::SettingsRegistry::Get())
+        {
+            settingsRegistry->Get(runOnlyAffectedTests, RunOnlyAffectedTestsSetting);
+        }
+
+        const AzFramework::CommandLine* commandLine = nullptr;
+        AzFramework::ApplicationRequests::Bus::BroadcastResult(commandLine, &AzFramework::ApplicationRequests::GetCommandLine);
+        if (commandLine && commandLine->HasSwitch(RunOnlyAffectedTestsSwitch))
+        {
+            runOnlyAffectedTests = true;
+        }
+
+        return runOnlyAffectedTests;
+    }
+
+    bool ScriptManager::Script_IsScriptAffected(const AZStd::string& scriptFilePath)
+    {
+        return GetInstance()->m_dependencyIndex.IsScriptAffected(scriptFilePath);
+    }
+
+    bool ScriptManager::Script_IsSampleAffected(const AZStd::string& sampleName)
+    {
+        return GetInstance()->m_dependencyIndex.IsSampleAffected(sampleName);
+    }
+
     void ScriptManager::CheckArcBallControllerHandler()
     {
         if (0 == AZ::Debug::ArcBallControllerRequestBus::GetNumOfEventHandlers(GetInstance()->m_cameraEntity->GetId()))
@@ -12,13 +12,19 @@
 #include <Atom/Feature/Utils/FrameCaptureBus.h>
 #include <Atom/Feature/Utils/ProfilingCaptureBus.h>
 #include <Automation/PrecommitWizardSettings.h>
+#include <Automation/ProfilingCaptureRecorder.h>
+#include <Automation/ScriptDependencyIndex.h>
+#include <Automation/ScriptOperationTrace.h>
 #include <Automation/ScriptRepeaterBus.h>
 #include <Automation/ScriptRunnerBus.h>
 #include <Automation/AssetStatusTracker.h>
 #include <Automation/ScriptReporter.h>
 #include <Automation/ImageComparisonConfig.h>
+#include <Utils/FrameTimeStabilityWindow.h>
 #include <Utils/ImGuiAssetBrowser.h>
 #include <AzCore/Debug/ProfilerBus.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/map.h>
 
 namespace AZ
 {
@@ -67,13 +73,40 @@ namespace AtomSampleViewer
         void OpenScriptRunnerDialog();
         void OpenPrecommitWizard();
 
-        void RunMainTestSuite(const AZStd::string& suiteFilePath, bool exitOnTestEnd, int randomSeed);
+        void RunMainTestSuite(const AZStd::string& suiteFilePath, bool exitOnTestEnd, int randomSeed, int shardIndex, int shardCount);
+
+        //! Records the assets the active sample preloaded as dependencies of the scripts that opened it, see ScriptDependencyIndex
+        void RecordSampleAssets(const AZStd::string& sampleName, const AZStd::vector<AZStd::string>& assetPaths);
 
         static ScriptManager* GetInstance();
 
     private:
         static constexpr const char* FullSuiteScriptFilepath = "scripts/_fulltestsuite_.bv.luac";
 
+        //! Run time of each script in the last full run of the main test suite, in TestResults. Used to balance test suite shards.
+        //! When the suite runs in shards, each shard exports its results instead and the merge step rewrites this file.
+        static constexpr const char* ScriptDurationsFileName = "ScriptDurations.json";
+
+        //! Set to true, or pass --junit, to also export a JUnit XML report of each script run to TestResults
+        static constexpr const char* ExportJUnitSetting = "/O3DE/AtomSampleViewer/ExportJUnitResults";
+        static constexpr const char* ExportJUnitSwitch = "junit";
+
+        //! Set to true, or pass --onlychanged, to have the test suite skip the scripts whose dependencies haven't changed since they last ran
+        static constexpr const char* RunOnlyAffectedTestsSetting = "/O3DE/AtomSampleViewer/RunOnlyAffectedTests";
+        static constexpr const char* RunOnlyAffectedTestsSwitch = "onlychanged";
+
+        static AZStd::string GetTestResultsFilePath(const AZStd::string& fileName);
+
+        //! Returns the path in TestResults of a file written for a script run, e.g. "<prefix>_<script name>[_shard_i_of_N]<extension>"
+        AZStd::string GetScriptRunFilePath(const char* prefix, const AZStd::string& scriptFilePath, const char* extension) const;
+        //! Returns the path in TestResults of the results this test suite shard exports for the merge step
+        AZStd::string GetShardResultsFilePath() const;
+        void LoadRecordedScriptDurations();
+        void SaveRecordedScriptDurations();
+
+        //! Saves what later runs need from a finished automated test suite run
+        void RecordTestSuiteResults();
+
         void ShowScriptRunnerDialog();
 
         // PrecommitWizard Gui
@@ -102,6 +135,10 @@ namespace AtomSampleViewer
         static void Script_Print(const AZStd::string& message);
         static void Script_IdleFrames(int numFrames);
         static void Script_IdleSeconds(float numSeconds);
+        static void Script_IdleUntilSampleAssetsLoaded(float timeout);
+        static void Script_IdleUntilAssetLoadsFinish(float timeout);
+        static void Script_IdleUntilImageStreamingSettles(float timeout);
+        static void Script_IdleUntilFrameTimeStable(float tolerancePercent, int windowFrames, float timeout);
         static void Script_LockFrameTime(float seconds);
         static void Script_UnlockFrameTime();
         static void Script_ResizeViewport(int width, int height);
@@ -115,10 +152,21 @@ namespace AtomSampleViewer
         static AZStd::string Script_NormalizePath(const AZStd::string& path);
         static float Script_DegToRad(float degrees);
         static AZStd::string Script_GetRenderApiName();
+        static bool Script_IsHeadless();
         static int Script_GetRandomTestSeed();
+        static int Script_GetTestShardIndex();
+        static int Script_GetTestShardCount();
+        static float Script_GetRecordedScriptDuration(const AZStd::string& scriptFilePath);
+        static void Script_BeginTestTimer(const AZStd::string& testName);
+        static void Script_EndTestTimer(const AZStd::string& testName);
+        static bool Script_ShouldRunOnlyAffectedTests();
+        static bool Script_IsScriptAffected(const AZStd::string& scriptFilePath);
+        static bool Script_IsSampleAffected(const AZStd::string& sampleName);
 
         // Samples...
         static void Script_OpenSample(const AZStd::string& sampleName);
+        static void Script_PrefetchSample(const AZStd::string& sampleName);
+        static void Script_SetScenePoolingEnabled(bool enabled);
         static void Script_SetImguiValue(AZ::ScriptDataContext& dc);
 
         // Debug tools...
@@ -166,6 +214,13 @@ namespace AtomSampleViewer
         static void Script_CaptureCpuProfilingStatistics(AZ::ScriptDataContext& dc);
         static void Script_CaptureBenchmarkMetadata(AZ::ScriptDataContext& dc);
 
+        // Records pass timestamps and CPU frame times for the next frameCount frames and writes them all to a single
+        // columnar file (see ProfilingCaptureRecorder). The script is paused until the file has been written.
+        static void Script_BeginProfilingCapture(const AZStd::string& outputFilePath, int frameCount);
+
+        // Writes the statistics the active sample currently publishes through ScriptRunnerRequestBus to a json file
+        static void Script_CaptureSampleStatistics(const AZStd::string& outputFilePath);
+
         // Camera...
         static void Script_ArcBallCameraController_SetCenter(AZ::Vector3 center);
         static void Script_ArcBallCameraController_SetPan(AZ::Vector3 pan);
@@ -211,6 +266,31 @@ namespace AtomSampleViewer
         void PauseScript() override;
         void PauseScriptWithTimeout(float timeout) override;
         void ResumeScript() override;
+        int GetRandomTestSeed() override;
+        void SetSceneComposition(AZ::u64 randomSeed, AZ::u64 compositionHash) override;
+        void ClearSceneComposition() override;
+        void SetSampleStatistic(const AZStd::string& name, double value) override;
+        void ClearSampleStatistics() override;
+        void SetPendingSampleAssetCount(uint32_t pendingAssetCount) override;
+
+        //! Engine conditions a script can wait on, instead of idling for a fixed number of frames that is either
+        //! too short on a slow machine or wasted time on a fast one. See the Script_IdleUntil* functions.
+        enum class WaitCondition
+        {
+            None,
+            SampleAssetsLoaded,     //!< The active sample's PreloadAssets() list has finished loading
+            AssetLoadsFinished,     //!< The AssetManager has no load jobs in flight, which includes shader variants and streamed mips
+            ImageStreamingSettled,  //!< Resident memory of the streaming image pool stopped changing, and no asset loads are in flight
+            FrameTimeStable         //!< Frame times over a window are all within a tolerance of their mean
+        };
+
+        //! Starts waiting on a condition; TickScript() won't run further operations until it is met or the timeout expires
+        void BeginWaitCondition(WaitCondition condition, float timeout);
+
+        //! Checks the current wait condition for this frame. Returns true when the script can continue.
+        bool UpdateWaitCondition(float deltaTime, float frameTime);
+
+        static const char* GetWaitConditionName(WaitCondition condition);
 
         // Execute a lua script. Each function call in the script will call one of the above Script_ functions,
         // which will push operations onto the m_scriptOperations queue for deferred execution in TickScript().
@@ -244,6 +324,18 @@ namespace AtomSampleViewer
 
         static bool PrepareForScreenCapture(const AZStd::string& imageName);
 
+        // Writes m_operationTrace for the script run that just finished
+        void WriteOperationTrace();
+
+        // Closes the streamed results of the script run that just finished and exports the JUnit report, if enabled
+        void FinishTestResultsExport();
+
+        // Saves m_dependencyIndex for the script run that just finished. Scripts that reported errors aren't considered up to date.
+        void SaveDependencyIndex();
+
+        // Adds the scene composition reported by the active sample to a benchmark metadata file written by CaptureBenchmarkMetadata()
+        void AddSceneCompositionToBenchmarkMetadata(const AZStd::string& outputFilePath);
+
         // show/hide imgui
         void SetShowImGui(bool show);
 
@@ -254,6 +346,8 @@ namespace AtomSampleViewer
             bool m_closeOnTestScriptFinish = false;
             AZStd::string m_testSuitePath;
             int m_randomSeed = 0; // Used to shuffle test order in a random manner
+            int m_shardIndex = 0; // Which part of the suite this process runs, see --shard
+            int m_shardCount = 1;
         };
 
         TestSuiteExecutionConfig m_testSuiteRunConfig;
@@ -269,6 +363,20 @@ namespace AtomSampleViewer
         float m_assetTrackingTimeout = 0.0f;
         AssetStatusTracker m_assetStatusTracker;
 
+        // Consecutive frames a condition has to hold, since asset loads and mip expansion can pause for a frame between steps
+        static constexpr int AssetLoadsSettleFrames = 5;
+        static constexpr int ImageStreamingSettleFrames = 30;
+
+        WaitCondition m_waitCondition = WaitCondition::None;
+        float m_waitConditionTimeout = 0.0f;
+        int m_waitConditionSettledFrames = 0;
+        size_t m_lastStreamingResidentBytes = 0;
+        FrameTimeStabilityWindow m_frameTimeWindow;
+        uint32_t m_pendingSampleAssetCount = 0; //!< Reported by the active sample through ScriptRunnerRequestBus
+        AZStd::chrono::steady_clock::time_point m_lastTickTime; //!< For real frame times, which LockFrameTime() doesn't affect
+
+        ProfilingCaptureRecorder m_profilingCaptureRecorder;
+
         AZStd::unique_ptr<AZ::ScriptContext> m_scriptContext; //< Provides the lua scripting system
         AZStd::unique_ptr<AZ::BehaviorContext> m_sriptBehaviorContext; //< Used to bind script callback functions to lua
 
@@ -281,13 +389,45 @@ namespace AtomSampleViewer
         ImGuiMessageBox m_messageBox;
 
         using ScriptOp = AZStd::function<void()>;
-        AZStd::queue<ScriptOp> m_scriptOperations;
+
+        //! Queue of deferred script operations. Each operation is registered with m_operationTrace as it is pushed,
+        //! which is when the Lua stack still shows where it came from.
+        class ScriptOperationQueue
+        {
+        public:
+            void push(ScriptOp operation);
+            void pop() { m_operations.pop(); }
+            void clear() { m_operations = {}; }
+            ScriptOp& front() { return m_operations.front().m_operation; }
+            uint32_t GetFrontTraceIndex() const { return m_operations.front().m_traceIndex; }
+            bool empty() const { return m_operations.empty(); }
+            size_t size() const { return m_operations.size(); }
+
+        private:
+            struct QueuedOperation
+            {
+                ScriptOp m_operation;
+                uint32_t m_traceIndex = ScriptOperationTrace::InvalidIndex;
+            };
+
+            AZStd::queue<QueuedOperation> m_operations;
+        };
+
+        ScriptOperationQueue m_scriptOperations;
+        ScriptOperationTrace m_operationTrace; //< Times every operation of the current script run, see WriteOperationTrace()
+        AZStd::string m_runScriptFilePath; //< The script that started the current script run
+        ScriptDependencyIndex m_dependencyIndex;
+        AZStd::vector<AZStd::string> m_runningScripts; //< The scripts whose operations are currently being processed, outermost first
         bool m_doFinalScriptCleanup = false;
 
         ImGuiAssetBrowser m_scriptBrowser;
 
         AZStd::unordered_set<AZ::Data::AssetId> m_executingScripts; //< Tracks which lua scripts are currently being executed. Used to prevent infinite recursion.
         bool m_shouldPopScript = false; //< Tracks when an executing script just finished so we know when to call ScriptReporter::PopScript().
+        AZStd::deque<AZStd::string> m_upcomingSamples; //< Samples queued by OpenSample() that haven't opened yet, in order, so the next one can be prefetched
+        bool m_prefetchUpcomingSamples = false; //< Whether OpenSample() prefetches the next sample, see SampleAssetPrefetcher::LookAheadSetting
+        AZStd::unordered_map<AZStd::string, float> m_recordedScriptDurations; //< Seconds per script path, from ScriptDurationsFileName
+        AZStd::unordered_map<AZStd::string, AZStd::chrono::steady_clock::time_point> m_testTimerStarts; //< See Script_BeginTestTimer()
         ScriptReporter m_scriptReporter;
 
         // Manages the available ImageComparisonToleranceLevels and override options
@@ -352,6 +492,17 @@ namespace AtomSampleViewer
         bool m_isCapturePending = false;
         bool m_frameTimeIsLocked = false;
 
+        struct SceneComposition
+        {
+            bool m_isValid = false;
+            AZ::u64 m_randomSeed = 0;
+            AZ::u64 m_compositionHash = 0;
+        };
+
+        SceneComposition m_sceneComposition; //!< Reported by the active sample through ScriptRunnerRequestBus
+        AZStd::string m_benchmarkMetadataFilePath; //!< Output file of the pending CaptureBenchmarkMetadata()
+        AZStd::map<AZStd::string, double> m_sampleStatistics; //!< Published by the active sample through ScriptRunnerRequestBus
+
         bool m_prevShowImGui = true;
         bool m_showImGui = true;
     };
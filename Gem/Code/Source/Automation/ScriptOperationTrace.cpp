@@ -0,0 +1,309 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Automation/ScriptOperationTrace.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Script/lua/lua.h>
+#include <AzCore/Serialization/Json/JsonUtils.h>
+
+namespace AtomSampleViewer
+{
+    namespace
+    {
+        // Must match ScriptOperationTrace::WaitReason
+        static const char* WaitReasonNames[] =
+        {
+            "IdleFrames", "IdleSeconds", "Pause", "Capture", "AssetTracker", "Condition", "ScriptBoundary",
+        };
+
+        static_assert(AZ_ARRAY_SIZE(WaitReasonNames) == static_cast<size_t>(ScriptOperationTrace::WaitReason::Count),
+            "WaitReasonNames must match ScriptOperationTrace::WaitReason");
+
+        static constexpr int ScriptTrackId = 1;
+        static constexpr int OperationTrackId = 2;
+
+        bool IsSet(AZStd::chrono::steady_clock::time_point time)
+        {
+            return time != AZStd::chrono::steady_clock::time_point{};
+        }
+
+        double ToMilliseconds(AZStd::chrono::steady_clock::duration duration)
+        {
+            return AZStd::chrono::duration<double, AZStd::milli>(duration).count();
+        }
+    }
+
+    void ScriptOperationTrace::Begin()
+    {
+        m_operations.clear();
+        m_scriptSpans.clear();
+        m_openScriptSpans.clear();
+        m_strings.clear();
+        m_stringIndices.clear();
+        m_lastCompletedIndex = InvalidIndex;
+
+        // Index 0 is used for operations queued from C++, which have neither a Lua caller nor a source
+        InternString("Native");
+
+        m_isRecording = true;
+        m_beginTime = AZStd::chrono::steady_clock::now();
+        m_endTime = {};
+    }
+
+    void ScriptOperationTrace::End()
+    {
+        if (!m_isRecording)
+        {
+            return;
+        }
+
+        m_endTime = AZStd::chrono::steady_clock::now();
+        ReleaseLastCompleted(m_endTime);
+
+        while (!m_openScriptSpans.empty())
+        {
+            EndScript();
+        }
+
+        m_isRecording = false;
+    }
+
+    uint32_t ScriptOperationTrace::InternString(AZStd::string_view string)
+    {
+        auto [iter, inserted] = m_stringIndices.emplace(string, aznumeric_cast<uint32_t>(m_strings.size()));
+        if (inserted)
+        {
+            m_strings.emplace_back(string);
+        }
+        return iter->second;
+    }
+
+    void ScriptOperationTrace::ReleaseLastCompleted(AZStd::chrono::steady_clock::time_point time)
+    {
+        if (m_lastCompletedIndex != InvalidIndex && !IsSet(m_operations[m_lastCompletedIndex].m_endTime))
+        {
+            m_operations[m_lastCompletedIndex].m_endTime = time;
+        }
+    }
+
+    uint32_t ScriptOperationTrace::RecordEnqueue(lua_State* luaState)
+    {
+        if (!m_isRecording)
+        {
+            return InvalidIndex;
+        }
+
+        const uint32_t operationIndex = aznumeric_cast<uint32_t>(m_operations.size());
+        Operation& operation = m_operations.emplace_back();
+        operation.m_enqueueTime = AZStd::chrono::steady_clock::now();
+
+        lua_Debug debugInfo;
+        if (luaState && lua_getstack(luaState, 0, &debugInfo))
+        {
+            // Level 0 is the bound Script_ function that is queuing the operation, named as the script called it
+            if (lua_getinfo(luaState, "n", &debugInfo) && debugInfo.name)
+            {
+                operation.m_kindIndex = InternString(debugInfo.name);
+            }
+
+            // The first level up with a line number is the script code that made the call
+            for (int level = 1; lua_getstack(luaState, level, &debugInfo); ++level)
+            {
+                if (lua_getinfo(luaState, "Sl", &debugInfo) && debugInfo.currentline >= 0)
+                {
+                    AZStd::string_view source = debugInfo.source ? debugInfo.source : "";
+                    if (source.starts_with('@') || source.starts_with('='))
+                    {
+                        source.remove_prefix(1);
+                    }
+
+                    operation.m_sourceIndex = InternString(source);
+                    operation.m_line = debugInfo.currentline;
+                    break;
+                }
+            }
+        }
+
+        return operationIndex;
+    }
+
+    void ScriptOperationTrace::RecordDispatch(uint32_t operationIndex)
+    {
+        if (!m_isRecording || operationIndex >= m_operations.size())
+        {
+            return;
+        }
+
+        const auto now = AZStd::chrono::steady_clock::now();
+        ReleaseLastCompleted(now);
+        m_operations[operationIndex].m_dispatchTime = now;
+    }
+
+    void ScriptOperationTrace::RecordComplete(uint32_t operationIndex)
+    {
+        if (!m_isRecording || operationIndex >= m_operations.size())
+        {
+            return;
+        }
+
+        m_operations[operationIndex].m_completeTime = AZStd::chrono::steady_clock::now();
+        m_lastCompletedIndex = operationIndex;
+    }
+
+    void ScriptOperationTrace::RecordWait(WaitReason reason)
+    {
+        if (!m_isRecording || m_lastCompletedIndex == InvalidIndex)
+        {
+            return;
+        }
+
+        ++m_operations[m_lastCompletedIndex].m_waitFrames[static_cast<size_t>(reason)];
+    }
+
+    void ScriptOperationTrace::BeginScript(const AZStd::string& scriptFilePath)
+    {
+        if (!m_isRecording)
+        {
+            return;
+        }
+
+        m_openScriptSpans.push_back(aznumeric_cast<uint32_t>(m_scriptSpans.size()));
+
+        ScriptSpan& span = m_scriptSpans.emplace_back();
+        span.m_nameIndex = InternString(scriptFilePath);
+        span.m_depth = aznumeric_cast<uint32_t>(m_openScriptSpans.size() - 1);
+        span.m_beginTime = AZStd::chrono::steady_clock::now();
+    }
+
+    void ScriptOperationTrace::EndScript()
+    {
+        if (m_openScriptSpans.empty())
+        {
+            return;
+        }
+
+        m_scriptSpans[m_openScriptSpans.back()].m_endTime = IsSet(m_endTime) ? m_endTime : AZStd::chrono::steady_clock::now();
+        m_openScriptSpans.pop_back();
+    }
+
+    bool ScriptOperationTrace::WriteChromeTrace(const AZStd::string& filePath) const
+    {
+        rapidjson::Document document;
+        document.SetObject();
+        auto& allocator = document.GetAllocator();
+
+        // Chrome traces count in microseconds
+        auto toTraceTime = [this](AZStd::chrono::steady_clock::time_point time)
+        {
+            return AZStd::chrono::duration<double, AZStd::micro>(time - m_beginTime).count();
+        };
+
+        rapidjson::Value events(rapidjson::kArrayType);
+
+        auto addTrackName = [&](int trackId, const char* name)
+        {
+            rapidjson::Value event(rapidjson::kObjectType);
+            event.AddMember("name", "thread_name", allocator);
+            event.AddMember("ph", "M", allocator);
+            event.AddMember("pid", 1, allocator);
+            event.AddMember("tid", trackId, allocator);
+            rapidjson::Value args(rapidjson::kObjectType);
+            args.AddMember("name", rapidjson::StringRef(name), allocator);
+            event.AddMember("args", args, allocator);
+            events.PushBack(event, allocator);
+        };
+
+        auto addSlice = [&](int trackId, const AZStd::string& name, const char* category,
+            AZStd::chrono::steady_clock::time_point begin, AZStd::chrono::steady_clock::time_point end) -> rapidjson::Value&
+        {
+            rapidjson::Value event(rapidjson::kObjectType);
+            event.AddMember("name", rapidjson::Value(name.c_str(), allocator), allocator);
+            event.AddMember("cat", rapidjson::StringRef(category), allocator);
+            event.AddMember("ph", "X", allocator);
+            event.AddMember("pid", 1, allocator);
+            event.AddMember("tid", trackId, allocator);
+            event.AddMember("ts", toTraceTime(begin), allocator);
+            event.AddMember("dur", toTraceTime(end) - toTraceTime(begin), allocator);
+            events.PushBack(event, allocator);
+            return events[events.Size() - 1];
+        };
+
+        addTrackName(ScriptTrackId, "Scripts");
+        addTrackName(OperationTrackId, "Operations");
+
+        for (const ScriptSpan& span : m_scriptSpans)
+        {
+            if (IsSet(span.m_endTime))
+            {
+                addSlice(ScriptTrackId, m_strings[span.m_nameIndex], "script", span.m_beginTime, span.m_endTime);
+            }
+        }
+
+        for (const Operation& operation : m_operations)
+        {
+            // Operations left in the queue when scripts were aborted never ran
+            if (!IsSet(operation.m_dispatchTime))
+            {
+                continue;
+            }
+
+            const auto endTime = IsSet(operation.m_endTime) ? operation.m_endTime : operation.m_completeTime;
+
+            rapidjson::Value& slice = addSlice(OperationTrackId, m_strings[operation.m_kindIndex], "operation", operation.m_dispatchTime, endTime);
+
+            rapidjson::Value args(rapidjson::kObjectType);
+            if (operation.m_line >= 0)
+            {
+                const AZStd::string source = AZStd::string::format("%s:%d", m_strings[operation.m_sourceIndex].c_str(), operation.m_line);
+                args.AddMember("source", rapidjson::Value(source.c_str(), allocator), allocator);
+            }
+            args.AddMember("queuedMs", ToMilliseconds(operation.m_dispatchTime - operation.m_enqueueTime), allocator);
+            args.AddMember("executeMs", ToMilliseconds(operation.m_completeTime - operation.m_dispatchTime), allocator);
+            args.AddMember("blockedMs", ToMilliseconds(endTime - operation.m_completeTime), allocator);
+
+            size_t mainWaitReason = 0;
+            rapidjson::Value waitFrames(rapidjson::kObjectType);
+            for (size_t reason = 0; reason < operation.m_waitFrames.size(); ++reason)
+            {
+                if (operation.m_waitFrames[reason] > 0)
+                {
+                    waitFrames.AddMember(rapidjson::StringRef(WaitReasonNames[reason]), operation.m_waitFrames[reason], allocator);
+                }
+                if (operation.m_waitFrames[reason] > operation.m_waitFrames[mainWaitReason])
+                {
+                    mainWaitReason = reason;
+                }
+            }
+            const bool waited = operation.m_waitFrames[mainWaitReason] > 0;
+            if (waited)
+            {
+                args.AddMember("blockedFrames", waitFrames, allocator);
+            }
+            slice.AddMember("args", args, allocator);
+
+            if (waited && endTime > operation.m_completeTime)
+            {
+                addSlice(OperationTrackId, AZStd::string::format("Wait (%s)", WaitReasonNames[mainWaitReason]), "wait",
+                    operation.m_completeTime, endTime);
+            }
+        }
+
+        document.AddMember("traceEvents", events, allocator);
+        document.AddMember("displayTimeUnit", "ms", allocator);
+
+        auto writeResult = AZ::JsonSerializationUtils::WriteJsonFile(document, filePath);
+        if (!writeResult.IsSuccess())
+        {
+            AZ_Error("Automation", false, "Failed to write script operation trace '%s': %s", filePath.c_str(), writeResult.GetError().c_str());
+            return false;
+        }
+
+        return true;
+    }
+} // namespace AtomSampleViewer
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+struct lua_State;
+
+namespace AtomSampleViewer
+{
+    //! Records where the wall time of a script run goes, one entry per operation in the ScriptManager's deferred queue.
+    //! Each operation is tagged with the Lua function that queued it and the script line it was called from, and is timed
+    //! from when it was queued, to when it was dispatched, to when it finished executing. The frames the queue then spent
+    //! blocked (idle frames, pauses for captures, asset loading) are attributed to that operation, since it is what caused them.
+    //!
+    //! The result is written as Chrome trace event JSON, which loads in chrome://tracing and ui.perfetto.dev.
+    //! Scripts show on one track and the operations they ran on another, with the blocked time as a nested "Wait" slice.
+    class ScriptOperationTrace
+    {
+    public:
+        static constexpr uint32_t InvalidIndex = 0xFFFFFFFF;
+
+        //! Why the operation queue didn't advance on a frame. Must match WaitReasonNames in the .cpp.
+        enum class WaitReason : uint32_t
+        {
+            IdleFrames,
+            IdleSeconds,
+            Pause,          //!< PauseScript()/PauseScriptWithTimeout() with no capture pending, e.g. waiting for a sample
+            Capture,        //!< Paused until a screenshot or profiling capture finishes
+            AssetTracker,
+            Condition,      //!< One of the IdleUntil*() waits on an engine condition
+            ScriptBoundary, //!< One frame between scripts so results are reported against the right one
+            Count
+        };
+
+        struct Operation
+        {
+            uint32_t m_kindIndex = 0;       //!< Index into GetStrings(), the name of the Lua function that queued the operation
+            uint32_t m_sourceIndex = 0;     //!< Index into GetStrings(), the Lua chunk that called it
+            int32_t m_line = -1;            //!< Line in that chunk, or -1 when queued from C++
+            AZStd::chrono::steady_clock::time_point m_enqueueTime;
+            AZStd::chrono::steady_clock::time_point m_dispatchTime;
+            AZStd::chrono::steady_clock::time_point m_completeTime;
+            AZStd::chrono::steady_clock::time_point m_endTime; //!< When the next operation was dispatched, or the trace ended
+            AZStd::array<uint32_t, static_cast<size_t>(WaitReason::Count)> m_waitFrames = {};
+        };
+
+        struct ScriptSpan
+        {
+            uint32_t m_nameIndex = 0;
+            uint32_t m_depth = 0;
+            AZStd::chrono::steady_clock::time_point m_beginTime;
+            AZStd::chrono::steady_clock::time_point m_endTime;
+        };
+
+        //! Clears any previous trace and starts recording
+        void Begin();
+
+        //! Stops recording. Blocked time after the last operation is attributed to it up to this point.
+        void End();
+
+        bool IsRecording() const { return m_isRecording; }
+
+        //! Called when an operation is queued. Reads the calling function and line from the Lua stack, if Lua is running.
+        //! @return the operation's index, or InvalidIndex when not recording
+        uint32_t RecordEnqueue(lua_State* luaState);
+
+        void RecordDispatch(uint32_t operationIndex);
+        void RecordComplete(uint32_t operationIndex);
+
+        //! Called once for each frame the queue doesn't advance
+        void RecordWait(WaitReason reason);
+
+        void BeginScript(const AZStd::string& scriptFilePath);
+        void EndScript();
+
+        const AZStd::vector<Operation>& GetOperations() const { return m_operations; }
+        const AZStd::vector<ScriptSpan>& GetScriptSpans() const { return m_scriptSpans; }
+        const AZStd::vector<AZStd::string>& GetStrings() const { return m_strings; }
+
+        //! Writes the trace as Chrome trace event JSON
+        bool WriteChromeTrace(const AZStd::string& filePath) const;
+
+    private:
+        uint32_t InternString(AZStd::string_view string);
+
+        //! Marks the end of the time held up by the last completed operation
+        void ReleaseLastCompleted(AZStd::chrono::steady_clock::time_point time);
+
+        bool m_isRecording = false;
+        AZStd::chrono::steady_clock::time_point m_beginTime;
+        AZStd::chrono::steady_clock::time_point m_endTime;
+
+        AZStd::vector<Operation> m_operations;
+        uint32_t m_lastCompletedIndex = InvalidIndex;
+
+        AZStd::vector<ScriptSpan> m_scriptSpans;
+        AZStd::vector<uint32_t> m_openScriptSpans;
+
+        // Kinds and sources repeat for almost every operation, so they are stored once
+        AZStd::vector<AZStd::string> m_strings;
+        AZStd::unordered_map<AZStd::string, uint32_t> m_stringIndices;
+    };
+} // namespace AtomSampleViewer
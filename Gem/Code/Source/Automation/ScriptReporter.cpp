@@ -6,14 +6,21 @@
  *
  */
 
-#include <sstream>
 #include <Automation/ScriptReporter.h>
+#include <Automation/ImageDiff.h>
+#include <Automation/ImageSignature.h>
 #include <Utils/Utils.h>
 #include <Atom/RHI/Factory.h>
 #include <AzFramework/API/ApplicationAPI.h>
 #include <AzFramework/StringFunc/StringFunc.h>
 #include <AzFramework/IO/LocalFileIO.h>
 #include <AzCore/IO/SystemFile.h>
+#include <AzCore/JSON/stringbuffer.h>
+#include <AzCore/JSON/writer.h>
+#include <AzCore/Serialization/Json/JsonUtils.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Utils/Utils.h>
 
 namespace AtomSampleViewer
@@ -29,6 +36,37 @@ namespace AtomSampleViewer
         "Sort by Script", "Sort by Official Baseline Diff Score", "Sort by Local Baseline Diff Score",
     };
 
+    // Must match ScriptReporter::ImageComparisonResult::ResultCode. These are the values used in exported results.
+    static const char* ResultCodeNames[] =
+    {
+        "None", "Pending", "Pass", "FileNotFound", "FileNotLoaded", "WrongSize", "WrongFormat", "NullImageComparisonToleranceLevel",
+        "ThresholdExceeded", "Skipped",
+    };
+
+    static_assert(AZ_ARRAY_SIZE(ResultCodeNames) == static_cast<size_t>(ScriptReporter::ImageComparisonResult::ResultCode::Skipped) + 1,
+        "ResultCodeNames must match ScriptReporter::ImageComparisonResult::ResultCode");
+
+    static const char* GetResultCodeName(ScriptReporter::ImageComparisonResult::ResultCode resultCode)
+    {
+        return ResultCodeNames[static_cast<size_t>(resultCode)];
+    }
+
+    static void AppendXmlEscaped(AZStd::string& xml, AZStd::string_view text)
+    {
+        for (char c : text)
+        {
+            switch (c)
+            {
+            case '&': xml += "&amp;"; break;
+            case '<': xml += "&lt;"; break;
+            case '>': xml += "&gt;"; break;
+            case '"': xml += "&quot;"; break;
+            case '\'': xml += "&apos;"; break;
+            default: xml += c; break;
+            }
+        }
+    }
+
     AZStd::string ScriptReporter::ImageComparisonResult::GetSummaryString() const
     {
         AZStd::string resultString;
@@ -57,6 +95,14 @@ namespace AtomSampleViewer
         {
             resultString = "ImageComparisonToleranceLevel not provided";
         }
+        else if (m_resultCode == ResultCode::Pending)
+        {
+            resultString = "Comparison pending";
+        }
+        else if (m_resultCode == ResultCode::Skipped)
+        {
+            resultString = "Skipped";
+        }
         else if (m_resultCode == ResultCode::None)
         {
             // "None" could be the case if the results dialog is open while the script is running
@@ -78,9 +124,14 @@ namespace AtomSampleViewer
 
     void ScriptReporter::Reset()
     {
+        WaitForScreenshotChecks();
+
         m_scriptReports.clear();
+        m_testDurations.clear();
         m_reportsSortedByOfficialBaslineScore.clear();
         m_reportsSortedByLocaBaslineScore.clear();
+        m_visibleSortedRows.clear();
+        m_visibleRowsDirty = true;
         m_currentScriptIndexStack.clear();
         m_invalidationMessage.clear();
         m_uniqueTimestamp = GenerateTimestamp();
@@ -97,6 +148,9 @@ namespace AtomSampleViewer
 
     void ScriptReporter::PushScript(const AZStd::string& scriptAssetPath)
     {
+        // Any comparisons still running belong to the current script, so their failures must be reported before it stops listening
+        WaitForScreenshotChecks();
+
         if (GetCurrentScriptReport())
         {
             // Only the current script should listen for Trace Errors
@@ -104,18 +158,25 @@ namespace AtomSampleViewer
         }
 
         m_currentScriptIndexStack.push_back(m_scriptReports.size());
-        m_scriptReports.emplace_back().m_scriptAssetPath = scriptAssetPath;
-        m_scriptReports.back().BusConnect();
+        ScriptReport& scriptReport = m_scriptReports.emplace_back();
+        scriptReport.m_scriptAssetPath = scriptAssetPath;
+        scriptReport.m_startTime = AZStd::chrono::steady_clock::now();
+        scriptReport.BusConnect();
     }
 
     void ScriptReporter::PopScript()
     {
         AZ_Assert(GetCurrentScriptReport(), "There is no active script");
 
-        if (GetCurrentScriptReport())
+        WaitForScreenshotChecks();
+
+        if (ScriptReport* scriptReport = GetCurrentScriptReport())
         {
-            GetCurrentScriptReport()->BusDisconnect();
+            scriptReport->m_durationSeconds = AZStd::chrono::duration<double>(AZStd::chrono::steady_clock::now() - scriptReport->m_startTime).count();
+            scriptReport->BusDisconnect();
             m_currentScriptIndexStack.pop_back();
+
+            StreamScriptReport(*scriptReport);
         }
 
         if (GetCurrentScriptReport())
@@ -186,9 +247,33 @@ namespace AtomSampleViewer
         ScreenshotTestInfo screenshotTestInfo(imageName);
         GetCurrentScriptReport()->m_screenshotTests.push_back(AZStd::move(screenshotTestInfo));
 
+        // The test is listed in the sorted views right away, so they show the tests that are still pending too
+        const ReportIndex reportIndex{ m_currentScriptIndexStack.back(), GetCurrentScriptReport()->m_screenshotTests.size() - 1 };
+        ScreenshotTestInfo& addedTestInfo = GetCurrentScriptReport()->m_screenshotTests.back();
+        addedTestInfo.m_officialSortedEntry = m_reportsSortedByOfficialBaslineScore.emplace(addedTestInfo.m_officialComparisonResult.m_diffScore, reportIndex);
+        addedTestInfo.m_localSortedEntry = m_reportsSortedByLocaBaslineScore.emplace(addedTestInfo.m_localComparisonResult.m_diffScore, reportIndex);
+        m_visibleRowsDirty = true;
+
         return true;
     }
 
+    void ScriptReporter::SkipLatestScreenshot(const AZStd::string& reason)
+    {
+        AZ_Assert(GetCurrentScriptReport(), "There is no active script");
+
+        if (GetCurrentScriptReport() == nullptr || GetCurrentScriptReport()->m_screenshotTests.empty())
+        {
+            return;
+        }
+
+        ScreenshotTestInfo& screenshotTestInfo = GetCurrentScriptReport()->m_screenshotTests.back();
+        screenshotTestInfo.m_officialComparisonResult.m_resultCode = ImageComparisonResult::ResultCode::Skipped;
+        screenshotTestInfo.m_localComparisonResult.m_resultCode = ImageComparisonResult::ResultCode::Skipped;
+        OnScreenshotResultChanged(screenshotTestInfo);
+
+        AZ_Printf("ScriptReporter", "Skipped screenshot '%s' (%s)\n", screenshotTestInfo.m_screenshotFilePath.c_str(), reason.c_str());
+    }
+
     void ScriptReporter::TickImGui()
     {
         if (m_showReportDialog)
@@ -265,10 +350,10 @@ namespace AtomSampleViewer
         ImGui::Text("Total Screenshot Count: %u", m_resultsSummary.m_totalScreenshotsCount);
 
         HighlightTextIf(m_resultsSummary.m_totalScreenshotsFailed > 0, m_highlightSettings.m_highlightFailed);
-        ImGui::Text("Total Screenshot Failures: %u %s", m_resultsSummary.m_totalScreenshotsFailed, SeeBelow(m_resultsSummary.m_totalScreenshotsFailed).c_str());
+        ImGui::Text("Total Screenshot Failures: %u %s", m_resultsSummary.m_totalScreenshotsFailed, SeeBelow(m_resultsSummary.m_totalScreenshotsFailed));
 
         HighlightTextIf(m_resultsSummary.m_totalScreenshotWarnings > 0, m_highlightSettings.m_highlightWarning);
-        ImGui::Text("Total Screenshot Warnings: %u %s", m_resultsSummary.m_totalScreenshotWarnings, SeeBelow(m_resultsSummary.m_totalScreenshotWarnings).c_str());
+        ImGui::Text("Total Screenshot Warnings: %u %s", m_resultsSummary.m_totalScreenshotWarnings, SeeBelow(m_resultsSummary.m_totalScreenshotWarnings));
 
         ResetTextHighlight();
     }
@@ -360,20 +445,19 @@ namespace AtomSampleViewer
                 m_resultsSummary.m_totalScreenshotWarnings += scriptReport.m_screenshotWarningCount;
                 m_resultsSummary.m_totalScreenshotsFailed += scriptReport.m_screenshotErrorCount;
 
-                // This will catch any false-negatives that could occur if the screenshot failure error messages change without also updating ScriptReport::OnPreError()
                 m_resultsSummary.m_totalScreenshotsCount += aznumeric_cast<uint32_t>(scriptReport.m_screenshotTests.size());
-                for (ScreenshotTestInfo& screenshotTest : scriptReport.m_screenshotTests)
-                {
-                    if (screenshotTest.m_officialComparisonResult.m_resultCode != ImageComparisonResult::ResultCode::Pass &&
-                        screenshotTest.m_officialComparisonResult.m_resultCode != ImageComparisonResult::ResultCode::None)
-                    {
-                        AZ_Assert(scriptReport.m_screenshotErrorCount > 0, "If screenshot comparison failed in any way, m_screenshotErrorCount should be non-zero.");
-                    }
-                }
             }
 
             DisplayScriptResultsSummary();
 
+            const BaselineImageCache::Stats cacheStats = m_baselineImageCache->GetStats();
+            ImGui::Text("Baseline Cache: %llu hits, %llu sidecar hits, %llu decoded (%zu images, %.1f MiB)",
+                static_cast<unsigned long long>(cacheStats.m_memoryHits),
+                static_cast<unsigned long long>(cacheStats.m_sidecarHits),
+                static_cast<unsigned long long>(cacheStats.m_misses),
+                cacheStats.m_cachedImageCount,
+                cacheStats.m_cachedBytes / (1024.0 * 1024.0));
+
             ImGui::Text("Exported test results: %s", m_exportedTestResultsPath.c_str());
             if (ImGui::Button("Update All Local Baseline Images"))
             {
@@ -398,12 +482,18 @@ namespace AtomSampleViewer
             }
 
             int displayOption = m_displayOption;
-            ImGui::Combo("Display", &displayOption, DiplayOptions, AZ_ARRAY_SIZE(DiplayOptions));
-            m_displayOption = (DisplayOption)displayOption;
+            if (ImGui::Combo("Display", &displayOption, DiplayOptions, AZ_ARRAY_SIZE(DiplayOptions)))
+            {
+                m_displayOption = (DisplayOption)displayOption;
+                m_visibleRowsDirty = true;
+            }
 
             int sortOption = m_currentSortOption;
-            ImGui::Combo("Sort Results", &sortOption, SortOptions, AZ_ARRAY_SIZE(SortOptions));
-            m_currentSortOption = (SortOption)sortOption;
+            if (ImGui::Combo("Sort Results", &sortOption, SortOptions, AZ_ARRAY_SIZE(SortOptions)))
+            {
+                m_currentSortOption = (SortOption)sortOption;
+                m_visibleRowsDirty = true;
+            }
 
             ImGui::Checkbox("Force Show 'Update' Buttons", &m_forceShowUpdateButtons);
             ImGui::Checkbox("Force Show 'Export Png Diff' Buttons", &m_forceShowExportPngDiffButtons);
@@ -411,6 +501,8 @@ namespace AtomSampleViewer
             m_showWarnings = (m_displayOption == DisplayOption::AllResults) || (m_displayOption == DisplayOption::WarningsAndErrors);
             m_showAll = (m_displayOption == DisplayOption::AllResults);
 
+            UpdateVisibleRows();
+
             ImGui::Separator();
 
             if (m_currentSortOption == SortOption::Unsorted)
@@ -432,14 +524,9 @@ namespace AtomSampleViewer
 
                     ImGuiTreeNodeFlags scriptNodeFlag = scriptPassed ? FlagDefaultClosed : FlagDefaultOpen;
 
-                    AZStd::string header = AZStd::string::format("%s %s",
-                        scriptPassed ? "PASSED" : "FAILED",
-                        scriptReport.m_scriptAssetPath.c_str()
-                    );
-
                     HighlightTextFailedOrWarning(!scriptPassed, scriptHasWarnings);
 
-                    if (ImGui::TreeNodeEx(&scriptReport, scriptNodeFlag, "%s", header.c_str()))
+                    if (ImGui::TreeNodeEx(&scriptReport, scriptNodeFlag, "%s %s", scriptPassed ? "PASSED" : "FAILED", scriptReport.m_scriptAssetPath.c_str()))
                     {
                         ResetTextHighlight();
 
@@ -476,43 +563,35 @@ namespace AtomSampleViewer
                         HighlightTextIf(scriptReport.m_screenshotErrorCount > 0, m_highlightSettings.m_highlightFailed);
                         if (m_showAll || scriptReport.m_screenshotErrorCount > 0)
                         {
-                            ImGui::Text("Screenshot Tests Failed: %u %s", scriptReport.m_screenshotErrorCount, SeeBelow(scriptReport.m_screenshotErrorCount).c_str());
+                            ImGui::Text("Screenshot Tests Failed: %u %s", scriptReport.m_screenshotErrorCount, SeeBelow(scriptReport.m_screenshotErrorCount));
                         }
 
                         // Number of screenshot warnings
                         HighlightTextIf(scriptReport.m_screenshotWarningCount > 0, m_highlightSettings.m_highlightWarning);
                         if (m_showAll || (m_showWarnings && scriptReport.m_screenshotWarningCount > 0))
                         {
-                            ImGui::Text("Screenshot Warnings:     %u %s", scriptReport.m_screenshotWarningCount, SeeBelow(scriptReport.m_screenshotWarningCount).c_str());
+                            ImGui::Text("Screenshot Warnings:     %u %s", scriptReport.m_screenshotWarningCount, SeeBelow(scriptReport.m_screenshotWarningCount));
                         }
 
                         ResetTextHighlight();
 
-                        for (ScreenshotTestInfo& screenshotResult : scriptReport.m_screenshotTests)
+                        auto getScreenshotResult = [&scriptReport](int row) -> ScreenshotTestInfo&
                         {
-                            const bool screenshotPassed = screenshotResult.m_officialComparisonResult.m_resultCode == ImageComparisonResult::ResultCode::Pass;
-                            const bool localBaselineWarning = screenshotResult.m_localComparisonResult.m_resultCode != ImageComparisonResult::ResultCode::Pass;
-
-                            AZStd::string fileName;
-                            AzFramework::StringFunc::Path::GetFullFileName(screenshotResult.m_screenshotFilePath.c_str(), fileName);
+                            return scriptReport.m_screenshotTests[scriptReport.m_visibleScreenshotIndices[row]];
+                        };
 
-                            std::stringstream headerSummary;
-                            if (!screenshotPassed)
+                        ShowScreenshotRows(aznumeric_cast<int>(scriptReport.m_visibleScreenshotIndices.size()),
+                            [&getScreenshotResult](int row)
                             {
-                                headerSummary << "(" << screenshotResult.m_officialComparisonResult.GetSummaryString().c_str() << ") ";
-                            }
-                            if (localBaselineWarning)
+                                return getScreenshotResult(row).m_reportRow.m_isExpandedInScriptView;
+                            },
+                            [this, &scriptReport, &getScreenshotResult](int row)
                             {
-                                headerSummary << "(Local Baseline Warning)";
-                            }
-
-                            AZStd::string screenshotHeader = AZStd::string::format("%s %s %s",
-                                screenshotPassed ? "PASSED" : "FAILED",
-                                fileName.c_str(),
-                                headerSummary.str().c_str());
-
-                            ShowScreenshotTestInfoTreeNode(screenshotHeader, scriptReport, screenshotResult);
-                        }
+                                ScreenshotTestInfo& screenshotResult = getScreenshotResult(row);
+                                UpdateScreenshotReportRow(scriptReport, screenshotResult);
+                                screenshotResult.m_reportRow.m_isExpandedInScriptView =
+                                    ShowScreenshotTestInfoTreeNode(screenshotResult.m_reportRow.m_scriptViewHeader, scriptReport, screenshotResult);
+                            });
 
                         ImGui::TreePop();
                     }
@@ -522,50 +601,26 @@ namespace AtomSampleViewer
             }
             else
             {
-                const SortedReportIndexMap* sortedReportMap = nullptr;
-                if (m_currentSortOption == SortOption::OfficialBaselineDiffScore)
-                {
-                    sortedReportMap = &m_reportsSortedByOfficialBaslineScore;
-                }
-                else if (m_currentSortOption == SortOption::LocalBaselineDiffScore)
-                {
-                    sortedReportMap = &m_reportsSortedByLocaBaslineScore;
-                }
-
-                AZ_Assert(sortedReportMap, "Unhandled m_currentSortOption");
-
-                if (sortedReportMap)
-                {
-                    for (const auto& [threshold, reportIndex] : *sortedReportMap)
+                ShowScreenshotRows(aznumeric_cast<int>(m_visibleSortedRows.size()),
+                    [this](int row)
                     {
+                        const ReportIndex& reportIndex = m_visibleSortedRows[row];
+                        return m_scriptReports[reportIndex.first].m_screenshotTests[reportIndex.second].m_reportRow.m_isExpandedInSortedView;
+                    },
+                    [this](int row)
+                    {
+                        const ReportIndex& reportIndex = m_visibleSortedRows[row];
                         ScriptReport& scriptReport = m_scriptReports[reportIndex.first];
                         ScreenshotTestInfo& screenshotResult = scriptReport.m_screenshotTests[reportIndex.second];
 
-                        float diffScore = 0.0f;
-                        if (m_currentSortOption == SortOption::OfficialBaselineDiffScore)
-                        {
-                            diffScore = screenshotResult.m_officialComparisonResult.m_diffScore;
-                        }
-                        else if (m_currentSortOption == SortOption::LocalBaselineDiffScore)
-                        {
-                            diffScore = screenshotResult.m_localComparisonResult.m_diffScore;
-                        }
-
-                        const bool screenshotPassed = screenshotResult.m_officialComparisonResult.m_resultCode == ImageComparisonResult::ResultCode::Pass;
+                        UpdateScreenshotReportRow(scriptReport, screenshotResult);
 
-                        AZStd::string fileName;
-                        AzFramework::StringFunc::Path::GetFullFileName(screenshotResult.m_screenshotFilePath.c_str(), fileName);
+                        const AZStd::string& header = (m_currentSortOption == SortOption::LocalBaselineDiffScore)
+                            ? screenshotResult.m_reportRow.m_localScoreHeader
+                            : screenshotResult.m_reportRow.m_officialScoreHeader;
 
-                        AZStd::string header = AZStd::string::format("%f %s %s %s '%s'",
-                            diffScore,
-                            screenshotPassed ? "PASSED" : "FAILED",
-                            scriptReport.m_scriptAssetPath.c_str(),
-                            fileName.c_str(),
-                            screenshotResult.m_toleranceLevel.m_name.c_str());
-
-                        ShowScreenshotTestInfoTreeNode(header, scriptReport, screenshotResult);
-                    }
-                }
+                        screenshotResult.m_reportRow.m_isExpandedInSortedView = ShowScreenshotTestInfoTreeNode(header, scriptReport, screenshotResult);
+                    });
             }
             ResetTextHighlight();
 
@@ -584,10 +639,12 @@ namespace AtomSampleViewer
         ImGui::End();
     }
 
-    void ScriptReporter::ShowScreenshotTestInfoTreeNode(const AZStd::string& header,  ScriptReport& scriptReport, ScreenshotTestInfo& screenshotResult)
+    bool ScriptReporter::IsScreenshotTestVisible(const ScreenshotTestInfo& screenshotResult) const
     {
-        const bool screenshotPassed = screenshotResult.m_officialComparisonResult.m_resultCode == ImageComparisonResult::ResultCode::Pass;
-        const bool localBaselineWarning = screenshotResult.m_localComparisonResult.m_resultCode != ImageComparisonResult::ResultCode::Pass;
+        // Skipped screenshots were never captured, so they are shown like passes rather than failures
+        const bool screenshotSkipped = screenshotResult.m_officialComparisonResult.m_resultCode == ImageComparisonResult::ResultCode::Skipped;
+        const bool screenshotPassed = screenshotSkipped || screenshotResult.m_officialComparisonResult.m_resultCode == ImageComparisonResult::ResultCode::Pass;
+        const bool localBaselineWarning = !screenshotSkipped && screenshotResult.m_localComparisonResult.m_resultCode != ImageComparisonResult::ResultCode::Pass;
 
         // Skip if tests passed without warnings and we don't want to show successes
         bool skipScreenshot = (screenshotPassed && !localBaselineWarning && !m_showAll);
@@ -595,13 +652,151 @@ namespace AtomSampleViewer
         // Skip if we only have warnings only and we don't want to show warnings
         skipScreenshot = skipScreenshot || (screenshotPassed && localBaselineWarning && !m_showWarnings);
 
-        if (skipScreenshot)
+        return !skipScreenshot;
+    }
+
+    void ScriptReporter::UpdateVisibleRows()
+    {
+        if (!m_visibleRowsDirty)
+        {
+            return;
+        }
+
+        for (ScriptReport& scriptReport : m_scriptReports)
+        {
+            scriptReport.m_visibleScreenshotIndices.clear();
+            for (size_t i = 0; i < scriptReport.m_screenshotTests.size(); ++i)
+            {
+                if (IsScreenshotTestVisible(scriptReport.m_screenshotTests[i]))
+                {
+                    scriptReport.m_visibleScreenshotIndices.push_back(i);
+                }
+            }
+        }
+
+        m_visibleSortedRows.clear();
+        const SortedReportIndexMap* sortedReportMap = nullptr;
+        if (m_currentSortOption == SortOption::OfficialBaselineDiffScore)
+        {
+            sortedReportMap = &m_reportsSortedByOfficialBaslineScore;
+        }
+        else if (m_currentSortOption == SortOption::LocalBaselineDiffScore)
+        {
+            sortedReportMap = &m_reportsSortedByLocaBaslineScore;
+        }
+
+        if (sortedReportMap)
+        {
+            for (const auto& [diffScore, reportIndex] : *sortedReportMap)
+            {
+                if (IsScreenshotTestVisible(m_scriptReports[reportIndex.first].m_screenshotTests[reportIndex.second]))
+                {
+                    m_visibleSortedRows.push_back(reportIndex);
+                }
+            }
+        }
+
+        m_visibleRowsDirty = false;
+    }
+
+    void ScriptReporter::UpdateScreenshotReportRow(const ScriptReport& scriptReport, ScreenshotTestInfo& screenshotResult)
+    {
+        ScreenshotReportRow& reportRow = screenshotResult.m_reportRow;
+        if (!reportRow.m_isDirty)
         {
             return;
         }
+
+        const bool screenshotPending = screenshotResult.m_officialComparisonResult.m_resultCode == ImageComparisonResult::ResultCode::Pending;
+        const bool screenshotSkipped = screenshotResult.m_officialComparisonResult.m_resultCode == ImageComparisonResult::ResultCode::Skipped;
+        const bool screenshotPassed = screenshotResult.m_officialComparisonResult.m_resultCode == ImageComparisonResult::ResultCode::Pass;
+        const bool localBaselineWarning = screenshotResult.m_localComparisonResult.m_resultCode != ImageComparisonResult::ResultCode::Pass &&
+            screenshotResult.m_localComparisonResult.m_resultCode != ImageComparisonResult::ResultCode::Pending &&
+            screenshotResult.m_localComparisonResult.m_resultCode != ImageComparisonResult::ResultCode::Skipped;
+
+        AZStd::string fileName;
+        AzFramework::StringFunc::Path::GetFullFileName(screenshotResult.m_screenshotFilePath.c_str(), fileName);
+
+        AZStd::string headerSummary;
+        if (!screenshotPassed && !screenshotPending && !screenshotSkipped)
+        {
+            headerSummary += "(" + screenshotResult.m_officialComparisonResult.GetSummaryString() + ") ";
+        }
+        if (localBaselineWarning)
+        {
+            headerSummary += "(Local Baseline Warning)";
+        }
+
+        reportRow.m_scriptViewHeader = AZStd::string::format("%s %s %s",
+            screenshotPending ? "PENDING" : (screenshotSkipped ? "SKIPPED" : (screenshotPassed ? "PASSED" : "FAILED")),
+            fileName.c_str(),
+            headerSummary.c_str());
+
+        const char* sortedStatus = screenshotSkipped ? "SKIPPED" : (screenshotPassed ? "PASSED" : "FAILED");
+
+        reportRow.m_officialScoreHeader = AZStd::string::format("%f %s %s %s '%s'",
+            screenshotResult.m_officialComparisonResult.m_diffScore,
+            sortedStatus,
+            scriptReport.m_scriptAssetPath.c_str(),
+            fileName.c_str(),
+            screenshotResult.m_toleranceLevel.m_name.c_str());
+
+        reportRow.m_localScoreHeader = AZStd::string::format("%f %s %s %s '%s'",
+            screenshotResult.m_localComparisonResult.m_diffScore,
+            sortedStatus,
+            scriptReport.m_scriptAssetPath.c_str(),
+            fileName.c_str(),
+            screenshotResult.m_toleranceLevel.m_name.c_str());
+
+        reportRow.m_isDirty = false;
+    }
+
+    void ScriptReporter::ShowScreenshotRows(int rowCount, const AZStd::function<bool(int row)>& isRowExpanded, const AZStd::function<void(int row)>& showRow)
+    {
+        // A row that is opened while it's in view is drawn that frame, so its state is up to date by the time it could move out
+        // of the clipper. Rows that aren't drawn stay collapsed.
+        int row = 0;
+        while (row < rowCount)
+        {
+            if (isRowExpanded(row))
+            {
+                showRow(row);
+                ++row;
+                continue;
+            }
+
+            int collapsedEnd = row + 1;
+            while (collapsedEnd < rowCount && !isRowExpanded(collapsedEnd))
+            {
+                ++collapsedEnd;
+            }
+
+            ImGuiListClipper clipper;
+            clipper.Begin(collapsedEnd - row);
+            while (clipper.Step())
+            {
+                for (int clippedRow = clipper.DisplayStart; clippedRow < clipper.DisplayEnd; ++clippedRow)
+                {
+                    showRow(row + clippedRow);
+                }
+            }
+            clipper.End();
+
+            row = collapsedEnd;
+        }
+    }
+
+    bool ScriptReporter::ShowScreenshotTestInfoTreeNode(const AZStd::string& header,  ScriptReport& scriptReport, ScreenshotTestInfo& screenshotResult)
+    {
+        // Skipped screenshots were never captured, so they are shown like passes rather than failures
+        const bool screenshotSkipped = screenshotResult.m_officialComparisonResult.m_resultCode == ImageComparisonResult::ResultCode::Skipped;
+        const bool screenshotPassed = screenshotSkipped || screenshotResult.m_officialComparisonResult.m_resultCode == ImageComparisonResult::ResultCode::Pass;
+        const bool localBaselineWarning = !screenshotSkipped && screenshotResult.m_localComparisonResult.m_resultCode != ImageComparisonResult::ResultCode::Pass;
+
         ImGuiTreeNodeFlags screenshotNodeFlag = FlagDefaultClosed;
         HighlightTextFailedOrWarning(!screenshotPassed, localBaselineWarning);
-        if (ImGui::TreeNodeEx(&screenshotResult, screenshotNodeFlag, "%s", header.c_str()))
+        const bool isOpen = ImGui::TreeNodeEx(&screenshotResult, screenshotNodeFlag, "%s", header.c_str());
+        if (isOpen)
         {
             ResetTextHighlight();
 
@@ -730,6 +925,8 @@ namespace AtomSampleViewer
 
             ImGui::TreePop();
         }
+
+        return isOpen;
     }
 
     void ScriptReporter::OpenReportDialog()
@@ -766,16 +963,9 @@ namespace AtomSampleViewer
         }
     }
 
-    AZStd::string ScriptReporter::SeeBelow(uint32_t issueCount)
+    const char* ScriptReporter::SeeBelow(uint32_t issueCount)
     {
-        if (issueCount == 0)
-        {
-            return AZStd::string{};
-        }
-        else
-        {
-            return AZStd::string::format("(See below)");
-        }
+        return issueCount == 0 ? "" : "(See below)";
     }
 
     void ScriptReporter::HighlightTextIf(bool shouldSet, ImVec4 color)
@@ -822,24 +1012,6 @@ namespace AtomSampleViewer
         }
     }
 
-    void ScriptReporter::SortScriptReports()
-    {
-        for (size_t i = 0; i < m_scriptReports.size(); ++i)
-        {
-            const AZStd::vector<ScriptReporter::ScreenshotTestInfo>& screenshotTestInfos = m_scriptReports[i].m_screenshotTests;
-            for (size_t j = 0; j < screenshotTestInfos.size(); ++j)
-            {
-                m_reportsSortedByOfficialBaslineScore.insert(AZStd::pair<float, ReportIndex>(
-                    screenshotTestInfos[j].m_officialComparisonResult.m_diffScore,
-                    ReportIndex{ i, j }));
-
-                m_reportsSortedByLocaBaslineScore.insert(AZStd::pair<float, ReportIndex>(
-                    screenshotTestInfos[j].m_localComparisonResult.m_diffScore,
-                    ReportIndex{ i, j }));
-            }
-        }
-    }
-
     void ScriptReporter::ReportScriptError([[maybe_unused]] const AZStd::string& message)
     {
         AZ_Error("ScriptReporter", false, "Script: %s", message.c_str());
@@ -921,9 +1093,21 @@ namespace AtomSampleViewer
 
         if (!failed)
         {
+            m_baselineImageCache->Invalidate(destinationFile);
+
+            // Store the new baseline's signature so the next local baseline check can be done by comparing hashes
+            AZ::Utils::PngFile newBaseline = AZ::Utils::PngFile::Load(destinationFile.c_str());
+            if (!newBaseline.IsValid() || newBaseline.GetBufferFormat() != AZ::Utils::PngFile::Format::RGBA ||
+                !ImageSignature::Compute(newBaseline.GetBuffer(), newBaseline.GetWidth(), newBaseline.GetHeight()).Save(destinationFile))
+            {
+                // Not fatal, the next check will do a full comparison and write the signature itself
+                AZ::IO::LocalFileIO::GetInstance()->Remove(ImageSignature::GetSignatureFilePath(destinationFile).c_str());
+            }
+
             // Since we just replaced the baseline image, we can update this screenshot test result as an exact match.
             // This will update the ImGui report dialog by the next frame.
             ClearImageComparisonResult(screenshotTest.m_localComparisonResult);
+            OnScreenshotResultChanged(screenshotTest);
         }
 
         if (showResultDialog)
@@ -989,9 +1173,13 @@ namespace AtomSampleViewer
 
         if (success)
         {
+            // The cached official baseline will be replaced once the Asset Processor picks up the new source image
+            m_baselineImageCache->Invalidate(cacheFilePath);
+
             // Since we just replaced the baseline image, we can update this screenshot test result as an exact match.
             // This will update the ImGui report dialog by the next frame.
             ClearImageComparisonResult(screenshotTest.m_officialComparisonResult);
+            OnScreenshotResultChanged(screenshotTest);
         }
 
         if (showResultDialog)
@@ -1013,6 +1201,29 @@ namespace AtomSampleViewer
         comparisonResult.m_diffScore = 0.0f;
     }
 
+    void ScriptReporter::OnScreenshotResultChanged(ScreenshotTestInfo& screenshotTest)
+    {
+        const ReportIndex reportIndex = screenshotTest.m_officialSortedEntry->second;
+
+        // This will catch any false-negatives that could occur if the screenshot failure error messages change without also updating ScriptReport::OnPreError()
+        const ImageComparisonResult::ResultCode officialResultCode = screenshotTest.m_officialComparisonResult.m_resultCode;
+        if (officialResultCode != ImageComparisonResult::ResultCode::Pass &&
+            officialResultCode != ImageComparisonResult::ResultCode::Pending &&
+            officialResultCode != ImageComparisonResult::ResultCode::Skipped &&
+            officialResultCode != ImageComparisonResult::ResultCode::None)
+        {
+            AZ_Assert(m_scriptReports[reportIndex.first].m_screenshotErrorCount > 0, "If screenshot comparison failed in any way, m_screenshotErrorCount should be non-zero.");
+        }
+
+        m_reportsSortedByOfficialBaslineScore.erase(screenshotTest.m_officialSortedEntry);
+        m_reportsSortedByLocaBaslineScore.erase(screenshotTest.m_localSortedEntry);
+        screenshotTest.m_officialSortedEntry = m_reportsSortedByOfficialBaslineScore.emplace(screenshotTest.m_officialComparisonResult.m_diffScore, reportIndex);
+        screenshotTest.m_localSortedEntry = m_reportsSortedByLocaBaslineScore.emplace(screenshotTest.m_localComparisonResult.m_diffScore, reportIndex);
+
+        screenshotTest.m_reportRow.m_isDirty = true;
+        m_visibleRowsDirty = true;
+    }
+
     void ScriptReporter::ShowUpdateLocalBaselineResult(int successCount, int failureCount)
     {
         AZStd::string message;
@@ -1059,16 +1270,25 @@ namespace AtomSampleViewer
 
         ScreenshotTestInfo& screenshotTestInfo = GetCurrentScriptReport()->m_screenshotTests.back();
 
+        if (screenshotTestInfo.m_officialComparisonResult.m_resultCode == ImageComparisonResult::ResultCode::Skipped)
+        {
+            return;
+        }
+
         if (toleranceLevel == nullptr)
         {
             screenshotTestInfo.m_officialComparisonResult.m_resultCode = ImageComparisonResult::ResultCode::NullImageComparisonToleranceLevel;
             ReportScriptError("Screenshot check failed. No ImageComparisonToleranceLevel provided.");
+            OnScreenshotResultChanged(screenshotTestInfo);
             return;
         }
 
         auto io = AZ::IO::LocalFileIO::GetInstance();
         screenshotTestInfo.m_toleranceLevel = *toleranceLevel;
-        static constexpr float ImperceptibleDiffFilter = 0.01;
+
+        AZStd::shared_ptr<PendingScreenshotCheck> check = AZStd::make_shared<PendingScreenshotCheck>();
+        check->m_reportIndex = ReportIndex{ m_currentScriptIndexStack.back(), GetCurrentScriptReport()->m_screenshotTests.size() - 1 };
+        check->m_screenshotFilePath = screenshotTestInfo.m_screenshotFilePath;
 
         if (screenshotTestInfo.m_officialBaselineScreenshotFilePath.empty()
             || !io->Exists(screenshotTestInfo.m_officialBaselineScreenshotFilePath.c_str()))
@@ -1078,141 +1298,602 @@ namespace AtomSampleViewer
         }
         else
         {
-            AZ::Render::FrameCaptureComparisonOutcome compOutcome;
-            AZ::Render::FrameCaptureTestRequestBus::BroadcastResult(
-                compOutcome,
-                &AZ::Render::FrameCaptureTestRequestBus::Events::CompareScreenshots,
-                screenshotTestInfo.m_screenshotFilePath,
-                screenshotTestInfo.m_officialBaselineScreenshotFilePath,
-                ImperceptibleDiffFilter
-            );
+            check->m_officialBaselineFilePath = screenshotTestInfo.m_officialBaselineScreenshotFilePath;
+            screenshotTestInfo.m_officialComparisonResult.m_resultCode = ImageComparisonResult::ResultCode::Pending;
+            screenshotTestInfo.m_officialComparisonResult.m_diffScore = 0.0f;
+        }
 
-            screenshotTestInfo.m_officialComparisonResult.m_diffScore = 0.0;
+        if (screenshotTestInfo.m_localBaselineScreenshotFilePath.empty()
+            || !io->Exists(screenshotTestInfo.m_localBaselineScreenshotFilePath.c_str()))
+        {
+            ReportScriptWarning(AZStd::string::format("Screenshot check failed. Could not determine local baseline screenshot path for '%s'", screenshotTestInfo.m_screenshotFilePath.c_str()));
+            screenshotTestInfo.m_localComparisonResult.m_resultCode = ImageComparisonResult::ResultCode::FileNotFound;
+        }
+        else
+        {
+            check->m_localBaselineFilePath = screenshotTestInfo.m_localBaselineScreenshotFilePath;
+            screenshotTestInfo.m_localComparisonResult.m_resultCode = ImageComparisonResult::ResultCode::Pending;
+            screenshotTestInfo.m_localComparisonResult.m_diffScore = 0.0f;
+        }
 
-            if (compOutcome.IsSuccess())
-            {
-                screenshotTestInfo.m_officialComparisonResult.m_diffScore = toleranceLevel->m_filterImperceptibleDiffs
-                    ? compOutcome.GetValue().m_diffScore
-                    : compOutcome.GetValue().m_filteredDiffScore;
+        OnScreenshotResultChanged(screenshotTestInfo);
+
+        if (check->m_officialBaselineFilePath.empty() && check->m_localBaselineFilePath.empty())
+        {
+            return;
+        }
+
+        m_pendingScreenshotChecks.push_back(check);
 
-                if (screenshotTestInfo.m_officialComparisonResult.m_diffScore <= toleranceLevel->m_threshold)
+        // Loading and diffing the PNGs is the slow part, so it runs on the job system while the script carries on.
+        // Without worker threads there is nothing to overlap with, so just do the work here.
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        if (jobContext && jobContext->GetJobManager().GetNumWorkerThreads() > 0)
+        {
+            AZ::Job* job = AZ::CreateJobFunction([check, baselineCache = m_baselineImageCache]()
                 {
-                    screenshotTestInfo.m_officialComparisonResult.m_resultCode = ImageComparisonResult::ResultCode::Pass;
-                }
-                else
+                    RunScreenshotCheck(*check, *baselineCache);
+                }, true, jobContext);
+            job->Start();
+        }
+        else
+        {
+            RunScreenshotCheck(*check, *m_baselineImageCache);
+        }
+    }
+
+    ScriptReporter::ScreenshotComparisonOutcome ScriptReporter::CompareScreenshotToBaseline(
+        const AZ::Utils::PngFile& screenshot, BaselineImageCache& baselineCache, const AZStd::string& baselineFilePath)
+    {
+        using namespace AZ::Utils;
+
+        // Differences smaller than this are considered imperceptible, see ImageComparisonToleranceLevel::m_filterImperceptibleDiffs
+        static constexpr float ImperceptibleDiffFilter = 0.01f;
+
+        ScreenshotComparisonOutcome outcome;
+
+        if (!screenshot.IsValid())
+        {
+            outcome.m_resultCode = ImageComparisonResult::ResultCode::FileNotLoaded;
+            return outcome;
+        }
+
+        if (screenshot.GetBufferFormat() != PngFile::Format::RGBA)
+        {
+            outcome.m_resultCode = ImageComparisonResult::ResultCode::WrongFormat;
+            return outcome;
+        }
+
+        // The cache only returns RGBA8 images, anything else fails to load
+        BaselineImageCache::ImagePtr baseline = baselineCache.Load(baselineFilePath);
+        if (!baseline)
+        {
+            outcome.m_resultCode = ImageComparisonResult::ResultCode::FileNotLoaded;
+            return outcome;
+        }
+
+        const ImageDiffResult diffResult = CalcImageDiffRms(
+            screenshot.GetBuffer(), AZ::RHI::Size(screenshot.GetWidth(), screenshot.GetHeight(), 1), AZ::RHI::Format::R8G8B8A8_UNORM,
+            baseline->m_buffer, AZ::RHI::Size(baseline->m_width, baseline->m_height, 1), AZ::RHI::Format::R8G8B8A8_UNORM,
+            ImperceptibleDiffFilter);
+
+        switch (diffResult.m_resultCode)
+        {
+        case ImageDiffResultCode::Success:
+            outcome.m_resultCode = ImageComparisonResult::ResultCode::Pass;
+            outcome.m_diffScore = diffResult.m_diffScore;
+            outcome.m_filteredDiffScore = diffResult.m_filteredDiffScore;
+            break;
+        case ImageDiffResultCode::SizeMismatch:
+            outcome.m_resultCode = ImageComparisonResult::ResultCode::WrongSize;
+            break;
+        default:
+            outcome.m_resultCode = ImageComparisonResult::ResultCode::WrongFormat;
+            break;
+        }
+
+        return outcome;
+    }
+
+    ScriptReporter::ScreenshotComparisonOutcome ScriptReporter::CompareScreenshotToLocalBaseline(
+        const AZ::Utils::PngFile& screenshot, BaselineImageCache& baselineCache, const AZStd::string& baselineFilePath)
+    {
+        if (!screenshot.IsValid() || screenshot.GetBufferFormat() != AZ::Utils::PngFile::Format::RGBA)
+        {
+            return CompareScreenshotToBaseline(screenshot, baselineCache, baselineFilePath);
+        }
+
+        const ImageSignature screenshotSignature = ImageSignature::Compute(screenshot.GetBuffer(), screenshot.GetWidth(), screenshot.GetHeight());
+
+        ImageSignature baselineSignature;
+        if (baselineSignature.Load(baselineFilePath) && baselineSignature.IsComparableTo(screenshotSignature))
+        {
+            ScreenshotComparisonOutcome outcome;
+            outcome.m_resultCode = ImageComparisonResult::ResultCode::Pass;
+
+            if (baselineSignature.m_contentHash == screenshotSignature.m_contentHash)
+            {
+                // Identical, no need to look at the baseline pixels at all
+                return outcome;
+            }
+
+            BaselineImageCache::ImagePtr baseline = baselineCache.Load(baselineFilePath);
+            if (!baseline || baseline->m_buffer.size() != screenshot.GetBuffer().size())
+            {
+                // The baseline changed between reading its signature and its pixels; fall back to a full comparison
+                return CompareScreenshotToBaseline(screenshot, baselineCache, baselineFilePath);
+            }
+
+            outcome.m_diffScore = ImageSignature::CalcDiffRmsOfMismatchedTiles(screenshotSignature, screenshot.GetBuffer(), baselineSignature, baseline->m_buffer);
+            return outcome;
+        }
+
+        // There's no usable signature, so do the full comparison and store the baseline's signature for next time
+        const ScreenshotComparisonOutcome outcome = CompareScreenshotToBaseline(screenshot, baselineCache, baselineFilePath);
+
+        if (BaselineImageCache::ImagePtr baseline = baselineCache.Load(baselineFilePath))
+        {
+            ImageSignature::Compute(baseline->m_buffer, baseline->m_width, baseline->m_height).Save(baselineFilePath);
+        }
+
+        return outcome;
+    }
+
+    void ScriptReporter::RunScreenshotCheck(PendingScreenshotCheck& check, BaselineImageCache& baselineCache)
+    {
+        // The screenshot is new every time so it isn't cached, but it's only decoded once for both baselines
+        const AZ::Utils::PngFile screenshot = AZ::Utils::PngFile::Load(check.m_screenshotFilePath.c_str());
+
+        if (!check.m_officialBaselineFilePath.empty())
+        {
+            check.m_officialOutcome = CompareScreenshotToBaseline(screenshot, baselineCache, check.m_officialBaselineFilePath);
+        }
+
+        if (!check.m_localBaselineFilePath.empty())
+        {
+            check.m_localOutcome = CompareScreenshotToLocalBaseline(screenshot, baselineCache, check.m_localBaselineFilePath);
+        }
+
+        check.m_isComplete = true;
+        check.m_completeSignal.release();
+    }
+
+    void ScriptReporter::RecordScreenshotCheckResults(const PendingScreenshotCheck& check)
+    {
+        const auto [scriptIndex, screenshotIndex] = check.m_reportIndex;
+        if (scriptIndex >= m_scriptReports.size() || screenshotIndex >= m_scriptReports[scriptIndex].m_screenshotTests.size())
+        {
+            // The report was reset while the comparison was running
+            return;
+        }
+
+        ScreenshotTestInfo& screenshotTestInfo = m_scriptReports[scriptIndex].m_screenshotTests[screenshotIndex];
+        const ImageComparisonToleranceLevel& toleranceLevel = screenshotTestInfo.m_toleranceLevel;
+
+        if (!check.m_officialBaselineFilePath.empty())
+        {
+            const ScreenshotComparisonOutcome& outcome = check.m_officialOutcome;
+            ImageComparisonResult& result = screenshotTestInfo.m_officialComparisonResult;
+
+            result.m_diffScore = 0.0f;
+            result.m_resultCode = outcome.m_resultCode;
+
+            if (outcome.m_resultCode == ImageComparisonResult::ResultCode::Pass)
+            {
+                result.m_diffScore = toleranceLevel.m_filterImperceptibleDiffs
+                    ? outcome.m_diffScore
+                    : outcome.m_filteredDiffScore;
+
+                if (result.m_diffScore > toleranceLevel.m_threshold)
                 {
                     // Be aware there is an automation test script that looks for the "Screenshot check failed. Diff score" string text to report failures.
                     // If you change this message, be sure to update the associated tests as well located here: "C:/path/to/Lumberyard/AtomSampleViewer/Standalone/PythonTests"
                     ReportScreenshotComparisonIssue(
                         AZStd::string::format("Screenshot check failed. Diff score %f exceeds threshold of %f ('%s').",
-                            screenshotTestInfo.m_officialComparisonResult.m_diffScore, toleranceLevel->m_threshold, toleranceLevel->m_name.c_str()),
+                            result.m_diffScore, toleranceLevel.m_threshold, toleranceLevel.m_name.c_str()),
                         screenshotTestInfo.m_officialBaselineScreenshotFilePath,
                         screenshotTestInfo.m_screenshotFilePath,
                         TraceLevel::Error);
-                    screenshotTestInfo.m_officialComparisonResult.m_resultCode = ImageComparisonResult::ResultCode::ThresholdExceeded;
+                    result.m_resultCode = ImageComparisonResult::ResultCode::ThresholdExceeded;
                 }
             }
+            else
+            {
+                ReportScreenshotComparisonIssue(
+                    AZStd::string::format("Screenshot check failed. %s.", result.GetSummaryString().c_str()),
+                    screenshotTestInfo.m_officialBaselineScreenshotFilePath,
+                    screenshotTestInfo.m_screenshotFilePath,
+                    TraceLevel::Error);
+            }
         }
 
-        if (screenshotTestInfo.m_localBaselineScreenshotFilePath.empty()
-            || !io->Exists(screenshotTestInfo.m_localBaselineScreenshotFilePath.c_str()))
-        {
-            ReportScriptWarning(AZStd::string::format("Screenshot check failed. Could not determine local baseline screenshot path for '%s'", screenshotTestInfo.m_screenshotFilePath.c_str()));
-            screenshotTestInfo.m_localComparisonResult.m_resultCode = ImageComparisonResult::ResultCode::FileNotFound;
-        }
-        else
+        if (!check.m_localBaselineFilePath.empty())
         {
             // Local screenshots should be expected match 100% every time, otherwise warnings are reported. This will help developers track and investigate changes,
             // for example if they make local changes that impact some unrelated AtomSampleViewer sample in an unexpected way, they will see a warning about this.
-            AZ::Render::FrameCaptureComparisonOutcome compOutcome;
-            AZ::Render::FrameCaptureTestRequestBus::BroadcastResult(
-                compOutcome,
-                &AZ::Render::FrameCaptureTestRequestBus::Events::CompareScreenshots,
-                screenshotTestInfo.m_screenshotFilePath,
-                screenshotTestInfo.m_localBaselineScreenshotFilePath,
-                ImperceptibleDiffFilter
-            );
+            const ScreenshotComparisonOutcome& outcome = check.m_localOutcome;
+            ImageComparisonResult& result = screenshotTestInfo.m_localComparisonResult;
 
-            screenshotTestInfo.m_localComparisonResult.m_diffScore = 0.0f;
+            result.m_diffScore = 0.0f;
+            result.m_resultCode = outcome.m_resultCode;
 
-            if (compOutcome.IsSuccess())
+            if (outcome.m_resultCode == ImageComparisonResult::ResultCode::Pass)
             {
-                screenshotTestInfo.m_localComparisonResult.m_diffScore = compOutcome.GetValue().m_diffScore;
+                result.m_diffScore = outcome.m_diffScore;
 
-                if (screenshotTestInfo.m_localComparisonResult.m_diffScore == 0.0f)
-                {
-                    screenshotTestInfo.m_localComparisonResult.m_resultCode = ImageComparisonResult::ResultCode::Pass;
-                }
-                else
+                if (result.m_diffScore != 0.0f)
                 {
                     ReportScreenshotComparisonIssue(
-                        AZStd::string::format("Screenshot check failed. Screenshot does not match the local baseline; something has changed. Diff score is %f.", screenshotTestInfo.m_localComparisonResult.m_diffScore),
+                        AZStd::string::format("Screenshot check failed. Screenshot does not match the local baseline; something has changed. Diff score is %f.", result.m_diffScore),
                         screenshotTestInfo.m_localBaselineScreenshotFilePath,
                         screenshotTestInfo.m_screenshotFilePath,
                         TraceLevel::Warning);
-                    screenshotTestInfo.m_localComparisonResult.m_resultCode = ImageComparisonResult::ResultCode::ThresholdExceeded;
+                    result.m_resultCode = ImageComparisonResult::ResultCode::ThresholdExceeded;
                 }
             }
+            else
+            {
+                ReportScreenshotComparisonIssue(
+                    AZStd::string::format("Screenshot check failed. Screenshot does not match the local baseline; %s.", result.GetSummaryString().c_str()),
+                    screenshotTestInfo.m_localBaselineScreenshotFilePath,
+                    screenshotTestInfo.m_screenshotFilePath,
+                    TraceLevel::Warning);
+            }
+        }
+
+        OnScreenshotResultChanged(screenshotTestInfo);
+    }
+
+    void ScriptReporter::ProcessCompletedScreenshotChecks()
+    {
+        // Results are recorded strictly in queue order so the log reads the same as when comparisons were synchronous
+        while (!m_pendingScreenshotChecks.empty() && m_pendingScreenshotChecks.front()->m_isComplete)
+        {
+            AZStd::shared_ptr<PendingScreenshotCheck> check = AZStd::move(m_pendingScreenshotChecks.front());
+            m_pendingScreenshotChecks.pop_front();
+            RecordScreenshotCheckResults(*check);
+        }
+    }
+
+    void ScriptReporter::WaitForScreenshotChecks()
+    {
+        while (!m_pendingScreenshotChecks.empty())
+        {
+            AZStd::shared_ptr<PendingScreenshotCheck> check = AZStd::move(m_pendingScreenshotChecks.front());
+            m_pendingScreenshotChecks.pop_front();
+
+            if (!check->m_isComplete)
+            {
+                check->m_completeSignal.acquire();
+            }
+
+            RecordScreenshotCheckResults(*check);
         }
     }
 
+    bool ScriptReporter::HasPendingScreenshotChecks() const
+    {
+        return !m_pendingScreenshotChecks.empty();
+    }
+
     void ScriptReporter::ExportTestResults()
     {
         m_exportedTestResultsPath = GenerateAndCreateExportedTestResultsPath();
+
+        // The whole report is built up front so the file is opened and written once
+        AZStd::string log;
+        for (const ScriptReport& scriptReport : m_scriptReports)
+        {
+            log += AZStd::string::format("Script: %s \n", scriptReport.m_scriptAssetPath.c_str());
+            log += AZStd::string::format("Asserts: %u \n", scriptReport.m_assertCount);
+            log += AZStd::string::format("Errors: %u \n", scriptReport.m_generalErrorCount);
+            log += AZStd::string::format("Warnings: %u \n", scriptReport.m_generalWarningCount);
+            log += AZStd::string::format("Screenshot errors: %u \n", scriptReport.m_screenshotErrorCount);
+            log += AZStd::string::format("Screenshot warnings: %u \n", scriptReport.m_screenshotWarningCount);
+            log += "\nScreenshot test info below.\n";
+
+            for (const ScreenshotTestInfo& screenshotTest : scriptReport.m_screenshotTests)
+            {
+                log += "Test screenshot path: " + screenshotTest.m_screenshotFilePath + " \n";
+                log += "Official baseline screenshot path: " + screenshotTest.m_officialBaselineScreenshotFilePath + " \n";
+                log += "Tolerance level: " + screenshotTest.m_toleranceLevel.ToString() + " \n";
+                log += "Image comparison result: " + screenshotTest.m_officialComparisonResult.GetSummaryString() + " \n";
+            }
+
+            log += "\n";
+        }
+
+        AZ::IO::HandleType logHandle;
+        auto io = AZ::IO::LocalFileIO::GetInstance();
+        if (!io->Open(m_exportedTestResultsPath.c_str(), AZ::IO::OpenMode::ModeWrite, logHandle))
+        {
+            m_messageBox.OpenPopupMessage("Export failed", AZStd::string::format("Could not open %s", m_exportedTestResultsPath.c_str()));
+            return;
+        }
+
+        io->Write(logHandle, log.c_str(), log.size());
+        io->Close(logHandle);
+
+        m_messageBox.OpenPopupMessage("Exported test results", AZStd::string::format("Results exported to %s", m_exportedTestResultsPath.c_str()));
+        AZ_Printf("ScriptReporter", "Test results exported to %s \n", m_exportedTestResultsPath.c_str());
+    }
+
+    void ScriptReporter::RecordTestDuration(const AZStd::string& testName, double seconds)
+    {
+        m_testDurations[testName] = seconds;
+    }
+
+    bool ScriptReporter::ExportTestResultsJson(const AZStd::string& filePath) const
+    {
+        rapidjson::Document document;
+        document.SetObject();
+        auto& allocator = document.GetAllocator();
+
+        rapidjson::Value scripts(rapidjson::kArrayType);
         for (const ScriptReport& scriptReport : m_scriptReports)
         {
-            const AZStd::string assertLogLine = AZStd::string::format("Asserts: %u \n", scriptReport.m_assertCount);
-            const AZStd::string errorsLogLine = AZStd::string::format("Errors: %u \n", scriptReport.m_generalErrorCount);
-            const AZStd::string warningsLogLine = AZStd::string::format("Warnings: %u \n", scriptReport.m_generalWarningCount);
-            const AZStd::string screenshotErrorsLogLine = AZStd::string::format("Screenshot errors: %u \n", scriptReport.m_screenshotErrorCount);
-            const AZStd::string screenshotWarningsLogLine = AZStd::string::format("Screenshot warnings: %u \n", scriptReport.m_screenshotWarningCount);
-            const AZStd::string failedScreenshotsLogLine = "\nScreenshot test info below.\n";
-            
-            AZ::IO::HandleType logHandle;
-            auto io = AZ::IO::LocalFileIO::GetInstance();
-            if (io->Open(m_exportedTestResultsPath.c_str(), AZ::IO::OpenMode::ModeWrite, logHandle))
+            rapidjson::Value script(rapidjson::kObjectType);
+            script.AddMember("path", rapidjson::Value(scriptReport.m_scriptAssetPath.c_str(), allocator), allocator);
+            script.AddMember("durationSeconds", scriptReport.m_durationSeconds, allocator);
+            script.AddMember("asserts", scriptReport.m_assertCount, allocator);
+            script.AddMember("errors", scriptReport.m_generalErrorCount, allocator);
+            script.AddMember("warnings", scriptReport.m_generalWarningCount, allocator);
+            script.AddMember("screenshotErrors", scriptReport.m_screenshotErrorCount, allocator);
+            script.AddMember("screenshotWarnings", scriptReport.m_screenshotWarningCount, allocator);
+
+            rapidjson::Value screenshots(rapidjson::kArrayType);
+            for (const ScreenshotTestInfo& screenshotTest : scriptReport.m_screenshotTests)
             {
-                io->Write(logHandle, assertLogLine.c_str(), assertLogLine.size());
-                io->Write(logHandle, errorsLogLine.c_str(), errorsLogLine.size());
-                io->Write(logHandle, warningsLogLine.c_str(), warningsLogLine.size());
-                io->Write(logHandle, screenshotErrorsLogLine.c_str(), screenshotErrorsLogLine.size());
-                io->Write(logHandle, screenshotWarningsLogLine.c_str(), screenshotWarningsLogLine.size());
-                io->Write(logHandle, failedScreenshotsLogLine.c_str(), failedScreenshotsLogLine.size());
-
-                for (const ScreenshotTestInfo& screenshotTest : scriptReport.m_screenshotTests)
+                rapidjson::Value screenshot(rapidjson::kObjectType);
+                screenshot.AddMember("screenshot", rapidjson::Value(screenshotTest.m_screenshotFilePath.c_str(), allocator), allocator);
+                screenshot.AddMember("officialBaseline", rapidjson::Value(screenshotTest.m_officialBaselineScreenshotFilePath.c_str(), allocator), allocator);
+                screenshot.AddMember("toleranceLevel", rapidjson::Value(screenshotTest.m_toleranceLevel.ToString().c_str(), allocator), allocator);
+                screenshot.AddMember("result", rapidjson::Value(screenshotTest.m_officialComparisonResult.GetSummaryString().c_str(), allocator), allocator);
+                screenshots.PushBack(screenshot, allocator);
+            }
+            script.AddMember("screenshots", screenshots, allocator);
+
+            scripts.PushBack(script, allocator);
+        }
+        document.AddMember("scripts", scripts, allocator);
+
+        rapidjson::Value testDurations(rapidjson::kObjectType);
+        for (const auto& [testName, seconds] : m_testDurations)
+        {
+            testDurations.AddMember(rapidjson::Value(testName.c_str(), allocator), rapidjson::Value(seconds), allocator);
+        }
+        document.AddMember("testDurations", testDurations, allocator);
+
+        AZStd::string folderPath;
+        AzFramework::StringFunc::Path::GetFolderPath(filePath.c_str(), folderPath);
+        AZ::IO::LocalFileIO::GetInstance()->CreatePath(folderPath.c_str());
+
+        auto writeResult = AZ::JsonSerializationUtils::WriteJsonFile(document, filePath);
+        if (!writeResult.IsSuccess())
+        {
+            AZ_Error("ScriptReporter", false, "Failed to export test results to '%s': %s", filePath.c_str(), writeResult.GetError().c_str());
+            return false;
+        }
+
+        AZ_Printf("ScriptReporter", "Test results exported to %s\n", filePath.c_str());
+        return true;
+    }
+
+    bool ScriptReporter::BeginResultsStream(const AZStd::string& filePath)
+    {
+        if (!m_resultsStream.Open(filePath))
+        {
+            return false;
+        }
+
+        AZ_Printf("ScriptReporter", "Streaming test results to %s\n", filePath.c_str());
+        return true;
+    }
+
+    void ScriptReporter::EndResultsStream()
+    {
+        m_resultsStream.Close();
+    }
+
+    void ScriptReporter::StreamScriptReport(const ScriptReport& scriptReport)
+    {
+        if (!m_resultsStream.IsOpen())
+        {
+            return;
+        }
+
+        // One buffer and writer are reused for every line, they are only formatted here and handed off to the stream's thread
+        rapidjson::StringBuffer buffer;
+        auto writeLine = [this, &buffer](auto&& writeRecord)
+        {
+            buffer.Clear();
+            rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+            writer.StartObject();
+            writeRecord(writer);
+            writer.EndObject();
+            m_resultsStream.WriteLine(AZStd::string(buffer.GetString(), buffer.GetSize()));
+        };
+
+        for (const ScreenshotTestInfo& screenshotTest : scriptReport.m_screenshotTests)
+        {
+            writeLine([&](rapidjson::Writer<rapidjson::StringBuffer>& writer)
                 {
-                    const AZStd::string screenshotPath = AZStd::string::format("Test screenshot path: %s \n", screenshotTest.m_screenshotFilePath.c_str());
-                    const AZStd::string officialBaselineScreenshotPath = AZStd::string::format("Official baseline screenshot path: %s \n", screenshotTest.m_officialBaselineScreenshotFilePath.c_str());
-                    const AZStd::string toleranceLevelLogLine = AZStd::string::format("Tolerance level: %s \n", screenshotTest.m_toleranceLevel.ToString().c_str());
-                    const AZStd::string officialComparisonLogLine = AZStd::string::format("Image comparison result: %s \n", screenshotTest.m_officialComparisonResult.GetSummaryString().c_str());
+                    writer.Key("type");
+                    writer.String("screenshot");
+                    writer.Key("script");
+                    writer.String(scriptReport.m_scriptAssetPath.c_str(), aznumeric_cast<rapidjson::SizeType>(scriptReport.m_scriptAssetPath.size()));
+                    writer.Key("screenshot");
+                    writer.String(screenshotTest.m_screenshotFilePath.c_str(), aznumeric_cast<rapidjson::SizeType>(screenshotTest.m_screenshotFilePath.size()));
+                    writer.Key("officialBaseline");
+                    writer.String(screenshotTest.m_officialBaselineScreenshotFilePath.c_str(), aznumeric_cast<rapidjson::SizeType>(screenshotTest.m_officialBaselineScreenshotFilePath.size()));
+                    writer.Key("toleranceLevel");
+                    writer.String(screenshotTest.m_toleranceLevel.m_name.c_str(), aznumeric_cast<rapidjson::SizeType>(screenshotTest.m_toleranceLevel.m_name.size()));
+                    writer.Key("threshold");
+                    writer.Double(screenshotTest.m_toleranceLevel.m_threshold);
+                    writer.Key("result");
+                    writer.String(GetResultCodeName(screenshotTest.m_officialComparisonResult.m_resultCode));
+                    writer.Key("diffScore");
+                    writer.Double(screenshotTest.m_officialComparisonResult.m_diffScore);
+                    writer.Key("localResult");
+                    writer.String(GetResultCodeName(screenshotTest.m_localComparisonResult.m_resultCode));
+                    writer.Key("localDiffScore");
+                    writer.Double(screenshotTest.m_localComparisonResult.m_diffScore);
+                });
+        }
+
+        writeLine([&](rapidjson::Writer<rapidjson::StringBuffer>& writer)
+            {
+                writer.Key("type");
+                writer.String("script");
+                writer.Key("path");
+                writer.String(scriptReport.m_scriptAssetPath.c_str(), aznumeric_cast<rapidjson::SizeType>(scriptReport.m_scriptAssetPath.size()));
+                writer.Key("durationSeconds");
+                writer.Double(scriptReport.m_durationSeconds);
+                writer.Key("asserts");
+                writer.Uint(scriptReport.m_assertCount);
+                writer.Key("errors");
+                writer.Uint(scriptReport.m_generalErrorCount);
+                writer.Key("warnings");
+                writer.Uint(scriptReport.m_generalWarningCount);
+                writer.Key("screenshotErrors");
+                writer.Uint(scriptReport.m_screenshotErrorCount);
+                writer.Key("screenshotWarnings");
+                writer.Uint(scriptReport.m_screenshotWarningCount);
+                writer.Key("screenshots");
+                writer.Uint(aznumeric_cast<unsigned>(scriptReport.m_screenshotTests.size()));
+            });
+    }
+
+    bool ScriptReporter::ExportJUnitXml(const AZStd::string& filePath) const
+    {
+        auto isScreenshotFailed = [](const ScreenshotTestInfo& screenshotTest)
+        {
+            const ImageComparisonResult::ResultCode resultCode = screenshotTest.m_officialComparisonResult.m_resultCode;
+            return resultCode != ImageComparisonResult::ResultCode::Pass && resultCode != ImageComparisonResult::ResultCode::Skipped;
+        };
+
+        AZStd::string suites;
+        uint32_t totalTests = 0;
+        uint32_t totalFailures = 0;
+        uint32_t totalSkipped = 0;
+        double totalSeconds = 0.0;
+
+        for (const ScriptReport& scriptReport : m_scriptReports)
+        {
+            const bool scriptFailed = scriptReport.m_assertCount > 0 || scriptReport.m_generalErrorCount > 0;
 
-                    io->Write(logHandle, toleranceLevelLogLine.c_str(), toleranceLevelLogLine.size());
-                    io->Write(logHandle, officialComparisonLogLine.c_str(), officialComparisonLogLine.size());
+            uint32_t failures = scriptFailed ? 1 : 0;
+            uint32_t skipped = 0;
+            for (const ScreenshotTestInfo& screenshotTest : scriptReport.m_screenshotTests)
+            {
+                failures += isScreenshotFailed(screenshotTest) ? 1 : 0;
+                skipped += screenshotTest.m_officialComparisonResult.m_resultCode == ImageComparisonResult::ResultCode::Skipped ? 1 : 0;
+            }
+            const uint32_t tests = 1 + aznumeric_cast<uint32_t>(scriptReport.m_screenshotTests.size());
+
+            suites += "  <testsuite name=\"";
+            AppendXmlEscaped(suites, scriptReport.m_scriptAssetPath);
+            suites += AZStd::string::format("\" tests=\"%u\" failures=\"%u\" skipped=\"%u\" time=\"%.3f\">\n",
+                tests, failures, skipped, scriptReport.m_durationSeconds);
+
+            suites += "    <testcase classname=\"";
+            AppendXmlEscaped(suites, scriptReport.m_scriptAssetPath);
+            suites += AZStd::string::format("\" name=\"script\" time=\"%.3f\">", scriptReport.m_durationSeconds);
+            if (scriptFailed)
+            {
+                suites += AZStd::string::format("\n      <failure message=\"%u asserts, %u errors\"/>\n    ",
+                    scriptReport.m_assertCount, scriptReport.m_generalErrorCount);
+            }
+            suites += "</testcase>\n";
+
+            for (const ScreenshotTestInfo& screenshotTest : scriptReport.m_screenshotTests)
+            {
+                AZStd::string fileName;
+                AzFramework::StringFunc::Path::GetFullFileName(screenshotTest.m_screenshotFilePath.c_str(), fileName);
+
+                suites += "    <testcase classname=\"";
+                AppendXmlEscaped(suites, scriptReport.m_scriptAssetPath);
+                suites += "\" name=\"";
+                AppendXmlEscaped(suites, fileName);
+                suites += "\">";
+
+                if (screenshotTest.m_officialComparisonResult.m_resultCode == ImageComparisonResult::ResultCode::Skipped)
+                {
+                    suites += "<skipped/>";
                 }
-                io->Close(logHandle);
+                else if (isScreenshotFailed(screenshotTest))
+                {
+                    suites += "\n      <failure type=\"";
+                    suites += GetResultCodeName(screenshotTest.m_officialComparisonResult.m_resultCode);
+                    suites += "\" message=\"";
+                    AppendXmlEscaped(suites, screenshotTest.m_officialComparisonResult.GetSummaryString());
+                    suites += "\">";
+                    AppendXmlEscaped(suites, AZStd::string::format("Tolerance: %s\nExpected: %s\nActual: %s",
+                        screenshotTest.m_toleranceLevel.ToString().c_str(),
+                        screenshotTest.m_officialBaselineScreenshotFilePath.c_str(),
+                        screenshotTest.m_screenshotFilePath.c_str()));
+                    suites += "</failure>\n    ";
+                }
+
+                suites += "</testcase>\n";
             }
-            m_messageBox.OpenPopupMessage("Exported test results", AZStd::string::format("Results exported to %s", m_exportedTestResultsPath.c_str()));
-            AZ_Printf("Test results exported to %s \n", m_exportedTestResultsPath.c_str());
+
+            suites += "  </testsuite>\n";
+
+            totalTests += tests;
+            totalFailures += failures;
+            totalSkipped += skipped;
+            totalSeconds += scriptReport.m_durationSeconds;
+        }
+
+        AZStd::string xml = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+        xml += AZStd::string::format("<testsuites name=\"AtomSampleViewer\" tests=\"%u\" failures=\"%u\" skipped=\"%u\" time=\"%.3f\">\n",
+            totalTests, totalFailures, totalSkipped, totalSeconds);
+        xml += suites;
+        xml += "</testsuites>\n";
+
+        AZ::IO::SystemFile file;
+        if (!file.Open(filePath.c_str(),
+            AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY) ||
+            file.Write(xml.data(), xml.size()) != xml.size())
+        {
+            AZ_Error("ScriptReporter", false, "Failed to write JUnit test results to '%s'.", filePath.c_str());
+            return false;
         }
+
+        AZ_Printf("ScriptReporter", "JUnit test results exported to %s\n", filePath.c_str());
+        return true;
     }
 
     void ScriptReporter::ExportImageDiff(const char* filePath, const ScreenshotTestInfo& screenshotTestInfo)
     {
         using namespace AZ::Utils;
-        PngFile officialBaseline = PngFile::Load(screenshotTestInfo.m_officialBaselineScreenshotFilePath.c_str());
+        BaselineImageCache::ImagePtr officialBaseline = m_baselineImageCache->Load(screenshotTestInfo.m_officialBaselineScreenshotFilePath);
         PngFile actualScreenshot = PngFile::Load(screenshotTestInfo.m_screenshotFilePath.c_str());
 
-        const size_t bufferSize = officialBaseline.GetBuffer().size();
+        if (!officialBaseline)
+        {
+            AZ_Error("ScriptReporter", false, "Can't export image diff, failed to load '%s'.", screenshotTestInfo.m_officialBaselineScreenshotFilePath.c_str());
+            return;
+        }
+
+        const size_t bufferSize = officialBaseline->m_buffer.size();
 
-        AZStd::vector<uint8_t> diffBuffer = AZStd::vector<uint8_t>(bufferSize);
-        GenerateImageDiff(officialBaseline.GetBuffer(), actualScreenshot.GetBuffer(), diffBuffer);
+        if (actualScreenshot.GetBuffer().size() != bufferSize)
+        {
+            AZ_Error("ScriptReporter", false, "Can't export image diff, '%s' and '%s' are not the same size.",
+                screenshotTestInfo.m_officialBaselineScreenshotFilePath.c_str(), screenshotTestInfo.m_screenshotFilePath.c_str());
+            return;
+        }
 
-        AZStd::vector<uint8_t> buffer = AZStd::vector<uint8_t>(bufferSize * 3);
-        memcpy(buffer.data(), officialBaseline.GetBuffer().data(), bufferSize);
+        // The exported image stacks baseline, actual and diff vertically. The diff is generated straight into the last third.
+        AZStd::vector<uint8_t> buffer(bufferSize * 3);
+        AZStd::span<uint8_t> stackedImages(buffer);
+        memcpy(buffer.data(), officialBaseline->m_buffer.data(), bufferSize);
         memcpy(buffer.data() + bufferSize, actualScreenshot.GetBuffer().data(), bufferSize);
-        memcpy(buffer.data() + bufferSize * 2, diffBuffer.data(), bufferSize);
+        GenerateImageDiff(officialBaseline->m_buffer, actualScreenshot.GetBuffer(), stackedImages.subspan(bufferSize * 2, bufferSize), officialBaseline->m_width);
 
-        PngFile imageDiff = PngFile::Create(AZ::RHI::Size(officialBaseline.GetWidth(), officialBaseline.GetHeight() * 3, 1), AZ::RHI::Format::R8G8B8A8_UNORM, buffer);
+        PngFile imageDiff = PngFile::Create(AZ::RHI::Size(officialBaseline->m_width, officialBaseline->m_height * 3, 1), AZ::RHI::Format::R8G8B8A8_UNORM, AZStd::move(buffer));
         imageDiff.Save(filePath);
     }
 
@@ -1240,26 +1921,9 @@ namespace AtomSampleViewer
         return exportFile;
     }
 
-    void ScriptReporter::GenerateImageDiff(AZStd::span<const uint8_t> img1, AZStd::span<const uint8_t> img2, AZStd::vector<uint8_t>& buffer)
+    void ScriptReporter::GenerateImageDiff(AZStd::span<const uint8_t> img1, AZStd::span<const uint8_t> img2, AZStd::span<uint8_t> buffer, uint32_t width)
     {
-        static constexpr size_t BytesPerPixel = 4;
-        static constexpr float MinDiffFilter = 0.01;
-        static constexpr uint8_t DefaultPixelValue = 122;
-
-        memset(buffer.data(), DefaultPixelValue, buffer.size() * sizeof(uint8_t));
-
-        for (size_t i = 0; i < img1.size(); i += BytesPerPixel)
-        {
-            const int16_t maxDiff = AZ::Utils::CalcMaxChannelDifference(img1, img2, i);
-
-            if (maxDiff / 255.0f > MinDiffFilter)
-            {
-                buffer[i] = aznumeric_cast<uint8_t>(maxDiff);
-                buffer[i + 1] = 0;
-                buffer[i + 2] = 0;
-            }
-            buffer[i + 3] = 255;
-        }
+        ImageDiff::GenerateImageDiff(img1, img2, buffer, width * ImageDiff::BytesPerPixel);
     }
 
     void ScriptReporter::HighlightColorSettings::UpdateColorSettings()
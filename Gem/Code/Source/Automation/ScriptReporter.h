@@ -9,11 +9,20 @@
 #pragma once
 
 #include <AzCore/Debug/TraceMessageBus.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/map.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/semaphore.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzFramework/StringFunc/StringFunc.h>
 #include <Atom/Feature/Utils/FrameCaptureBus.h>
 #include <Atom/Feature/Utils/FrameCaptureTestBus.h>
 #include <Atom/Utils/ImageComparison.h>
+#include <Automation/BaselineImageCache.h>
 #include <Automation/ImageComparisonConfig.h>
+#include <Automation/TestResultsStream.h>
 #include <Utils/ImGuiMessageBox.h>
 #include <Atom/Utils/PngFile.h>
 #include <imgui/imgui.h>
@@ -29,6 +38,7 @@ namespace AtomSampleViewer
     public:
         // currently set to track the ScriptReport index and the ScreenshotTestInfo index.
         using ReportIndex = AZStd::pair<size_t, size_t>;
+        using SortedReportIndexMap = AZStd::multimap<float, ReportIndex, AZStd::greater<float>>;
 
         static constexpr const char* TestResultsFolder = "TestResults";
         static constexpr const char* UserFolder = "user";
@@ -58,9 +68,25 @@ namespace AtomSampleViewer
         //! Indicates that a new screenshot is about to be captured.
         bool AddScreenshotTest(const AZStd::string& imageName);
 
+        //! Marks the latest screenshot test as skipped instead of capturing and checking it. This doesn't count as a failure.
+        void SkipLatestScreenshot(const AZStd::string& reason);
+
         //! Check the latest screenshot using default thresholds.
+        //! The comparisons against the official and local baselines are queued on the job system, so this returns before
+        //! the images have been loaded. The results show as pending until ProcessCompletedScreenshotChecks() records them.
         void CheckLatestScreenshot(const ImageComparisonToleranceLevel* comparisonPreset);
 
+        //! Records the results of any queued screenshot comparisons that have finished, in the order they were queued.
+        //! Failures are reported against the current script. Called once per frame by the ScriptManager.
+        void ProcessCompletedScreenshotChecks();
+
+        //! Blocks until every queued screenshot comparison has finished and its results have been recorded.
+        //! This is done automatically before the current script changes, so results are always attributed to the right script.
+        void WaitForScreenshotChecks();
+
+        //! Returns whether any screenshot comparisons are still queued or running.
+        bool HasPendingScreenshotChecks() const;
+
         //! Opens the script report dialog.
         //! This displays all the collected script reporting data, provides links to tools for analyzing data like
         //! viewing screenshot diffs. It can be left open during processing and will update in real-time.
@@ -94,13 +120,15 @@ namespace AtomSampleViewer
             enum class ResultCode
             {
                 None,
+                Pending,
                 Pass,
                 FileNotFound,
                 FileNotLoaded,
                 WrongSize,
                 WrongFormat,
                 NullImageComparisonToleranceLevel,
-                ThresholdExceeded
+                ThresholdExceeded,
+                Skipped //!< No screenshot was taken because nothing is rendered, see Utils::IsHeadless()
             };
 
             ResultCode m_resultCode = ResultCode::None;
@@ -113,6 +141,17 @@ namespace AtomSampleViewer
             AZStd::string GetSummaryString() const;
         };
 
+        //! What the report dialog shows for a screenshot test. The strings are only formatted again after the results change.
+        struct ScreenshotReportRow
+        {
+            AZStd::string m_scriptViewHeader;       //!< Header when listed under its script
+            AZStd::string m_officialScoreHeader;    //!< Header when sorted by the official baseline diff score
+            AZStd::string m_localScoreHeader;       //!< Header when sorted by the local baseline diff score
+            bool m_isDirty = true;
+            bool m_isExpandedInScriptView = false;  //!< Whether the row's tree node was open the last time it was shown under its script
+            bool m_isExpandedInSortedView = false;  //!< Whether the row's tree node was open the last time it was shown sorted by score
+        };
+
         //! Records all the information about a screenshot comparison test.
         struct ScreenshotTestInfo
         {
@@ -123,6 +162,10 @@ namespace AtomSampleViewer
             ImageComparisonResult m_officialComparisonResult;   //!< Result of comparing against the official baseline image, for reporting test failure
             ImageComparisonResult m_localComparisonResult;      //!< Result of comparing against a local baseline, for reporting warnings
 
+            ScreenshotReportRow m_reportRow;
+            SortedReportIndexMap::iterator m_officialSortedEntry; //!< This test's entry in the reporter's index sorted by official diff score
+            SortedReportIndexMap::iterator m_localSortedEntry;    //!< This test's entry in the reporter's index sorted by local diff score
+
             ScreenshotTestInfo(const AZStd::string& m_screenshotName);
         };
 
@@ -184,17 +227,41 @@ namespace AtomSampleViewer
             uint32_t m_screenshotWarningCount = 0;
 
             AZStd::vector<ScreenshotTestInfo> m_screenshotTests;
+            AZStd::vector<size_t> m_visibleScreenshotIndices; //!< The screenshot tests that pass the report dialog's display filter
+
+            AZStd::chrono::steady_clock::time_point m_startTime;
+            double m_durationSeconds = 0.0; //!< Wall time from PushScript() to PopScript(), including any nested scripts
         };
 
         const AZStd::vector<ScriptReport>& GetScriptReport() const { return m_scriptReports; }
 
+        //! Records the run time of a test that isn't a script of its own, e.g. a fast check of a sample in the test suite
+        void RecordTestDuration(const AZStd::string& testName, double seconds);
+        const AZStd::map<AZStd::string, double>& GetTestDurations() const { return m_testDurations; }
+
         // For exporting test results
         void ExportTestResults();
+
+        //! Writes the results of every script, and the durations from RecordTestDuration(), to a JSON file, so results from
+        //! several processes (e.g. test suite shards) can be merged.
+        //! @return whether the file was written
+        bool ExportTestResultsJson(const AZStd::string& filePath) const;
+
+        //! Starts streaming results to a JSON Lines file. Each time a script finishes, a line is written for each of its
+        //! screenshot tests followed by a line for the script itself, so CI can follow a long run while it is still going.
+        //! The lines are written on a background thread. Any previous stream is closed.
+        bool BeginResultsStream(const AZStd::string& filePath);
+
+        //! Writes any results still queued and closes the results stream.
+        void EndResultsStream();
+
+        //! Writes the results of every script as JUnit XML. Each script is a test suite, with a test case for the script's
+        //! asserts and errors and one for each screenshot test.
+        //! @return whether the file was written
+        bool ExportJUnitXml(const AZStd::string& filePath) const;
         void ExportImageDiff(const char* filePath, const ScreenshotTestInfo& screenshotTest);
         AZStd::string ExportImageDiff(const ScriptReport& scriptReport, const ScreenshotTestInfo& screenshotTest);
 
-        void SortScriptReports();
-
     private:
         static const ImGuiTreeNodeFlags FlagDefaultOpen = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_OpenOnDoubleClick | ImGuiTreeNodeFlags_DefaultOpen;
         static const ImGuiTreeNodeFlags FlagDefaultClosed = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_OpenOnDoubleClick;
@@ -229,6 +296,9 @@ namespace AtomSampleViewer
         static void ReportScriptIssue(const AZStd::string& message, TraceLevel traceLevel);
         static void ReportScreenshotComparisonIssue(const AZStd::string& message, const AZStd::string& expectedImageFilePath, const AZStd::string& actualImageFilePath, TraceLevel traceLevel);
 
+        // Queues the JSON lines for a script that just finished, see BeginResultsStream()
+        void StreamScriptReport(const ScriptReport& scriptReport);
+
         // Copies all captured screenshots to the local baseline folder. These can be used as an alternative to the central baseline for comparison.
         void UpdateAllLocalBaselineImages();
 
@@ -241,13 +311,69 @@ namespace AtomSampleViewer
         // Clears comparison result to passing with no errors or warnings
         void ClearImageComparisonResult(ImageComparisonResult& comparisonResult);
 
+        // Must be called whenever a screenshot test's results change. Moves the test to its new place in the sorted indices
+        // and marks its report dialog row to be formatted again.
+        void OnScreenshotResultChanged(ScreenshotTestInfo& screenshotTest);
+
         // Show a message box to let the user know the results of updating local baseline images
         void ShowUpdateLocalBaselineResult(int successCount, int failureCount);
 
         const ImageComparisonToleranceLevel* FindBestToleranceLevel(float diffScore, bool filterImperceptibleDiffs) const;
 
+        // Raw result of comparing a screenshot file against a baseline file, before any tolerance is applied
+        struct ScreenshotComparisonOutcome
+        {
+            ImageComparisonResult::ResultCode m_resultCode = ImageComparisonResult::ResultCode::None;
+            float m_diffScore = 0.0f;
+            float m_filteredDiffScore = 0.0f;
+        };
+
+        // A CheckLatestScreenshot() call whose comparisons are running on the job system.
+        // The job only touches this struct, which it shares with the reporter, so it never races with the report data.
+        struct PendingScreenshotCheck
+        {
+            ReportIndex m_reportIndex;
+            AZStd::string m_screenshotFilePath;
+            AZStd::string m_officialBaselineFilePath; //< Empty if the official baseline comparison was already resolved
+            AZStd::string m_localBaselineFilePath;    //< Empty if the local baseline comparison was already resolved
+            ScreenshotComparisonOutcome m_officialOutcome;
+            ScreenshotComparisonOutcome m_localOutcome;
+            AZStd::atomic_bool m_isComplete{ false };
+            AZStd::semaphore m_completeSignal;
+        };
+
+        // Computes the RMS diff scores between a decoded screenshot and a baseline from the cache. Safe to call from any thread.
+        static ScreenshotComparisonOutcome CompareScreenshotToBaseline(
+            const AZ::Utils::PngFile& screenshot, BaselineImageCache& baselineCache, const AZStd::string& baselineFilePath);
+
+        // Checks whether a decoded screenshot is identical to its local baseline. When the baseline has an up-to-date ImageSignature
+        // this is mostly a hash comparison, and only tiles with differing hashes are diffed. Only m_diffScore is computed.
+        static ScreenshotComparisonOutcome CompareScreenshotToLocalBaseline(
+            const AZ::Utils::PngFile& screenshot, BaselineImageCache& baselineCache, const AZStd::string& baselineFilePath);
+
+        // Runs the comparisons for a pending check and signals its completion
+        static void RunScreenshotCheck(PendingScreenshotCheck& check, BaselineImageCache& baselineCache);
+
+        // Applies the tolerance level to the outcomes of a completed check, fills in its ScreenshotTestInfo and reports any failures
+        void RecordScreenshotCheckResults(const PendingScreenshotCheck& check);
+
         void ShowReportDialog();
-        void ShowScreenshotTestInfoTreeNode(const AZStd::string& header, ScriptReport& scriptReport, ScreenshotTestInfo& screenshotResult);
+        // Returns whether the tree node is open
+        bool ShowScreenshotTestInfoTreeNode(const AZStd::string& header, ScriptReport& scriptReport, ScreenshotTestInfo& screenshotResult);
+
+        // Shows rowCount rows with showRow(). Collapsed rows are all one line high, so runs of them go through ImGuiListClipper and
+        // only the ones scrolled into view are drawn. Expanded rows are drawn outside of the clipper, since it needs rows of the
+        // same height.
+        void ShowScreenshotRows(int rowCount, const AZStd::function<bool(int row)>& isRowExpanded, const AZStd::function<void(int row)>& showRow);
+
+        // Whether a screenshot test passes the current display filter
+        bool IsScreenshotTestVisible(const ScreenshotTestInfo& screenshotResult) const;
+
+        // Rebuilds the lists of rows that pass the display filter, if anything changed since they were last built
+        void UpdateVisibleRows();
+
+        // Formats the headers of a screenshot test's row, if its results changed since they were last formatted
+        void UpdateScreenshotReportRow(const ScriptReport& scriptReport, ScreenshotTestInfo& screenshotResult);
         void ShowDiffButton(const char* buttonLabel, const AZStd::string& imagePathA, const AZStd::string& imagePathB);
 
         // Generates a path to the exported test results file.
@@ -255,13 +381,13 @@ namespace AtomSampleViewer
         AZStd::string GenerateAndCreateExportedImageDiffPath(const ScriptReport& scriptReport, const ScreenshotTestInfo& screenshotTest) const;
         AZStd::string GenerateAndCreateExportedTestResultsPath() const;
 
-        // Generates a diff between two images of the same size.
-        void GenerateImageDiff(AZStd::span<const uint8_t> img1, AZStd::span<const uint8_t> img2, AZStd::vector<uint8_t>& buffer);
+        // Generates a diff between two RGBA8 images of the same size, splitting the work across the job system.
+        void GenerateImageDiff(AZStd::span<const uint8_t> img1, AZStd::span<const uint8_t> img2, AZStd::span<uint8_t> buffer, uint32_t width);
 
         ScriptReport* GetCurrentScriptReport();
 
         AZStd::string SeeConsole(uint32_t issueCount, const char* searchString);
-        AZStd::string SeeBelow(uint32_t issueCount);
+        const char* SeeBelow(uint32_t issueCount);
         void HighlightTextIf(bool shouldSet, ImVec4 color);
         void ResetTextHighlight();
         void HighlightTextFailedOrWarning(bool isFailed, bool isWarning);
@@ -275,19 +401,24 @@ namespace AtomSampleViewer
             void UpdateColorSettings();
         };
 
-        using SortedReportIndexMap = AZStd::multimap<float, ReportIndex, AZStd::greater<float>>;
-
+        // Every screenshot test is kept in both indices from when it's added, and moved when its results change
         SortedReportIndexMap m_reportsSortedByOfficialBaslineScore;
         SortedReportIndexMap m_reportsSortedByLocaBaslineScore;
         SortOption m_currentSortOption = SortOption::OfficialBaselineDiffScore;
 
+        // The rows of the sorted views that pass the display filter, in display order
+        AZStd::vector<ReportIndex> m_visibleSortedRows;
+        bool m_visibleRowsDirty = true;
+
         ImGuiMessageBox m_messageBox;
 
         AZStd::vector<ImageComparisonToleranceLevel> m_availableToleranceLevels;
         AZStd::string m_invalidationMessage;
 
         AZStd::vector<ScriptReport> m_scriptReports; //< Tracks errors for the current active script
+        AZStd::map<AZStd::string, double> m_testDurations; //< Seconds per test name, see RecordTestDuration()
         AZStd::vector<size_t> m_currentScriptIndexStack; //< Tracks which of the scripts in m_scriptReports is currently active
+        AZStd::deque<AZStd::shared_ptr<PendingScreenshotCheck>> m_pendingScreenshotChecks; //< Queued screenshot comparisons, oldest first
         bool m_showReportDialog = false;
         bool m_colorHasBeenSet = false;
         DisplayOption m_displayOption = DisplayOption::AllResults;
@@ -297,7 +428,9 @@ namespace AtomSampleViewer
         AZStd::string m_exportedTestResultsPath = "Click the 'Export Test Results' button."; //< Path to exported test results file (if exported).
         AZStd::string m_uniqueTimestamp;
         HighlightColorSettings m_highlightSettings;
+        AZStd::shared_ptr<BaselineImageCache> m_baselineImageCache = BaselineImageCache::CreateFromSettings(); //< Shared with the comparison jobs so it stays alive while any of them are running
         ScriptResultsSummary m_resultsSummary;
+        TestResultsStream m_resultsStream;
 
         // Flags set and used by ShowReportDialog()
         bool m_showAll;
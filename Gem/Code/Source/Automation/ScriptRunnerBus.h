@@ -8,8 +8,10 @@
 
 #pragma once
 
+#include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
 #include <AzCore/EBus/EBus.h>
+#include <AzCore/base.h>
 
 namespace AtomSampleViewer
 {
@@ -24,6 +26,24 @@ namespace AtomSampleViewer
         virtual void PauseScript() = 0;
         virtual void PauseScriptWithTimeout(float timeout) = 0;
         virtual void ResumeScript() = 0;
+
+        //! Returns the seed the main test suite was started with (see the "randomtestseed" command line switch),
+        //! so samples can generate the same random content on every run with that seed.
+        virtual int GetRandomTestSeed() = 0;
+
+        //! Lets the active sample describe the scene it generated. The seed and composition hash are added to the
+        //! output of CaptureBenchmarkMetadata() so benchmark results can be matched to the scene that produced them.
+        virtual void SetSceneComposition(AZ::u64 randomSeed, AZ::u64 compositionHash) = 0;
+        virtual void ClearSceneComposition() = 0;
+
+        //! Lets the active sample publish named measurements, such as CPU timings of its own work, which scripts can
+        //! write to a file with CaptureSampleStatistics(). A statistic keeps its last value until it is set again or cleared.
+        virtual void SetSampleStatistic(const AZStd::string& name, double value) = 0;
+        virtual void ClearSampleStatistics() = 0;
+
+        //! Lets the active sample report how many of its preloaded assets are still loading, so scripts can
+        //! IdleUntilSampleAssetsLoaded() instead of guessing a number of frames.
+        virtual void SetPendingSampleAssetCount(uint32_t pendingAssetCount) = 0;
     };
 
     using ScriptRunnerRequestBus = AZ::EBus<ScriptRunnerRequests>;
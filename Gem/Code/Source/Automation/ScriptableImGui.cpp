@@ -8,7 +8,6 @@
 
 #include <Automation/ScriptableImGui.h>
 #include <Automation/ScriptRepeaterBus.h>
-#include <AzFramework/StringFunc/StringFunc.h>
 #include <Utils/Utils.h>
 
 #include <SampleComponentManagerBus.h>
@@ -29,9 +28,9 @@ namespace AtomSampleViewer
     {
         ScriptableImGui* s_instance = GetInstance();
         AZ_Error("Automation", s_instance->m_scriptedActions.empty(), "Not all scripted ImGui actions were consumed");
-        for (auto iter : s_instance->m_scriptedActions)
+        for (const auto& iter : s_instance->m_scriptedActions)
         {
-            AZ_Error("Automation", false, "Scripted action for '%s' not consumed", iter.first.c_str());
+            AZ_Error("Automation", false, "Scripted action for '%s' not consumed", iter.second.m_path.c_str());
         }
 
         AZ_Error("Automation", s_instance->m_nameContextStack.empty(), "PushNameContext and PopNameContext calls didn't match");
@@ -44,10 +43,16 @@ namespace AtomSampleViewer
         s_instance->m_nameContextStack.clear();
     }
 
-    void ScriptableImGui::PushNameContext(const AZStd::string& nameContext)
+    void ScriptableImGui::PushNameContext(AZStd::string_view nameContext)
     {
         ScriptableImGui* s_instance = GetInstance();
-        s_instance->m_nameContextStack.push_back(nameContext);
+
+        const NameContext* parent = s_instance->m_nameContextStack.empty() ? nullptr : &s_instance->m_nameContextStack.back();
+
+        NameContext context;
+        context.m_pathHash = HashFullPath(nameContext);
+        context.m_path = &InternPath(context.m_pathHash, parent ? parent->m_path : nullptr, nameContext);
+        s_instance->m_nameContextStack.push_back(context);
     }
 
     void ScriptableImGui::PopNameContext()
@@ -57,34 +62,85 @@ namespace AtomSampleViewer
         s_instance->m_nameContextStack.pop_back();
     }
 
-    ScriptableImGui::ActionItem ScriptableImGui::FindAndRemoveAction(const AZStd::string& pathToImGuiItem)
+    ScriptableImGui::PathHash ScriptableImGui::HashPathText(PathHash pathHash, AZStd::string_view text)
     {
-        ScriptableImGui* s_instance = GetInstance();
-        auto iter = s_instance->m_scriptedActions.find(pathToImGuiItem);
-        if (iter != s_instance->m_scriptedActions.end())
+        static constexpr PathHash Prime = 1099511628211ull;
+        for (char c : text)
         {
-            ScriptableImGui::ActionItem item = AZStd::move(iter->second);
-            s_instance->m_scriptedActions.erase(iter);
-            return AZStd::move(item);
+            pathHash = (pathHash ^ static_cast<uint8_t>(c)) * Prime;
         }
-
-        return ScriptableImGui::ActionItem{};
+        return pathHash;
     }
 
-    AZStd::string ScriptableImGui::MakeFullPath(const AZStd::string& forLabel)
+    ScriptableImGui::PathHash ScriptableImGui::HashFullPath(AZStd::string_view forLabel)
     {
         ScriptableImGui* s_instance = GetInstance();
         static constexpr char Delimiter[] = "/";
 
-        AZStd::string fullPath;
+        PathHash pathHash = EmptyPathHash;
         if (!s_instance->m_nameContextStack.empty())
         {
-            AzFramework::StringFunc::Join(fullPath, s_instance->m_nameContextStack.begin(), s_instance->m_nameContextStack.end(), Delimiter);
-            fullPath += Delimiter;
+            pathHash = HashPathText(s_instance->m_nameContextStack.back().m_pathHash, Delimiter);
         }
-        fullPath += forLabel;
 
-        return fullPath;
+        return HashPathText(pathHash, forLabel);
+    }
+
+    const AZStd::string& ScriptableImGui::InternPath(PathHash pathHash, const AZStd::string* parentPath, AZStd::string_view label)
+    {
+        ScriptableImGui* s_instance = GetInstance();
+
+        auto iter = s_instance->m_pathPool.find(pathHash);
+        if (iter == s_instance->m_pathPool.end())
+        {
+            AZStd::string fullPath;
+            if (parentPath)
+            {
+                fullPath = *parentPath;
+                fullPath += '/';
+            }
+            fullPath += label;
+
+            iter = s_instance->m_pathPool.emplace(pathHash, AZStd::move(fullPath)).first;
+        }
+
+        return iter->second;
+    }
+
+    const AZStd::string& ScriptableImGui::GetFullPath(PathHash pathHash, AZStd::string_view forLabel)
+    {
+        ScriptableImGui* s_instance = GetInstance();
+        const AZStd::string* parentPath = s_instance->m_nameContextStack.empty() ? nullptr : s_instance->m_nameContextStack.back().m_path;
+        return InternPath(pathHash, parentPath, forLabel);
+    }
+
+    ScriptableImGui::ActionItem ScriptableImGui::FindAndRemoveAction(PathHash pathHash)
+    {
+        ScriptableImGui* s_instance = GetInstance();
+
+        // Nearly every frame has no scripted actions, so don't even hash into the map
+        if (s_instance->m_scriptedActions.empty())
+        {
+            return ScriptableImGui::ActionItem{};
+        }
+
+        auto iter = s_instance->m_scriptedActions.find(pathHash);
+        if (iter != s_instance->m_scriptedActions.end())
+        {
+            ScriptableImGui::ActionItem item = AZStd::move(iter->second.m_item);
+            s_instance->m_scriptedActions.erase(iter);
+            return AZStd::move(item);
+        }
+
+        return ScriptableImGui::ActionItem{};
+    }
+
+    void ScriptableImGui::SetAction(const AZStd::string& pathToImGuiItem, ActionItem&& value)
+    {
+        ScriptableImGui* s_instance = GetInstance();
+        ScriptedAction& action = s_instance->m_scriptedActions[HashPathText(EmptyPathHash, pathToImGuiItem)];
+        action.m_path = pathToImGuiItem;
+        action.m_item = AZStd::move(value);
     }
 
     void ScriptableImGui::ReportScriptError([[maybe_unused]] const char* message)
@@ -94,54 +150,49 @@ namespace AtomSampleViewer
 
     void ScriptableImGui::SetBool(const AZStd::string& pathToImGuiItem, bool value)
     {
-        ScriptableImGui* s_instance = GetInstance();
-        s_instance->m_scriptedActions[pathToImGuiItem] = value;
+        SetAction(pathToImGuiItem, ActionItem{value});
     }
 
     void ScriptableImGui::SetNumber(const AZStd::string& pathToImGuiItem, float value)
     {
-        ScriptableImGui* s_instance = GetInstance();
-        s_instance->m_scriptedActions[pathToImGuiItem] = value;
+        SetAction(pathToImGuiItem, ActionItem{value});
     }
 
     void ScriptableImGui::SetVector(const AZStd::string& pathToImGuiItem, const AZ::Vector2& value)
     {
-        ScriptableImGui* s_instance = GetInstance();
-        s_instance->m_scriptedActions[pathToImGuiItem] = value;
+        SetAction(pathToImGuiItem, ActionItem{value});
     }
 
     void ScriptableImGui::SetVector(const AZStd::string& pathToImGuiItem, const AZ::Vector3& value)
     {
-        ScriptableImGui* s_instance = GetInstance();
-        s_instance->m_scriptedActions[pathToImGuiItem] = value;
+        SetAction(pathToImGuiItem, ActionItem{value});
     }
 
     void ScriptableImGui::SetString(const AZStd::string& pathToImGuiItem, const AZStd::string& value)
     {
-        ScriptableImGui* s_instance = GetInstance();
-        s_instance->m_scriptedActions[pathToImGuiItem] = value;
+        SetAction(pathToImGuiItem, ActionItem{value});
     }
 
-    template<typename ActionDataT>
+    template<typename ActionDataT, typename ImGuiActionT, typename ReportActionT, typename HandleActionT>
     bool ScriptableImGui::ActionHelper(
         const char* label,
-        AZStd::function<bool()> imguiAction,
-        AZStd::function<void(const AZStd::string& /*pathToImGuiItem*/)> reportScriptableAction,
-        AZStd::function<bool(ActionDataT /*scriptArg*/)> handleScriptedAction,
+        const ImGuiActionT& imguiAction,
+        const ReportActionT& reportScriptableAction,
+        const HandleActionT& handleScriptedAction,
         bool shouldReportScriptableActionAfterAnyChange)
     {
         bool imResult = imguiAction();
 
-        const AZStd::string pathToImGuiItem = MakeFullPath(label);
+        const PathHash pathHash = HashFullPath(label);
 
         if (ImGui::IsItemDeactivatedAfterEdit() || (shouldReportScriptableActionAfterAnyChange && imResult))
         {
-            reportScriptableAction(pathToImGuiItem);
+            reportScriptableAction(GetFullPath(pathHash, label));
         }
 
         bool scriptResult = false;
 
-        ActionItem actionItem = FindAndRemoveAction(pathToImGuiItem);
+        ActionItem actionItem = FindAndRemoveAction(pathHash);
         bool foundAction = !AZStd::holds_alternative<InvalidActionItem>(actionItem);
         if (foundAction)
         {
@@ -151,7 +202,7 @@ namespace AtomSampleViewer
             }
             else
             {
-                ReportScriptError(AZStd::string::format("Wrong data type used to set '%s'", pathToImGuiItem.c_str()).c_str());
+                ReportScriptError(AZStd::string::format("Wrong data type used to set '%s'", GetFullPath(pathHash, label).c_str()).c_str());
             }
         }
 
@@ -510,8 +561,6 @@ namespace AtomSampleViewer
     {
         ScriptableImGui* s_instance = GetInstance();
 
-        const AZStd::string pathToImGuiItem = MakeFullPath(label);
-
         if (ImGui::BeginCombo(label, preview_value, flags))
         {
             PushNameContext(label);
@@ -555,9 +604,9 @@ namespace AtomSampleViewer
         // Also, we don't include a "scriptResult", just the "imResult", because we need to ensure that ImGui is in the actual
         // state we are reporting back to the caller. Otherwise the internal state of ImGui could become invalid and crash.
 
-        const AZStd::string pathToImGuiItem = MakeFullPath(label);
-        
-        ActionItem actionItem = FindAndRemoveAction(pathToImGuiItem);
+        const PathHash pathHash = HashFullPath(label);
+
+        ActionItem actionItem = FindAndRemoveAction(pathHash);
         bool foundAction = !AZStd::holds_alternative<InvalidActionItem>(actionItem);
         if (foundAction)
         {
@@ -581,12 +630,12 @@ namespace AtomSampleViewer
 
         if (isPopupOpen)
         {
-            PushNameContext(label);
-
             if (!wasPopupOpen && isPopupOpen)
             {
-                Utils::ReportScriptableAction("SetImguiValue('%s', true)", pathToImGuiItem.c_str());
+                Utils::ReportScriptableAction("SetImguiValue('%s', true)", GetFullPath(pathHash, label).c_str());
             }
+
+            PushNameContext(label);
         }
 
         return isPopupOpen;
@@ -10,6 +10,7 @@
 
 #include <AzCore/RTTI/RTTI.h>
 #include <AzCore/std/string/string.h>
+#include <AzCore/std/string/string_view.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Memory/SystemAllocator.h>
@@ -38,7 +39,7 @@ namespace AtomSampleViewer
         class ScopedNameContext final
         {
         public:
-            ScopedNameContext(const AZStd::string& nameContext) { ScriptableImGui::PushNameContext(nameContext); }
+            ScopedNameContext(AZStd::string_view nameContext) { ScriptableImGui::PushNameContext(nameContext); }
             ~ScopedNameContext() { ScriptableImGui::PopNameContext(); }
         };
 
@@ -54,7 +55,7 @@ namespace AtomSampleViewer
         //!     PopNameContext();
         //! This is especially useful for disambiguating similar ImGui labels.
         //! There is also a ScopedNameContext utility class for managing the push/pop using the call stack.
-        static void PushNameContext(const AZStd::string& nameContext);
+        static void PushNameContext(AZStd::string_view nameContext);
         static void PopNameContext();
 
         //////////////////////////////////////////////////////////////////
@@ -123,31 +124,70 @@ namespace AtomSampleViewer
         using ActionItem = AZStd::variant<InvalidActionItem, bool, float, AZ::Vector2, AZ::Vector3, AZStd::string>;
 
         //! This utility function factors out common steps that most of the ImGui API bridge functions must perform.
-        template<typename ActionDataT>
+        //! The callbacks are taken as template parameters rather than AZStd::function so calling it doesn't allocate.
+        //! @param imguiAction bool() that calls the ImGui function
+        //! @param reportScriptableAction void(const AZStd::string& pathToImGuiItem) that reports a user's change
+        //! @param handleScriptedAction bool(ActionDataT scriptArg) that applies a scripted action
+        template<typename ActionDataT, typename ImGuiActionT, typename ReportActionT, typename HandleActionT>
         static bool ActionHelper(
             const char* label,
-            AZStd::function<bool()> imguiAction,
-            AZStd::function<void(const AZStd::string& /*pathToImGuiItem*/)> reportScriptableAction,
-            AZStd::function<bool(ActionDataT /*scriptArg*/)> handleScriptedAction,
+            const ImGuiActionT& imguiAction,
+            const ReportActionT& reportScriptableAction,
+            const HandleActionT& handleScriptedAction,
             bool shouldReportScriptableActionAfterAnyChange = false);
 
         template<typename ImGuiActionType>
         static bool ThreeComponentHelper(const char* label, float v[3], ImGuiActionType& imguiAction);
 
+        //! Script field IDs are identified by a 64 bit FNV-1a hash of their full path. The hash is built incrementally as name
+        //! contexts are pushed, so finding the ID of an ImGui item doesn't need to join the name context into a string.
+        using PathHash = AZ::u64;
+        static constexpr PathHash EmptyPathHash = 14695981039346656037ull;
+
+        //! Continues a path hash with more text
+        static PathHash HashPathText(PathHash pathHash, AZStd::string_view text);
+
+        //! Returns the hash of the full script field ID path of the given ImGui label, under the current name context
+        static PathHash HashFullPath(AZStd::string_view forLabel);
+
+        //! Returns the full script field ID path with the given hash from the pool of paths, adding it if needed.
+        //! @param parentPath the path of the name context the label was used in, or null at the root
+        static const AZStd::string& InternPath(PathHash pathHash, const AZStd::string* parentPath, AZStd::string_view label);
+
+        //! Returns the full script field ID path of the given ImGui label under the current name context. Only call this when
+        //! the text is actually needed; the first call for each path allocates it.
+        static const AZStd::string& GetFullPath(PathHash pathHash, AZStd::string_view forLabel);
+
         //! Finds a scheduled script action and removes it from the list of actions.
-        //! @param pathToImGuiItem - full path to an ImGui item, including the name context
-        static ActionItem FindAndRemoveAction(const AZStd::string& pathToImGuiItem);
+        //! @param pathHash - hash of the full path to an ImGui item, including the name context
+        static ActionItem FindAndRemoveAction(PathHash pathHash);
 
-        //! Makes a full script field ID path for the given ImGui label, by prefixing the current name context
-        static AZStd::string MakeFullPath(const AZStd::string& forLabel);
+        //! Schedules a scripted action for the ImGui item at the given full path
+        static void SetAction(const AZStd::string& pathToImGuiItem, ActionItem&& value);
 
         //! Utility function to ensure all script errors use a similar format
         static void ReportScriptError(const char* message);
 
+        struct NameContext
+        {
+            PathHash m_pathHash = EmptyPathHash;
+            const AZStd::string* m_path = nullptr; //!< Points into m_pathPool
+        };
+
         //! Provides a name context prefix to script field IDs for disambiguation.
-        AZStd::vector<AZStd::string> m_nameContextStack; 
+        AZStd::vector<NameContext> m_nameContextStack;
+
+        //! Every path that has been needed as text so far. The set of ImGui items is small and stable, so this stops growing
+        //! after the first few frames of a sample. Entries are never removed, so pointers to them stay valid.
+        AZStd::unordered_map<PathHash, AZStd::string> m_pathPool;
+
+        struct ScriptedAction
+        {
+            AZStd::string m_path;
+            ActionItem m_item;
+        };
 
-        using ActionMap = AZStd::unordered_map<AZStd::string, ActionItem>;
+        using ActionMap = AZStd::unordered_map<PathHash, ScriptedAction>;
         ActionMap m_scriptedActions;
 
         bool m_isInScriptedComboPopup = false;
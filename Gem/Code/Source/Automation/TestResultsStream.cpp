@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Automation/TestResultsStream.h>
+
+namespace AtomSampleViewer
+{
+    TestResultsStream::~TestResultsStream()
+    {
+        Close();
+    }
+
+    bool TestResultsStream::Open(const AZStd::string& filePath)
+    {
+        Close();
+
+        if (!m_file.Open(filePath.c_str(),
+            AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            AZ_Error("TestResultsStream", false, "Failed to open '%s' for writing.", filePath.c_str());
+            return false;
+        }
+
+        m_filePath = filePath;
+        m_stopRequested = false;
+        m_isOpen = true;
+
+        AZStd::thread_desc threadDesc;
+        threadDesc.m_name = "TestResultsStream";
+        m_writerThread = AZStd::thread(threadDesc, [this]() { WriterThreadMain(); });
+
+        return true;
+    }
+
+    void TestResultsStream::Close()
+    {
+        if (!m_isOpen)
+        {
+            return;
+        }
+
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            m_stopRequested = true;
+        }
+        m_linesQueued.notify_one();
+        m_writerThread.join();
+
+        m_file.Close();
+        m_isOpen = false;
+    }
+
+    void TestResultsStream::WriteLine(AZStd::string line)
+    {
+        if (!m_isOpen)
+        {
+            return;
+        }
+
+        line += '\n';
+
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            m_queuedLines.push_back(AZStd::move(line));
+        }
+        m_linesQueued.notify_one();
+    }
+
+    void TestResultsStream::WriterThreadMain()
+    {
+        AZStd::vector<AZStd::string> lines;
+        AZStd::string buffer;
+
+        bool stop = false;
+        while (!stop)
+        {
+            {
+                AZStd::unique_lock<AZStd::mutex> lock(m_mutex);
+                m_linesQueued.wait(lock, [this]() { return m_stopRequested || !m_queuedLines.empty(); });
+                lines.swap(m_queuedLines);
+                stop = m_stopRequested;
+            }
+
+            // Everything that was queued since the last batch is written and flushed together, rather than one line at a time
+            buffer.clear();
+            for (const AZStd::string& line : lines)
+            {
+                buffer += line;
+            }
+            lines.clear();
+
+            if (!buffer.empty())
+            {
+                if (m_file.Write(buffer.data(), buffer.size()) != buffer.size())
+                {
+                    AZ_Error("TestResultsStream", false, "Failed to write to '%s'.", m_filePath.c_str());
+                }
+                m_file.Flush();
+            }
+        }
+    }
+} // namespace AtomSampleViewer
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/string/string.h>
+
+namespace AtomSampleViewer
+{
+    //! Appends lines of text to a file from a background thread, so writing test results never holds up the frame that produced them.
+    //! Whatever has been queued is written and flushed in one batch each time the thread wakes up, which means the file can be
+    //! tailed while a long run is still going.
+    class TestResultsStream
+    {
+    public:
+        TestResultsStream() = default;
+        ~TestResultsStream();
+
+        TestResultsStream(const TestResultsStream&) = delete;
+        TestResultsStream& operator=(const TestResultsStream&) = delete;
+
+        //! Creates or truncates the file and starts the writer thread. Closes any file that was already open.
+        bool Open(const AZStd::string& filePath);
+
+        //! Writes any queued lines, then stops the writer thread and closes the file.
+        void Close();
+
+        bool IsOpen() const { return m_isOpen; }
+        const AZStd::string& GetFilePath() const { return m_filePath; }
+
+        //! Queues a line to be written. The newline is added here.
+        void WriteLine(AZStd::string line);
+
+    private:
+        void WriterThreadMain();
+
+        AZ::IO::SystemFile m_file;
+        AZStd::string m_filePath;
+        bool m_isOpen = false;
+
+        AZStd::thread m_writerThread;
+        AZStd::mutex m_mutex;
+        AZStd::condition_variable m_linesQueued;
+        AZStd::vector<AZStd::string> m_queuedLines; //< Guarded by m_mutex
+        bool m_stopRequested = false;               //< Guarded by m_mutex
+    };
+} // namespace AtomSampleViewer
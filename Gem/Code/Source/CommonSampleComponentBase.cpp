@@ -10,6 +10,7 @@
 #include <SampleComponentManager.h>
 #include <SampleComponentConfig.h>
 #include <Automation/ScriptableImGui.h>
+#include <Automation/ScriptRunnerBus.h>
 #include <Atom/RPI.Reflect/Asset/AssetUtils.h>
 #include <Atom/RPI.Public/Image/StreamingImage.h>
 
@@ -290,6 +291,7 @@ namespace AtomSampleViewer
         {
             AZ_TracePrintf(m_sampleName.c_str() , "Cancelled by user.\n");
             m_assetLoadManager.Cancel();
+            ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::SetPendingSampleAssetCount, 0u);
             SampleComponentManagerRequestBus::Broadcast(&SampleComponentManagerRequests::Reset);
         };
         m_imguiProgressList.OpenPopup("Waiting For Assets...", "Assets pending for processing:", {}, onUserCancelledAction, true /*automaticallyCloseOnAction*/, "Cancel");
@@ -297,11 +299,15 @@ namespace AtomSampleViewer
         AZStd::for_each(assetList.begin(), assetList.end(),
             [&](const AssetCollectionAsyncLoader::AssetToLoadInfo& item) { m_imguiProgressList.AddItem(item.m_assetPath); });
 
+        ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::SetPendingSampleAssetCount, aznumeric_cast<uint32_t>(assetList.size()));
+        SampleComponentManagerRequestBus::Broadcast(&SampleComponentManagerRequests::RecordSamplePreloadAssets, assetList);
+
         m_assetLoadManager.LoadAssetsAsync(assetList, [&](AZStd::string_view assetName, [[maybe_unused]] bool success, size_t pendingAssetCount)
             {
                 AZ_Error(m_sampleName.c_str(), success, "Error loading asset %s, a crash will occur when OnAllAssetsReadyActivate() is called!", assetName.data());
                 AZ_TracePrintf(m_sampleName.c_str(), "Asset %s loaded %s. Wait for %zu more assets before full activation\n", assetName.data(), success ? "successfully" : "UNSUCCESSFULLY", pendingAssetCount);
                 m_imguiProgressList.RemoveItem(assetName);
+                ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::SetPendingSampleAssetCount, aznumeric_cast<uint32_t>(pendingAssetCount));
                 if (!pendingAssetCount && !m_isAllAssetsReady)
                 {
                     m_isAllAssetsReady = true;
@@ -11,6 +11,7 @@
 #include <Atom/Component/DebugCamera/NoClipControllerComponent.h>
 
 #include <AzCore/Component/Entity.h>
+#include <AzCore/std/chrono/chrono.h>
 
 #include <AzFramework/Components/TransformComponent.h>
 
@@ -21,6 +22,8 @@
 #include <RHI/BasicRHIComponent.h>
 #include <EntityLatticeTestComponent_Traits_Platform.h>
 
+AZ_DECLARE_BUDGET(AtomSampleViewer);
+
 namespace AtomSampleViewer
 {
     using namespace AZ;
@@ -31,6 +34,9 @@ namespace AtomSampleViewer
     constexpr float s_entityScaleMax = 10.0f;
     constexpr float s_entityScaleMin = 0.1f;
 
+    // Below this many transforms per job the job overhead outweighs the work
+    constexpr size_t s_minTransformsPerJob = 1024;
+
     void EntityLatticeTestComponent::Reflect(ReflectContext* context)
     {
         if (SerializeContext* serializeContext = azrtti_cast<SerializeContext*>(context))
@@ -66,32 +72,74 @@ namespace AtomSampleViewer
 
     void EntityLatticeTestComponent::BuildLattice()
     {
+        AZ_PROFILE_FUNCTION(AtomSampleViewer);
+
+        using Clock = AZStd::chrono::high_resolution_clock;
+        using Milliseconds = AZStd::chrono::duration<float, AZStd::milli>;
+        const Clock::time_point startTime = Clock::now();
+
         PrepareCreateLatticeInstances(GetInstanceCount());
 
+        GenerateLatticeTransforms();
+        const Clock::time_point generatedTime = Clock::now();
+
+        // The lattice positions are a regular grid, so their bounds are just the first and last positions
+        m_worldAabb = AZ::Aabb::CreateFromMinMax(
+            Vector3::CreateZero(),
+            Vector3(
+                static_cast<float>(m_latticeWidth - 1) * m_spacingX,
+                static_cast<float>(m_latticeDepth - 1) * m_spacingY,
+                static_cast<float>(m_latticeHeight - 1) * m_spacingZ));
+
+        CreateLatticeInstances(m_latticeTransforms);
+        FinalizeLatticeInstances();
+
+        m_lastBuildInstanceCount = GetInstanceCount();
+        m_lastBuildGenerateMs = Milliseconds(generatedTime - startTime).count();
+        m_lastBuildTotalMs = Milliseconds(Clock::now() - startTime).count();
+
+        AZ_TracePrintf("EntityLatticeTestComponent", "Built lattice of %u instances in %.2f ms (%.3f us per instance, %.2f ms generating transforms)\n",
+            m_lastBuildInstanceCount, m_lastBuildTotalMs, m_lastBuildTotalMs * 1000.0f / m_lastBuildInstanceCount, m_lastBuildGenerateMs);
+    }
+
+    void EntityLatticeTestComponent::GenerateLatticeTransforms()
+    {
+        AZ_PROFILE_FUNCTION(AtomSampleViewer);
+
+        const size_t instanceCount = GetInstanceCount();
+        m_latticeTransforms.resize(instanceCount);
+
         // We first rotate the model by 180 degrees before translating it. This is to make it face the camera as it did
         // when the world was Y-up.
-        Transform transform = Transform::CreateRotationZ(Constants::Pi);
-        m_worldAabb = AZ::Aabb::CreateNull();
+        Transform baseTransform = Transform::CreateRotationZ(Constants::Pi);
+        baseTransform.SetUniformScale(m_entityScale);
 
-        for (int32_t x = 0; x < m_latticeWidth; ++x)
-        {
-            for (int32_t y = 0; y < m_latticeDepth; ++y)
+        // Instances are ordered with z varying fastest, then y, then x, the same order the lattice has always been built in
+        const size_t depth = m_latticeDepth;
+        const size_t height = m_latticeHeight;
+        const Vector3 spacing(m_spacingX, m_spacingY, m_spacingZ);
+
+        Utils::ParallelForChunks(instanceCount, s_minTransformsPerJob, [&](size_t begin, size_t end)
             {
-                for (int32_t z = 0; z < m_latticeHeight; ++z)
+                for (size_t i = begin; i < end; ++i)
                 {
-                    Vector3 position(
-                        static_cast<float>(x) * m_spacingX,
-                        static_cast<float>(y) * m_spacingY,
-                        static_cast<float>(z) * m_spacingZ);
-
-                    transform.SetTranslation(position);
-                    transform.SetUniformScale(m_entityScale);
-                    CreateLatticeInstance(transform);
-                    m_worldAabb.AddPoint(transform.GetTranslation());
+                    const size_t z = i % height;
+                    const size_t y = (i / height) % depth;
+                    const size_t x = i / (height * depth);
+
+                    Transform& transform = m_latticeTransforms[i];
+                    transform = baseTransform;
+                    transform.SetTranslation(Vector3(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z)) * spacing);
                 }
-            }
+            });
+    }
+
+    void EntityLatticeTestComponent::CreateLatticeInstances(AZStd::span<const AZ::Transform> transforms)
+    {
+        for (const Transform& transform : transforms)
+        {
+            CreateLatticeInstance(transform);
         }
-        FinalizeLatticeInstances();
     }
 
     uint32_t EntityLatticeTestComponent::GetInstanceCount() const
@@ -174,6 +222,14 @@ namespace AtomSampleViewer
         ImGui::Text("Entity Scale");
         latticeChanged |= ScriptableImGui::SliderFloat("##EntityScale", &m_entityScale, 0.01, s_entityScaleMax);
 
+        if (m_lastBuildInstanceCount > 0)
+        {
+            ImGui::Spacing();
+            ImGui::Text("Last rebuild: %u instances in %.2f ms", m_lastBuildInstanceCount, m_lastBuildTotalMs);
+            ImGui::Text("(%.3f us per instance, %.2f ms generating transforms)",
+                m_lastBuildTotalMs * 1000.0f / m_lastBuildInstanceCount, m_lastBuildGenerateMs);
+        }
+
         if (latticeChanged)
         {
             RebuildLattice();
@@ -13,6 +13,7 @@
 #include <EntityLatticeTestComponent_Traits_Platform.h>
 
 #include <AzCore/Math/Aabb.h>
+#include <AzCore/std/containers/span.h>
 
 struct ImGuiContext;
 
@@ -62,6 +63,10 @@ namespace AtomSampleViewer
         //! whatever components are necessary to achieve the desired result.
         virtual void CreateLatticeInstance(const AZ::Transform& transform) = 0;
 
+        //! Called once with the transforms of every entity in the lattice. The default calls CreateLatticeInstance() for each
+        //! transform; subclasses that build many instances can override this to handle them in one batch.
+        virtual void CreateLatticeInstances(AZStd::span<const AZ::Transform> transforms);
+
         //! This is called after all the instances are created to any final work. Not required.
         virtual void FinalizeLatticeInstances() {};
 
@@ -70,6 +75,9 @@ namespace AtomSampleViewer
 
         void BuildLattice();
 
+        //! Fills m_latticeTransforms with one transform per lattice position, generating chunks of the lattice in parallel
+        void GenerateLatticeTransforms();
+
     protected:
         //! Contains the world space Aabb of the lattice positions. Doesn't include the mesh Aabb at each position.
         AZ::Aabb m_worldAabb;
@@ -88,5 +96,13 @@ namespace AtomSampleViewer
         float m_entityScale = 1.0f;
         
         Utils::DefaultIBL m_defaultIbl;
+
+        //! Kept between rebuilds so rebuilding a lattice of the same size doesn't reallocate
+        AZStd::vector<AZ::Transform> m_latticeTransforms;
+
+        //! Timing of the last BuildLattice(), shown with the lattice controls
+        uint32_t m_lastBuildInstanceCount = 0;
+        float m_lastBuildGenerateMs = 0.0f;
+        float m_lastBuildTotalMs = 0.0f;
     };
 } // namespace AtomSampleViewer
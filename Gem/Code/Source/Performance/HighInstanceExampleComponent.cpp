@@ -21,6 +21,10 @@
 #include <Automation/ScriptRunnerBus.h>
 
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/hash.h>
+#include <AzFramework/API/ApplicationAPI.h>
 #include <AzFramework/Windowing/WindowBus.h>
 
 #include <RHI/BasicRHIComponent.h>
@@ -31,6 +35,9 @@ namespace AtomSampleViewer
 {
     using namespace AZ;
 
+    // Overrides the test suite's random seed, e.g. to reproduce a benchmark scene outside of a test run
+    static constexpr const char* SceneSeedSwitch = "sceneseed";
+
     void HighInstanceTestComponent::Reflect(AZ::ReflectContext* context)
     {
         if (AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
@@ -87,6 +94,9 @@ namespace AtomSampleViewer
 
     void HighInstanceTestComponent::Activate()
     {
+        m_randomSeed = GetSceneRandomSeed();
+        AZ_TracePrintf("HighInstanceTestComponent", "Using random seed %llu\n", static_cast<unsigned long long>(m_randomSeed));
+
         BuildDiskLightParameters();
 
         m_directionalLightFeatureProcessor = m_scene->GetFeatureProcessor<Render::DirectionalLightFeatureProcessorInterface>();
@@ -138,6 +148,8 @@ namespace AtomSampleViewer
 
     void HighInstanceTestComponent::Deactivate()
     {
+        ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::ClearSceneComposition);
+
         DestroyLights();
         RestoreCameraConfiguration();
         AzFramework::NativeWindowHandle windowHandle = nullptr;
@@ -158,35 +170,83 @@ namespace AtomSampleViewer
         Base::Deactivate();
     }
     
+    void HighInstanceTestComponent::ModelInstances::Reserve(size_t count)
+    {
+        m_transforms.reserve(count);
+        m_modelAssetIds.reserve(count);
+        m_materialAssetIds.reserve(count);
+        m_meshHandles.reserve(count);
+    }
+
+    void HighInstanceTestComponent::ModelInstances::Resize(size_t count)
+    {
+        m_transforms.resize(count);
+        m_modelAssetIds.resize(count);
+        m_materialAssetIds.resize(count);
+        m_meshHandles.resize(count);
+    }
+
+    void HighInstanceTestComponent::ModelInstances::Clear()
+    {
+        m_transforms.clear();
+        m_modelAssetIds.clear();
+        m_materialAssetIds.clear();
+        m_meshHandles.clear();
+    }
+
     void HighInstanceTestComponent::PrepareCreateLatticeInstances(uint32_t instanceCount)
     {
-        m_modelInstanceData.reserve(instanceCount);
+        m_modelInstances.Reserve(instanceCount);
         DestroyLights();
+
+        // Every lattice starts from the seed, so rebuilding it doesn't depend on what was generated before
+        m_instanceRandom.SetSeed(m_randomSeed);
     }
 
     void HighInstanceTestComponent::CreateLatticeInstance(const AZ::Transform& transform)
     {
-        m_modelInstanceData.emplace_back<ModelInstanceData>({});
-        ModelInstanceData& data = m_modelInstanceData.back();
-        data.m_modelAssetId = GetRandomModelId();
-        data.m_materialAssetId = GetRandomMaterialId();
-        data.m_transform = transform;
+        m_modelInstances.m_transforms.push_back(transform);
+        m_modelInstances.m_modelAssetIds.push_back(GetRandomModelId());
+        m_modelInstances.m_materialAssetIds.push_back(GetRandomMaterialId());
+        m_modelInstances.m_meshHandles.emplace_back();
+    }
+
+    void HighInstanceTestComponent::CreateLatticeInstances(AZStd::span<const AZ::Transform> transforms)
+    {
+        AZ_PROFILE_FUNCTION(AtomSampleViewer);
+
+        const size_t firstInstance = m_modelInstances.GetCount();
+        m_modelInstances.Resize(firstInstance + transforms.size());
+
+        AZStd::copy(transforms.begin(), transforms.end(), m_modelInstances.m_transforms.begin() + firstInstance);
+
+        // The random picks stay serial so a given random sequence always produces the same lattice
+        for (size_t i = firstInstance; i < m_modelInstances.GetCount(); ++i)
+        {
+            m_modelInstances.m_modelAssetIds[i] = GetRandomModelId();
+            m_modelInstances.m_materialAssetIds[i] = GetRandomMaterialId();
+        }
     }
 
     void HighInstanceTestComponent::FinalizeLatticeInstances()
     {
+        UpdateSceneCompositionHash();
+
         AZStd::set<AZ::Data::AssetId> assetIds;
 
-        for (ModelInstanceData& instanceData : m_modelInstanceData)
+        for (const AZ::Data::AssetId& materialAssetId : m_modelInstances.m_materialAssetIds)
         {
-            if (instanceData.m_materialAssetId.IsValid())
+            if (materialAssetId.IsValid())
             {
-                assetIds.insert(instanceData.m_materialAssetId);
+                assetIds.insert(materialAssetId);
             }
+        }
 
-            if (instanceData.m_modelAssetId.IsValid())
+        for (const AZ::Data::AssetId& modelAssetId : m_modelInstances.m_modelAssetIds)
+        {
+            if (modelAssetId.IsValid())
             {
-                assetIds.insert(instanceData.m_modelAssetId);
+                assetIds.insert(modelAssetId);
             }
         }
 
@@ -224,37 +284,71 @@ namespace AtomSampleViewer
 
     void HighInstanceTestComponent::OnAllAssetsReadyActivate()
     {
-        for (ModelInstanceData& instanceData : m_modelInstanceData)
+        AcquireMeshes();
+
+        ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::ResumeScript);
+        AZ::TickBus::Handler::BusConnect();
+    }
+
+    void HighInstanceTestComponent::AcquireMeshes()
+    {
+        AZ_PROFILE_FUNCTION(AtomSampleViewer);
+
+        using Clock = AZStd::chrono::high_resolution_clock;
+        const Clock::time_point startTime = Clock::now();
+
+        // There are only a handful of distinct models and materials, so look each one up once rather than once per instance
+        AZStd::unordered_map<AZ::Data::AssetId, AZ::Data::Instance<AZ::RPI::Material>> materialInstances;
+        AZStd::unordered_map<AZ::Data::AssetId, AZ::Data::Asset<AZ::RPI::ModelAsset>> modelAssets;
+
+        auto* meshFeatureProcessor = GetMeshFeatureProcessor();
+
+        // AcquireMesh() and SetTransform() aren't thread safe, so the meshes are set up from this thread
+        for (size_t i = 0; i < m_modelInstances.GetCount(); ++i)
         {
+            const AZ::Data::AssetId& materialAssetId = m_modelInstances.m_materialAssetIds[i];
+            const AZ::Data::AssetId& modelAssetId = m_modelInstances.m_modelAssetIds[i];
+
             AZ::Data::Instance<AZ::RPI::Material> materialInstance;
-            if (instanceData.m_materialAssetId.IsValid())
+            if (materialAssetId.IsValid())
             {
-                AZ::Data::Asset<RPI::MaterialAsset> materialAsset;
-                materialAsset.Create(instanceData.m_materialAssetId);
-                materialInstance = AZ::RPI::Material::FindOrCreate(materialAsset);
+                auto materialIt = materialInstances.find(materialAssetId);
+                if (materialIt == materialInstances.end())
+                {
+                    AZ::Data::Asset<RPI::MaterialAsset> materialAsset;
+                    materialAsset.Create(materialAssetId);
+
+                    // cache the material when its loaded
+                    m_cachedMaterials.insert(materialAsset);
 
-                // cache the material when its loaded
-                m_cachedMaterials.insert(materialAsset);
+                    materialIt = materialInstances.emplace(materialAssetId, AZ::RPI::Material::FindOrCreate(materialAsset)).first;
+                }
+                materialInstance = materialIt->second;
             }
 
-            if (instanceData.m_modelAssetId.IsValid())
+            if (modelAssetId.IsValid())
             {
-                AZ::Data::Asset<AZ::RPI::ModelAsset> modelAsset;
-                modelAsset.Create(instanceData.m_modelAssetId);
+                auto modelIt = modelAssets.find(modelAssetId);
+                if (modelIt == modelAssets.end())
+                {
+                    AZ::Data::Asset<AZ::RPI::ModelAsset> modelAsset;
+                    modelAsset.Create(modelAssetId);
+                    modelIt = modelAssets.emplace(modelAssetId, modelAsset).first;
+                }
 
-                instanceData.m_meshHandle = GetMeshFeatureProcessor()->AcquireMesh(AZ::Render::MeshHandleDescriptor(modelAsset, materialInstance));
-                GetMeshFeatureProcessor()->SetTransform(instanceData.m_meshHandle, instanceData.m_transform);
+                m_modelInstances.m_meshHandles[i] = meshFeatureProcessor->AcquireMesh(AZ::Render::MeshHandleDescriptor(modelIt->second, materialInstance));
+                meshFeatureProcessor->SetTransform(m_modelInstances.m_meshHandles[i], m_modelInstances.m_transforms[i]);
             }
         }
 
-        ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::ResumeScript);
-        AZ::TickBus::Handler::BusConnect();
+        m_lastMeshAcquireMs = AZStd::chrono::duration<float, AZStd::milli>(Clock::now() - startTime).count();
+        AZ_TracePrintf("HighInstanceTestComponent", "Acquired %zu meshes in %.2f ms\n", m_modelInstances.GetCount(), m_lastMeshAcquireMs);
     }
 
     void HighInstanceTestComponent::DestroyLatticeInstances()
     {
         DestroyHandles();
-        m_modelInstanceData.clear();
+        m_modelInstances.Clear();
     }
 
     void HighInstanceTestComponent::DestroyLights()
@@ -271,20 +365,20 @@ namespace AtomSampleViewer
 
     void HighInstanceTestComponent::DestroyHandles()
     {
-        for (ModelInstanceData& instanceData : m_modelInstanceData)
+        for (AZ::Render::MeshFeatureProcessorInterface::MeshHandle& meshHandle : m_modelInstances.m_meshHandles)
         {
-            GetMeshFeatureProcessor()->ReleaseMesh(instanceData.m_meshHandle);
-            instanceData.m_meshHandle = {};
+            GetMeshFeatureProcessor()->ReleaseMesh(meshHandle);
+            meshHandle = {};
         }
     }
 
-    AZ::Data::AssetId HighInstanceTestComponent::GetRandomModelId() const
+    AZ::Data::AssetId HighInstanceTestComponent::GetRandomModelId()
     {
         auto& modelAllowlist = m_modelBrowser.GetPinnedAssets();
 
         if (modelAllowlist.size())
         {
-            const size_t randomModelIndex = rand() % modelAllowlist.size();
+            const size_t randomModelIndex = m_instanceRandom.GetRandom() % modelAllowlist.size();
             return modelAllowlist[randomModelIndex].m_assetId;
         }
         else
@@ -293,13 +387,13 @@ namespace AtomSampleViewer
         }
     }
 
-    AZ::Data::AssetId HighInstanceTestComponent::GetRandomMaterialId() const
+    AZ::Data::AssetId HighInstanceTestComponent::GetRandomMaterialId()
     {
         auto& materialAllowlist = m_materialBrowser.GetPinnedAssets();
 
         if (materialAllowlist.size())
         {
-            const size_t randomMaterialIndex = rand() % materialAllowlist.size();
+            const size_t randomMaterialIndex = m_instanceRandom.GetRandom() % materialAllowlist.size();
             return materialAllowlist[randomMaterialIndex].m_assetId;
         }
         else
@@ -308,6 +402,35 @@ namespace AtomSampleViewer
         }
     }
 
+    AZ::u64 HighInstanceTestComponent::GetSceneRandomSeed()
+    {
+        const AzFramework::CommandLine* commandLine = nullptr;
+        AzFramework::ApplicationRequests::Bus::BroadcastResult(commandLine, &AzFramework::ApplicationRequests::GetCommandLine);
+        if (commandLine && commandLine->HasSwitch(SceneSeedSwitch))
+        {
+            return strtoull(commandLine->GetSwitchValue(SceneSeedSwitch, 0).c_str(), nullptr, 10);
+        }
+
+        int testSeed = 0;
+        ScriptRunnerRequestBus::BroadcastResult(testSeed, &ScriptRunnerRequests::GetRandomTestSeed);
+        return static_cast<AZ::u64>(testSeed);
+    }
+
+    void HighInstanceTestComponent::UpdateSceneCompositionHash()
+    {
+        size_t hash = 0;
+        AZStd::hash_combine(hash, m_randomSeed);
+        AZStd::hash_combine(hash, m_modelInstances.GetCount());
+        for (size_t i = 0; i < m_modelInstances.GetCount(); ++i)
+        {
+            AZStd::hash_combine(hash, m_modelInstances.m_modelAssetIds[i]);
+            AZStd::hash_combine(hash, m_modelInstances.m_materialAssetIds[i]);
+        }
+        m_sceneCompositionHash = hash;
+
+        ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::SetSceneComposition, m_randomSeed, m_sceneCompositionHash);
+    }
+
 
     void HighInstanceTestComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint scriptTime)
     {
@@ -320,10 +443,13 @@ namespace AtomSampleViewer
             AZ::Transform rotationTransform;
             rotationTransform.SetFromEulerRadians(rotation);
 
-            for (ModelInstanceData& instanceData : m_modelInstanceData)
-            {
-                GetMeshFeatureProcessor()->SetTransform(instanceData.m_meshHandle, instanceData.m_transform * rotationTransform);
-            }
+            using Clock = AZStd::chrono::high_resolution_clock;
+            const Clock::time_point updateStartTime = Clock::now();
+
+            UpdateTransforms(rotationTransform);
+
+            const float updateMs = AZStd::chrono::duration<float, AZStd::milli>(Clock::now() - updateStartTime).count();
+            m_averageTransformUpdateMs = AZ::Lerp(m_averageTransformUpdateMs, updateMs, 0.05f);
         }
 
         bool currentUseSimpleModels = m_useSimpleModels;
@@ -332,6 +458,10 @@ namespace AtomSampleViewer
         if (m_imguiSidebar.Begin())
         {
             ImGui::Checkbox("Update Transforms Every Frame", &m_updateTransformEnabled);
+            if (m_updateTransformEnabled)
+            {
+                ImGui::Text("Transform update: %.3f ms", m_averageTransformUpdateMs);
+            }
 
             ImGui::Spacing();
             ImGui::Separator();
@@ -339,6 +469,13 @@ namespace AtomSampleViewer
 
             RenderImGuiLatticeControls();
 
+            if (m_lastMeshAcquireMs > 0.0f)
+            {
+                ImGui::Text("Last mesh acquisition: %zu meshes in %.2f ms", m_modelInstances.GetCount(), m_lastMeshAcquireMs);
+            }
+            ImGui::Text("Random seed: %llu", static_cast<unsigned long long>(m_randomSeed));
+            ImGui::Text("Scene composition hash: %016llx", static_cast<unsigned long long>(m_sceneCompositionHash));
+
             ImGui::Spacing();
             ImGui::Separator();
             ImGui::Spacing();
@@ -383,9 +520,10 @@ namespace AtomSampleViewer
         if (currentUseSimpleModels != m_useSimpleModels)
         {
             m_modelBrowser.SetPinnedAssets(m_useSimpleModels?m_simpleModelList:m_expandedModelList);
-            for (ModelInstanceData& instanceData : m_modelInstanceData)
+            m_instanceRandom.SetSeed(m_randomSeed);
+            for (AZ::Data::AssetId& modelAssetId : m_modelInstances.m_modelAssetIds)
             {
-                instanceData.m_modelAssetId = GetRandomModelId();
+                modelAssetId = GetRandomModelId();
             }
             DestroyHandles();
             DestroyLights();
@@ -395,6 +533,17 @@ namespace AtomSampleViewer
         DrawDiskLightDebugObjects();
     }
 
+    void HighInstanceTestComponent::UpdateTransforms(const AZ::Transform& rotationTransform)
+    {
+        AZ_PROFILE_FUNCTION(AtomSampleViewer);
+
+        auto* meshFeatureProcessor = GetMeshFeatureProcessor();
+        for (size_t i = 0; i < m_modelInstances.GetCount(); ++i)
+        {
+            meshFeatureProcessor->SetTransform(m_modelInstances.m_meshHandles[i], m_modelInstances.m_transforms[i] * rotationTransform);
+        }
+    }
+
     void HighInstanceTestComponent::ResetNoClipController()
     {
         using namespace AZ;
@@ -452,7 +601,6 @@ namespace AtomSampleViewer
 
     const AZ::Color& HighInstanceTestComponent::GetNextLightColor()
     {
-        static uint16_t colorIndex = 0;
         static const AZStd::vector<AZ::Color> colors =
         {
             AZ::Colors::Red,
@@ -464,8 +612,8 @@ namespace AtomSampleViewer
             AZ::Colors::SpringGreen
         };
 
-        const AZ::Color& result = colors[colorIndex];
-        colorIndex = (colorIndex + 1) % colors.size();
+        const AZ::Color& result = colors[m_nextLightColorIndex];
+        m_nextLightColorIndex = (m_nextLightColorIndex + 1) % colors.size();
         return result;
     }
 
@@ -479,7 +627,8 @@ namespace AtomSampleViewer
 
     void HighInstanceTestComponent::BuildDiskLightParameters()
     {
-        m_random.SetSeed(0);
+        m_random.SetSeed(m_randomSeed);
+        m_nextLightColorIndex = 0;
         m_diskLights.clear();
         m_diskLights.reserve(m_testParameters.m_numShadowCastingSpotLights);
         for (int index = 0; index < m_testParameters.m_numShadowCastingSpotLights; ++index)
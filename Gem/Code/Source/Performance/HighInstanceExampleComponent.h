@@ -74,17 +74,31 @@ namespace AtomSampleViewer
         //! EntityLatticeTestComponent overrides...
         void PrepareCreateLatticeInstances(uint32_t instanceCount) override;
         void CreateLatticeInstance(const AZ::Transform& transform) override;
+        void CreateLatticeInstances(AZStd::span<const AZ::Transform> transforms) override;
         void FinalizeLatticeInstances() override;
         void DestroyLatticeInstances() override;
         void DestroyLights();
 
         void DestroyHandles();
 
-        AZ::Data::AssetId GetRandomModelId() const;
-        AZ::Data::AssetId GetRandomMaterialId() const;
+        //! Acquires a mesh for every instance and sets its transform, creating each distinct model and material instance only once.
+        void AcquireMeshes();
+
+        AZ::Data::AssetId GetRandomModelId();
+        AZ::Data::AssetId GetRandomMaterialId();
+
+        //! Returns the seed from the "sceneseed" command line switch if present, otherwise the test suite's random seed
+        static AZ::u64 GetSceneRandomSeed();
+
+        //! Hashes the seed and every instance's model and material, and reports it to the script runner for benchmark metadata
+        void UpdateSceneCompositionHash();
 
         void OnTick(float deltaTime, AZ::ScriptTimePoint scriptTime) override;
 
+        //! Applies rotationTransform to every instance's transform and submits the results to the mesh feature processor.
+        //! SetTransform() isn't thread safe and has no batched version, so this runs serially on this thread.
+        void UpdateTransforms(const AZ::Transform& rotationTransform);
+
         void ResetNoClipController();
         void SaveCameraConfiguration();
         void RestoreCameraConfiguration();
@@ -102,19 +116,26 @@ namespace AtomSampleViewer
         HighInstanceTestParameters m_testParameters;
 
     private:
-        struct ModelInstanceData
+        //! Per-instance data stored as parallel arrays, so the per-frame transform update streams through contiguous
+        //! transforms and handles instead of striding over asset ids it never reads.
+        struct ModelInstances
         {
-            AZ::Transform m_transform;
-            AZ::Data::AssetId m_modelAssetId;
-            AZ::Data::AssetId m_materialAssetId;
-            AZ::Render::MeshFeatureProcessorInterface::MeshHandle m_meshHandle;
+            AZStd::vector<AZ::Transform> m_transforms;
+            AZStd::vector<AZ::Data::AssetId> m_modelAssetIds;
+            AZStd::vector<AZ::Data::AssetId> m_materialAssetIds;
+            AZStd::vector<AZ::Render::MeshFeatureProcessorInterface::MeshHandle> m_meshHandles;
+
+            size_t GetCount() const { return m_transforms.size(); }
+            void Reserve(size_t count);
+            void Resize(size_t count);
+            void Clear();
         };
 
         ImGuiSidebar m_imguiSidebar;
         ImGuiAssetBrowser m_materialBrowser;
         ImGuiAssetBrowser m_modelBrowser;
         
-        AZStd::vector<ModelInstanceData> m_modelInstanceData;
+        ModelInstances m_modelInstances;
 
         struct Compare
         {
@@ -132,13 +153,19 @@ namespace AtomSampleViewer
         MaterialAssetSet m_cachedMaterials;
         uint32_t m_pinnedMaterialCount = 0;
         uint32_t m_preActivateVSyncInterval = 0;
-        AZ::SimpleLcgRandom m_random;
+        AZ::SimpleLcgRandom m_random; //< Drives the light placement
+        AZ::SimpleLcgRandom m_instanceRandom; //< Drives the model and material picks, reseeded for every lattice
+        AZ::u64 m_randomSeed = 0;
+        AZ::u64 m_sceneCompositionHash = 0;
+        size_t m_nextLightColorIndex = 0;
 
         AZStd::vector<AZStd::string> m_expandedModelList; // has models that are more expensive on the gpu
         AZStd::vector<AZStd::string> m_simpleModelList; // Aims to keep the test cpu bottlenecked by using trivial geometry such as a cube
 
         float m_originalFarClipDistance;
+        float m_lastMeshAcquireMs = 0.0f; //< Time taken by the last AcquireMeshes(), shown in the sidebar
         bool m_updateTransformEnabled = false;
+        float m_averageTransformUpdateMs = 0.0f; //< Smoothed cost of the per-frame transform update, shown in the sidebar
         bool m_useSimpleModels = true;
 
         // light settings
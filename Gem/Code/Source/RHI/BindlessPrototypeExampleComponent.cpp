@@ -13,6 +13,7 @@
 #include <Atom/Component/DebugCamera/CameraControllerBus.h>
 
 #include <Atom/RHI.Reflect/InputStreamLayoutBuilder.h>
+#include <Atom/RHI.Reflect/Limits.h>
 #include <Atom/RHI.Reflect/RenderAttachmentLayoutBuilder.h>
 
 #include <Atom/RHI/FrameGraphInterface.h>
@@ -23,6 +24,7 @@
 
 #include <AzFramework/Components/CameraBus.h>
 
+#include <Automation/ScriptRunnerBus.h>
 #include <SampleComponentManager.h>
 #include <SampleComponentConfig.h>
 
@@ -187,8 +189,12 @@ namespace AtomSampleViewer
 
             bool randomizeMaterials = ScriptableImGui::Button("RandomizeMaterials");
 
+            ScriptableImGui::Checkbox("Animate Objects", &m_animateObjects);
+
             ImGui::Separator();
 
+            DrawFloatBufferStatistics();
+
             m_imguiSidebar.End();
 
             // Recreate the objects when the quantity changed
@@ -314,23 +320,37 @@ namespace AtomSampleViewer
 
     void BindlessPrototypeExampleComponent::ClearObjects()
     {
+        // Release the objects' data so the next objects can reuse it
+        for (ObjectInterval& objectInterval : m_objectIntervalArray)
+        {
+            m_floatBuffer->Free(objectInterval.m_objectHandle);
+        }
+
         m_subMeshInstanceArray.clear();
         m_objectIntervalArray.clear();
     }
 
-    void BindlessPrototypeExampleComponent::AddObjectForRender(const PerObject& perObject)
+    Matrix4x4 BindlessPrototypeExampleComponent::GetObjectTransform(const Vector3& position) const
+    {
+        const Vector3 scale(1.0f);
+        return Matrix4x4::CreateTranslation(position) * Matrix4x4::CreateRotationZ(AZ::Constants::Pi + m_objectAngle) * Matrix4x4::CreateScale(scale);
+    }
+
+    void BindlessPrototypeExampleComponent::AddObjectForRender(const Vector3& position)
     {
         const uint32_t subMeshCount = static_cast<uint32_t>(m_model->GetLods()[m_modelLod]->GetMeshes().size());
-        const uint32_t objectIndex = static_cast<uint32_t>(m_objectIntervalArray.size());
 
-        // Map buffer
-        const uint32_t perObjectSize = sizeof(PerObject);
-        m_floatBuffer->UpdateBuffer(m_objectHandleArray[objectIndex], static_cast<const void*>(&perObject), perObjectSize);
+        // Allocate the object data
+        PerObject perObject;
+        perObject.m_localToWorldMatrix = GetObjectTransform(position);
+        FloatBufferHandle objectHandle;
+        [[maybe_unused]] bool result = m_floatBuffer->AllocateFromBuffer(objectHandle, static_cast<const void*>(&perObject), sizeof(PerObject));
+        AZ_Assert(result, "Failed to allocate FloatBuffer");
 
         // Create the mesh interval
         const uint32_t meshIntervalStart = static_cast<uint32_t>(m_subMeshInstanceArray.size());
         const uint32_t meshIntervalEnd = meshIntervalStart + subMeshCount;
-        const ObjectInterval objectInterval{ meshIntervalStart , meshIntervalEnd, m_objectHandleArray[objectIndex] };
+        const ObjectInterval objectInterval{ meshIntervalStart , meshIntervalEnd, objectHandle, position };
         m_objectIntervalArray.emplace_back(objectInterval);
 
         // Create the sub meshes and the SRG
@@ -380,17 +400,12 @@ namespace AtomSampleViewer
                     AZ_Assert(static_cast<uint32_t>(objectCount) < m_objectCount, "Spawning too many objects");
 
                     // Calculate the object position
-                    PerObject perObjectData;
-                    const Vector3 scale(1.0f);
                     const Vector3 position(
                         m_meshPositionOffset * static_cast<float>(widthIdx),
                         m_meshPositionOffset * static_cast<float>(depthIdx),
                         m_meshPositionOffset * static_cast<float>(heightIdx));
 
-                    const Matrix4x4 localToWorldMatrix = Matrix4x4::CreateTranslation(position) * Matrix4x4::CreateRotationZ(AZ::Constants::Pi) * Matrix4x4::CreateScale(scale);
-                    perObjectData.m_localToWorldMatrix = localToWorldMatrix;
-
-                    AddObjectForRender(perObjectData);
+                    AddObjectForRender(position);
                 }
             }
         }
@@ -505,7 +520,7 @@ namespace AtomSampleViewer
         // Initialize the float buffer, and set the view
         {
             const uint32_t byteCount = m_bufferFloatCount * static_cast<uint32_t>(sizeof(float));
-            m_floatBuffer = std::make_unique<FloatBuffer>(FloatBuffer(m_bufferPool, byteCount));
+            m_floatBuffer = std::make_unique<FloatBuffer>(m_bufferPool, byteCount);
 
             AZ::RHI::Ptr<AZ::RHI::BufferView> bufferView = RHI::Factory::Get().CreateBufferView();
             {
@@ -548,16 +563,6 @@ namespace AtomSampleViewer
             }
         }
 
-        // Preallocate the objects in the FloatBuffer
-        {
-            m_objectHandleArray.resize(m_objectCount);
-            for (FloatBufferHandle& handle : m_objectHandleArray)
-            {
-                PerObject object;
-                m_floatBuffer->AllocateFromBuffer(handle, static_cast<void*>(&object), sizeof(PerObject));
-            }
-        }
-
         //Load appropriate textures used by the unbounded texture array
         AZStd::vector<const RHI::ImageView*> imageViews;
         for (uint32_t textureIdx = 0u; textureIdx < InternalBP::ImageCount; textureIdx++)
@@ -657,6 +662,13 @@ namespace AtomSampleViewer
         m_shader = nullptr;
         m_pipelineState = nullptr;
 
+        // The handles point into the FloatBuffer, which is recreated on the next activation
+        m_subMeshInstanceArray.clear();
+        m_objectIntervalArray.clear();
+        m_materialHandleArray.clear();
+        m_worldToClipHandle.Reset();
+        m_lightDirectionHandle.Reset();
+
         m_floatBuffer = nullptr;
         m_computeBuffer = nullptr;
         m_computeImage = nullptr;
@@ -696,6 +708,11 @@ namespace AtomSampleViewer
 
         m_lightDir = lightTransform.GetBasis(1);
 
+        if (m_animateObjects)
+        {
+            m_objectAngle = fmodf(m_objectAngle + deltaTime * Constants::TwoPi * rotationSpeed, Constants::TwoPi);
+        }
+
         DrawImgui();
     }
 
@@ -743,6 +760,14 @@ namespace AtomSampleViewer
                                               static_cast<void *>(&m_lightDir),
                                               static_cast<uint32_t>(sizeof(Vector3)));
 
+        if (m_animateObjects)
+        {
+            UpdateObjectTransforms();
+        }
+
+        // Upload everything that was written to the FloatBuffer since the last frame
+        m_floatBuffer->Flush();
+
         Data::Instance<AZ::RPI::ShaderResourceGroup> indirectionBufferSrg = m_bindlessSrg->GetSrg(m_indirectionBufferSrgName);
 
         // Indirect buffer that will contain indices for all read only textures and read write textures within the bindless heap
@@ -817,6 +842,38 @@ namespace AtomSampleViewer
         BasicRHIComponent::OnFramePrepare(frameGraphBuilder);
     }
 
+    void BindlessPrototypeExampleComponent::UpdateObjectTransforms()
+    {
+        for (const ObjectInterval& objectInterval : m_objectIntervalArray)
+        {
+            PerObject perObject;
+            perObject.m_localToWorldMatrix = GetObjectTransform(objectInterval.m_position);
+            m_floatBuffer->UpdateBuffer(objectInterval.m_objectHandle, static_cast<const void*>(&perObject), sizeof(PerObject));
+        }
+    }
+
+    void BindlessPrototypeExampleComponent::DrawFloatBufferStatistics()
+    {
+        const RangeAllocator& allocator = m_floatBuffer->m_allocator;
+        const uint32_t allocatedBytes = allocator.GetAllocatedCount() * FloatBuffer::FloatSizeInBytes;
+
+        ImGui::Text("FloatBuffer");
+        ImGui::Text("Allocations: %u", allocator.GetAllocationCount());
+        ImGui::Text("Allocated: %u / %u KB", allocatedBytes / 1024, m_floatBuffer->m_totalSizeInBytes / 1024);
+        ImGui::Text("Free blocks: %u, largest %u KB", allocator.GetFreeBlockCount(),
+            allocator.GetLargestFreeBlock() * FloatBuffer::FloatSizeInBytes / 1024);
+        ImGui::Text("Last upload: %u writes, %u ranges, %u bytes, %u maps", m_floatBuffer->m_lastFlushWriteCount,
+            m_floatBuffer->m_lastFlushRangeCount, m_floatBuffer->m_lastFlushSizeInBytes, m_floatBuffer->m_lastFlushMapCount);
+
+        ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::SetSampleStatistic, "FloatBufferAllocations", allocator.GetAllocationCount());
+        ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::SetSampleStatistic, "FloatBufferAllocatedBytes", allocatedBytes);
+        ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::SetSampleStatistic, "FloatBufferFreeBlocks", allocator.GetFreeBlockCount());
+        ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::SetSampleStatistic, "FloatBufferWritesPerFrame", m_floatBuffer->m_lastFlushWriteCount);
+        ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::SetSampleStatistic, "FloatBufferUploadRangesPerFrame", m_floatBuffer->m_lastFlushRangeCount);
+        ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::SetSampleStatistic, "FloatBufferUploadBytesPerFrame", m_floatBuffer->m_lastFlushSizeInBytes);
+        ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::SetSampleStatistic, "FloatBufferMapsPerFrame", m_floatBuffer->m_lastFlushMapCount);
+    }
+
     BindlessPrototypeExampleComponent::BindlessSrg::BindlessSrg(AZ::Data::Instance<AZ::RPI::Shader> shader, AZStd::vector<const char*> srgArray)
     {
         // Create all the SRGs
@@ -865,8 +922,9 @@ namespace AtomSampleViewer
         // Create the buffer from the pool
         CreateBufferFromPool(sizeInBytes);
 
-        m_allocatedInBytes = 0u;
         m_totalSizeInBytes = sizeInBytes;
+        m_allocator.Init(sizeInBytes / FloatSizeInBytes);
+        m_shadowData.resize(sizeInBytes / FloatSizeInBytes, 0.0f);
     }
 
     BindlessPrototypeExampleComponent::FloatBuffer::~FloatBuffer()
@@ -877,58 +935,108 @@ namespace AtomSampleViewer
 
     bool BindlessPrototypeExampleComponent::FloatBuffer::AllocateOrUpdateBuffer(FloatBufferHandle& handle, const void* data, const uint32_t sizeInBytes)
     {
+        // Data of a different size, like a material of a different type, gets a new allocation
+        const uint32_t floatCount = RHI::AlignUp(sizeInBytes, FloatSizeInBytes) / FloatSizeInBytes;
+        if (handle.IsValid() && m_allocator.GetAllocationSize(handle.GetIndex()) != floatCount)
+        {
+            Free(handle);
+        }
+
         // If the handle is invalid
-        bool success = false;
         if (!handle.IsValid())
         {
-            success = AllocateFromBuffer(handle, data, sizeInBytes);
-            return success;
+            return AllocateFromBuffer(handle, data, sizeInBytes);
         }
 
         // Update if it's a valid handle
-        success = UpdateBuffer(handle, data, sizeInBytes);
-        return success;
+        return UpdateBuffer(handle, data, sizeInBytes);
     }
 
     bool BindlessPrototypeExampleComponent::FloatBuffer::AllocateFromBuffer(FloatBufferHandle& handle, const void* data, const uint32_t sizeInBytes)
     {
-        // Check if it's exceeding the poolsize
-        const uint32_t alignedDataSize = RHI::AlignUp(sizeInBytes, FloatSizeInBytes);
-        AZ_Assert(m_allocatedInBytes + alignedDataSize < m_totalSizeInBytes, "Allocating too much data in the FLoatBuffer");
+        AZ_Assert((sizeInBytes % FloatSizeInBytes) == 0u, "buffer isn't aligned properly");
+        const uint32_t floatCount = RHI::AlignUp(sizeInBytes, FloatSizeInBytes) / FloatSizeInBytes;
 
-        const RHI::BufferMapRequest mapRequest(*m_buffer, m_allocatedInBytes, sizeInBytes);
-        MapData(mapRequest, data);
+        const uint32_t offset = m_allocator.Allocate(floatCount);
+        if (offset == RangeAllocator::InvalidOffset)
+        {
+            AZ_Error(InternalBP::SampleName, false, "Allocating too much data in the FloatBuffer");
+            return false;
+        }
 
         // Create the handle
-        AZ_Assert((sizeInBytes % FloatSizeInBytes) == 0u, "buffer isn't aligned properly");
-        handle = FloatBufferHandle(m_allocatedInBytes / FloatSizeInBytes);
+        handle = FloatBufferHandle(offset);
+
+        return UpdateBuffer(handle, data, sizeInBytes);
+    }
+
+    bool BindlessPrototypeExampleComponent::FloatBuffer::UpdateBuffer(const FloatBufferHandle& handle, const void* data, const uint32_t sizeInBytes)
+    {
+        const uint32_t offset = handle.GetIndex();
+        const uint32_t floatCount = RHI::AlignUp(sizeInBytes, FloatSizeInBytes) / FloatSizeInBytes;
+        if (floatCount > m_allocator.GetAllocationSize(offset))
+        {
+            AZ_Assert(false, "Writing past the end of the FloatBuffer allocation at %u", offset);
+            return false;
+        }
 
-        // Align-up the allocation size
-        m_allocatedInBytes += alignedDataSize;
+        // The data is uploaded by the next Flush()
+        memcpy(m_shadowData.data() + offset, data, sizeInBytes);
+        m_dirtyRanges.Add(offset, floatCount);
+        ++m_writeCount;
 
         return true;
     }
 
-    bool BindlessPrototypeExampleComponent::FloatBuffer::UpdateBuffer(const FloatBufferHandle& handle, const void* data, const uint32_t sizeInBytes)
+    void BindlessPrototypeExampleComponent::FloatBuffer::Free(FloatBufferHandle& handle)
     {
-        const RHI::BufferMapRequest mapRequest(*m_buffer, handle.GetIndex() * FloatSizeInBytes, sizeInBytes);
-        return MapData(mapRequest, data);
+        if (handle.IsValid())
+        {
+            // The frames in flight may still read the range, so it is only reused once they are done
+            m_allocator.FreeAfterFrames(handle.GetIndex(), RHI::Limits::Device::FrameCountMax);
+            handle.Reset();
+        }
     }
 
-    bool BindlessPrototypeExampleComponent::FloatBuffer::MapData(const RHI::BufferMapRequest& mapRequest, const void* data)
+    void BindlessPrototypeExampleComponent::FloatBuffer::Flush()
     {
-        RHI::BufferMapResponse response;
-        [[maybe_unused]] RHI::ResultCode result = m_bufferPool->MapBuffer(mapRequest, response);
-        // ResultCode::Unimplemented is used by Null Renderer and hence is a valid use case
-        AZ_Assert(result == RHI::ResultCode::Success || result == RHI::ResultCode::Unimplemented, "Failed to map object buffer]");
-        if (response.m_data)
+        // Called once per frame
+        m_allocator.NextFrame();
+
+        m_lastFlushWriteCount = m_writeCount;
+        m_lastFlushRangeCount = 0;
+        m_lastFlushMapCount = 0;
+        m_lastFlushSizeInBytes = 0;
+        m_writeCount = 0;
+
+        if (m_dirtyRanges.IsEmpty())
         {
-            memcpy(response.m_data, data, mapRequest.m_byteCount);
-            m_bufferPool->UnmapBuffer(*m_buffer);
-            return true;
+            return;
         }
 
-        return false;
+        // The pool is device memory, so every map is a staging allocation that is uploaded in full on unmap. Each coalesced
+        // range is mapped on its own and filled entirely from the CPU copy, including the small gaps that were merged in.
+        const AZStd::vector<DirtyRangeList::Range>& ranges = m_dirtyRanges.Coalesce(DirtyRangeMergeDistance);
+        for (const DirtyRangeList::Range& range : ranges)
+        {
+            const uint32_t rangeSizeInBytes = range.m_count * FloatSizeInBytes;
+            const RHI::BufferMapRequest mapRequest(*m_buffer, range.m_offset * FloatSizeInBytes, rangeSizeInBytes);
+            RHI::BufferMapResponse response;
+            [[maybe_unused]] RHI::ResultCode result = m_bufferPool->MapBuffer(mapRequest, response);
+            // ResultCode::Unimplemented is used by Null Renderer and hence is a valid use case
+            AZ_Assert(result == RHI::ResultCode::Success || result == RHI::ResultCode::Unimplemented, "Failed to map object buffer]");
+            if (response.m_data)
+            {
+                memcpy(response.m_data, m_shadowData.data() + range.m_offset, rangeSizeInBytes);
+                m_bufferPool->UnmapBuffer(*m_buffer);
+
+                m_lastFlushSizeInBytes += rangeSizeInBytes;
+                ++m_lastFlushRangeCount;
+                ++m_lastFlushMapCount;
+            }
+        }
+
+        m_dirtyRanges.Clear();
     }
 
     void BindlessPrototypeExampleComponent::LoadComputeShaders()
@@ -21,6 +21,7 @@
 #include <RHI/BasicRHIComponent.h>
 
 #include <Utils/ImGuiSidebar.h>
+#include <Utils/RangeAllocator.h>
 
 #include <BindlessPrototype_Traits_Platform.h>
 
@@ -83,17 +84,24 @@ namespace AtomSampleViewer
 
             // Object index
             FloatBufferHandle m_objectHandle;
+
+            // Position in the lattice
+            AZ::Vector3 m_position;
         };
 
-        // Simple linear allocated buffer of floats
+        // Buffer of floats that is sub-allocated with a free list, so ranges can be released and reused.
+        // Writes go to a CPU copy of the buffer and only the ranges that changed are uploaded by Flush().
         struct FloatBuffer
         {
             static const uint32_t FloatSizeInBytes = static_cast<uint32_t>(sizeof(float));
+
+            // Dirty ranges that are this many floats apart or closer are uploaded as one map
+            static constexpr uint32_t DirtyRangeMergeDistance = 16u;
         public:
             FloatBuffer(AZ::RHI::Ptr<AZ::RHI::BufferPool> bufferPool, const uint32_t sizeInBytes);
             ~FloatBuffer();
 
-            // Allocates data if the provided handle is empty, else it updates it
+            // Allocates data if the provided handle is empty or holds an allocation of a different size, else it updates it
             bool AllocateOrUpdateBuffer(FloatBufferHandle& handle, const void* data, const uint32_t sizeInBytes);
 
             // Allocates data on the FloatBuffer
@@ -102,8 +110,11 @@ namespace AtomSampleViewer
             // Updates already existing data on the FloatBuffer
             bool UpdateBuffer(const FloatBufferHandle& handle, const void* data, const uint32_t sizeInBytes);
 
-            // Maps host data to the device
-            bool MapData(const AZ::RHI::BufferMapRequest& mapRequest, const void* data);
+            // Releases the allocation so it can be reused once the frames in flight are done with it, and resets the handle
+            void Free(FloatBufferHandle& handle);
+
+            // Uploads all the data that was written since the last flush
+            void Flush();
 
             // Create the buffer
             void CreateBufferFromPool(const uint32_t byteCount);
@@ -112,11 +123,22 @@ namespace AtomSampleViewer
             AZ::RHI::Ptr<AZ::RHI::BufferPool> m_bufferPool = nullptr;
             AZ::RHI::Ptr<AZ::RHI::Buffer> m_buffer = nullptr;
 
-            // Number of bytes that are allocated
-            uint32_t m_allocatedInBytes = 0;
+            // Ranges of floats in the buffer
+            RangeAllocator m_allocator;
+
+            // CPU copy of the buffer, and the ranges of it that still need to be uploaded
+            AZStd::vector<float> m_shadowData;
+            DirtyRangeList m_dirtyRanges;
 
             // Total available data in bytes
             uint32_t m_totalSizeInBytes = 0;
+
+            // What the last Flush() uploaded
+            uint32_t m_writeCount = 0;
+            uint32_t m_lastFlushWriteCount = 0;
+            uint32_t m_lastFlushRangeCount = 0;
+            uint32_t m_lastFlushMapCount = 0;
+            uint32_t m_lastFlushSizeInBytes = 0;
         };
 
         // Simple intermediate structure that represents a submesh instance
@@ -165,7 +187,16 @@ namespace AtomSampleViewer
         void DrawImgui();
 
         // Add object for rendering
-        void AddObjectForRender(const PerObject& perObject);
+        void AddObjectForRender(const AZ::Vector3& position);
+
+        // Local to world matrix of an object in the lattice
+        AZ::Matrix4x4 GetObjectTransform(const AZ::Vector3& position) const;
+
+        // Writes the transforms of all objects to the FloatBuffer
+        void UpdateObjectTransforms();
+
+        // Reports the FloatBuffer usage to the sidebar and to scripts
+        void DrawFloatBufferStatistics();
 
         // Clears all objects in the scene
         void ClearObjects();
@@ -246,9 +277,6 @@ namespace AtomSampleViewer
         // Handle holding the world matrix
         FloatBufferHandle m_worldToClipHandle;
 
-        // Handle array holding the FloatBuffer handles for all objects
-        AZStd::vector<FloatBufferHandle> m_objectHandleArray;
-
         // Image array holding all of the StreamImages
         AZStd::vector<AZ::Data::Instance<AZ::RPI::StreamingImage>> m_images;
         // Image array holding all of the Stream cubemap images
@@ -269,6 +297,10 @@ namespace AtomSampleViewer
         int32_t m_objectCountDepth = 1;
         static constexpr float m_meshPositionOffset = 6.0f;
 
+        // Spin all objects, which rewrites every object's data each frame
+        bool m_animateObjects = false;
+        float m_objectAngle = 0.0f;
+
         // Array of sub mesh instances
         AZStd::vector<SubMeshInstance> m_subMeshInstanceArray;
 
@@ -9,6 +9,8 @@
 #include <RHI/CopyQueueComponent.h>
 #include <Utils/Utils.h>
 
+#include <Automation/ScriptableImGui.h>
+#include <Automation/ScriptRunnerBus.h>
 #include <SampleComponentManager.h>
 
 #include <Atom/RHI/CommandList.h>
@@ -19,10 +21,23 @@
 #include <Atom/RPI.Public/Image/StreamingImagePool.h>
 #include <Atom/RPI.Public/Shader/Shader.h>
 #include <Atom/RPI.Reflect/Shader/ShaderAsset.h>
+#include <Atom/RHI.Reflect/ImageSubresource.h>
+#include <AzCore/Math/MathUtils.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/sort.h>
+
+#include <imgui/imgui.h>
 
 namespace AtomSampleViewer
 {
+    namespace CopyQueue
+    {
+        const char* const PayloadSizeNames[] = { "4 KB", "64 KB", "1 MB", "16 MB", "64 MB", "256 MB" };
+        const char* const UploadTypeNames[] = { "Buffers", "Images", "Mixed" };
+        const float TimingSmoothing = 0.05f;
+    }
+
     void CopyQueueComponent::Reflect(AZ::ReflectContext* context)
     {
         if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
@@ -40,6 +55,8 @@ namespace AtomSampleViewer
 
     void CopyQueueComponent::OnFramePrepare(AZ::RHI::FrameGraphBuilder& frameGraphBuilder)
     {
+        UpdateBenchmark();
+
         m_processingState.m_time += ProcessingState::TickAmount;
         m_processingState.m_timeUntilChange -= ProcessingState::TickAmount;
 
@@ -64,6 +81,14 @@ namespace AtomSampleViewer
         BasicRHIComponent::OnFramePrepare(frameGraphBuilder);
     }
 
+    void CopyQueueComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        if (m_imguiSidebar.Begin())
+        {
+            DrawSidebar();
+        }
+    }
+
     void CopyQueueComponent::Activate()
     {
         using namespace AZ;
@@ -266,11 +291,21 @@ namespace AtomSampleViewer
 
         m_processingState = ProcessingState{};
 
+        m_benchmarkResourcesDirty = true;
+        m_lastFrameTime = {};
+
+        m_imguiSidebar.Activate();
+        AZ::TickBus::Handler::BusConnect();
         AZ::RHI::RHISystemNotificationBus::Handler::BusConnect();
     }
 
     void CopyQueueComponent::Deactivate()
     {
+        ReleaseBenchmarkResources();
+        AZ::TickBus::Handler::BusDisconnect();
+        m_imguiSidebar.Deactivate();
+        ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::ClearSampleStatistics);
+
         m_positionBuffer = nullptr;
         m_indexBuffer = nullptr;
         m_uvBuffer = nullptr;
@@ -340,4 +375,391 @@ namespace AtomSampleViewer
         }
     }
 
+    void CopyQueueComponent::CreateBenchmarkResources()
+    {
+        using namespace AZ;
+
+        ReleaseBenchmarkResources();
+
+        const RHI::Ptr<RHI::Device> device = Utils::GetRHIDevice();
+
+        m_payloadSize = PayloadSizes[m_payloadSizeIndex];
+        m_imageWidth = 1;
+        while (uint64_t(m_imageWidth) * m_imageWidth * 4 < m_payloadSize)
+        {
+            m_imageWidth *= 2;
+        }
+
+        // All uploads read the same source data. Its content doesn't matter, but it's written once so the pages are resident.
+        m_sourceData.resize(m_payloadSize);
+        for (size_t i = 0; i < m_sourceData.size(); ++i)
+        {
+            m_sourceData[i] = static_cast<uint8_t>(i);
+        }
+
+        if (m_uploadType != UploadTypeImages)
+        {
+            m_benchmarkBufferPool = RHI::Factory::Get().CreateBufferPool();
+
+            RHI::BufferPoolDescriptor bufferPoolDesc;
+            bufferPoolDesc.m_bindFlags = RHI::BufferBindFlags::ShaderRead;
+            bufferPoolDesc.m_heapMemoryLevel = RHI::HeapMemoryLevel::Device;
+            m_benchmarkBufferPool->Init(*device, bufferPoolDesc);
+        }
+
+        if (m_uploadType != UploadTypeBuffers)
+        {
+            m_benchmarkImagePool = RHI::Factory::Get().CreateStreamingImagePool();
+            m_benchmarkImagePool->Init(*device, RHI::StreamingImagePoolDescriptor{});
+        }
+
+        const uint64_t slotCount = AZStd::clamp<uint64_t>(MaxBytesInFlight / m_payloadSize, 1, m_requestedUploadsInFlight);
+        for (uint64_t i = 0; i < slotCount; ++i)
+        {
+            auto slot = AZStd::make_unique<UploadSlot>();
+            slot->m_isImage = m_uploadType == UploadTypeImages || (m_uploadType == UploadTypeMixed && i % 2 == 1);
+
+            RHI::ResultCode result = RHI::ResultCode::Success;
+            if (slot->m_isImage)
+            {
+                // Each upload replaces mip 0. Streaming images need a resident tail, which is mip 1 here.
+                RHI::ImageDescriptor imageDescriptor =
+                    RHI::ImageDescriptor::Create2D(RHI::ImageBindFlags::ShaderRead, m_imageWidth, m_imageWidth, RHI::Format::R8G8B8A8_UNORM);
+                imageDescriptor.m_mipLevels = 2;
+
+                const RHI::StreamingImageSubresourceData tailSubresource{ m_sourceData.data() };
+                RHI::StreamingImageMipSlice tailMipSlice;
+                tailMipSlice.m_subresources = AZStd::span<const RHI::StreamingImageSubresourceData>(&tailSubresource, 1);
+                tailMipSlice.m_subresourceLayout = RHI::GetImageSubresourceLayout(imageDescriptor.m_size.GetReducedMip(1), imageDescriptor.m_format);
+
+                slot->m_image = RHI::Factory::Get().CreateImage();
+                RHI::StreamingImageInitRequest request(
+                    *slot->m_image, imageDescriptor, AZStd::span<const RHI::StreamingImageMipSlice>(&tailMipSlice, 1));
+                result = m_benchmarkImagePool->InitImage(request);
+            }
+            else
+            {
+                slot->m_buffer = RHI::Factory::Get().CreateBuffer();
+                RHI::BufferInitRequest request(*slot->m_buffer, RHI::BufferDescriptor{ RHI::BufferBindFlags::ShaderRead, m_payloadSize });
+                result = m_benchmarkBufferPool->InitBuffer(request);
+
+                if (result == RHI::ResultCode::Success)
+                {
+                    slot->m_fence = RHI::Factory::Get().CreateFence();
+                    result = slot->m_fence->Init(*device, RHI::FenceState::Reset);
+                }
+            }
+
+            if (result != RHI::ResultCode::Success)
+            {
+                AZ_Error("CopyQueueExample", false, "Failed to create the destination of upload %llu with error code %d", static_cast<unsigned long long>(i), result);
+                break;
+            }
+
+            m_uploadSlots.push_back(AZStd::move(slot));
+        }
+    }
+
+    void CopyQueueComponent::ReleaseBenchmarkResources()
+    {
+        // The destinations have to outlive the uploads to them, and the slots have to outlive their completion callbacks
+        for (auto& slot : m_uploadSlots)
+        {
+            if (slot->m_inFlight)
+            {
+                if (slot->m_fence)
+                {
+                    slot->m_fence->WaitOnCpu();
+                }
+                while (!slot->m_complete.load())
+                {
+                    AZStd::this_thread::yield();
+                }
+            }
+        }
+
+        m_uploadSlots.clear();
+        m_uploadsInFlight = 0;
+        m_benchmarkBufferPool = nullptr;
+        m_benchmarkImagePool = nullptr;
+        m_sourceData = {};
+    }
+
+    void CopyQueueComponent::ResetBenchmarkStatistics()
+    {
+        m_benchmarkStartTime = Clock::now();
+        m_copyBusyEnd = m_benchmarkStartTime;
+        m_copyBusySeconds = 0.0;
+        m_pendingIntervals.clear();
+        m_latencyMs.Reset();
+        m_completedBytes = 0;
+        m_completedUploads = 0;
+        m_failedUploads = 0;
+        m_benchmarkFrames = 0;
+        m_framesOverlappingCopy = 0;
+    }
+
+    void CopyQueueComponent::UpdateBenchmark()
+    {
+        const Clock::time_point now = Clock::now();
+        const bool hasLastFrame = m_lastFrameTime != Clock::time_point{};
+        const float frameMs = AZStd::chrono::duration<float, AZStd::milli>(now - m_lastFrameTime).count();
+        m_lastFrameTime = now;
+
+        RetireCompletedUploads(now);
+
+        if (!m_benchmarkEnabled)
+        {
+            if (!m_uploadSlots.empty() && m_uploadsInFlight == 0)
+            {
+                ReleaseBenchmarkResources();
+            }
+            if (hasLastFrame)
+            {
+                m_averageIdleFrameMs = AZ::Lerp(m_averageIdleFrameMs, frameMs, CopyQueue::TimingSmoothing);
+            }
+            ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::SetSampleStatistic, "IdleFrameMs", m_averageIdleFrameMs);
+            return;
+        }
+
+        if (m_benchmarkResourcesDirty)
+        {
+            // Wait for the uploads of the previous settings to drain, so they don't count towards the new ones
+            if (m_uploadsInFlight > 0)
+            {
+                return;
+            }
+
+            CreateBenchmarkResources();
+            ResetBenchmarkStatistics();
+            m_benchmarkResourcesDirty = false;
+        }
+        else if (hasLastFrame)
+        {
+            m_averageFrameMs = AZ::Lerp(m_averageFrameMs, frameMs, CopyQueue::TimingSmoothing);
+        }
+
+        // Uploads of large payloads are staged on this thread, which is part of what the benchmark measures
+        const Clock::time_point submitStart = Clock::now();
+        SubmitUploads();
+        const float submitMs = AZStd::chrono::duration<float, AZStd::milli>(Clock::now() - submitStart).count();
+        m_averageSubmitMs = AZ::Lerp(m_averageSubmitMs, submitMs, CopyQueue::TimingSmoothing);
+
+        // The graphics work of this frame runs while these uploads are in flight
+        ++m_benchmarkFrames;
+        if (m_uploadsInFlight > 0)
+        {
+            ++m_framesOverlappingCopy;
+        }
+
+        AccumulateCopyBusyTime(Clock::now());
+        PublishBenchmarkStatistics();
+    }
+
+    void CopyQueueComponent::RetireCompletedUploads(Clock::time_point now)
+    {
+        for (auto& slot : m_uploadSlots)
+        {
+            if (!slot->m_inFlight || !slot->m_complete.load())
+            {
+                continue;
+            }
+
+            slot->m_inFlight = false;
+            --m_uploadsInFlight;
+
+            // Uploads submitted before the statistics were reset only count from the reset on
+            const Clock::time_point start = AZStd::max(slot->m_submitTime, m_benchmarkStartTime);
+            const Clock::time_point end = AZStd::min(slot->m_completeTime, now);
+            m_latencyMs.PushValue(AZStd::chrono::duration<float, AZStd::milli>(slot->m_completeTime - slot->m_submitTime).count());
+            m_pendingIntervals.push_back({ start, AZStd::max(start, end) });
+            m_completedBytes += m_payloadSize;
+            ++m_completedUploads;
+        }
+    }
+
+    void CopyQueueComponent::SubmitUploads()
+    {
+        for (auto& slot : m_uploadSlots)
+        {
+            if (slot->m_inFlight)
+            {
+                continue;
+            }
+
+            slot->m_complete = false;
+            slot->m_submitTime = Clock::now();
+            if (!(slot->m_isImage ? SubmitImageUpload(*slot) : SubmitBufferUpload(*slot)))
+            {
+                // Failures would repeat every frame, so stop instead of flooding the log
+                AZ_Error("CopyQueueExample", false, "Failed to submit a %s upload of %llu bytes. Stopping the benchmark.",
+                    slot->m_isImage ? "image" : "buffer", static_cast<unsigned long long>(m_payloadSize));
+                ++m_failedUploads;
+                m_benchmarkEnabled = false;
+                m_benchmarkResourcesDirty = true;
+                return;
+            }
+
+            slot->m_inFlight = true;
+            ++m_uploadsInFlight;
+        }
+    }
+
+    bool CopyQueueComponent::SubmitBufferUpload(UploadSlot& slot)
+    {
+        using namespace AZ;
+
+        slot.m_fence->Reset();
+
+        RHI::BufferStreamRequest request;
+        request.m_fenceToSignal = slot.m_fence.get();
+        request.m_buffer = slot.m_buffer.get();
+        request.m_byteCount = m_payloadSize;
+        request.m_sourceData = m_sourceData.data();
+        if (m_benchmarkBufferPool->StreamBuffer(request) != RHI::ResultCode::Success)
+        {
+            return false;
+        }
+
+        UploadSlot* slotPtr = &slot;
+        return slot.m_fence->WaitOnCpuAsync([slotPtr]()
+            {
+                slotPtr->m_completeTime = Clock::now();
+                slotPtr->m_complete = true;
+            }) == RHI::ResultCode::Success;
+    }
+
+    bool CopyQueueComponent::SubmitImageUpload(UploadSlot& slot)
+    {
+        using namespace AZ;
+
+        // Mip 0 is resident after the previous upload to this image, so evict it to upload it again
+        if (slot.m_image->GetResidentMipLevel() == 0)
+        {
+            m_benchmarkImagePool->TrimImage(*slot.m_image, 1);
+        }
+
+        const RHI::StreamingImageSubresourceData subresource{ m_sourceData.data() };
+        RHI::StreamingImageMipSlice mipSlice;
+        mipSlice.m_subresources = AZStd::span<const RHI::StreamingImageSubresourceData>(&subresource, 1);
+        mipSlice.m_subresourceLayout = RHI::GetImageSubresourceLayout(slot.m_image->GetDescriptor().m_size, RHI::Format::R8G8B8A8_UNORM);
+
+        UploadSlot* slotPtr = &slot;
+        RHI::StreamingImageExpandRequest request;
+        request.m_image = slot.m_image.get();
+        request.m_mipSlices = AZStd::span<const RHI::StreamingImageMipSlice>(&mipSlice, 1);
+        request.m_completeCallback = [slotPtr]()
+        {
+            slotPtr->m_completeTime = Clock::now();
+            slotPtr->m_complete = true;
+        };
+        return m_benchmarkImagePool->ExpandImage(request) == RHI::ResultCode::Success;
+    }
+
+    void CopyQueueComponent::AccumulateCopyBusyTime(Clock::time_point now)
+    {
+        Clock::time_point horizon = now;
+        for (const auto& slot : m_uploadSlots)
+        {
+            if (slot->m_inFlight)
+            {
+                horizon = AZStd::min(horizon, slot->m_submitTime);
+            }
+        }
+
+        AZStd::sort(m_pendingIntervals.begin(), m_pendingIntervals.end(),
+            [](const UploadInterval& lhs, const UploadInterval& rhs) { return lhs.m_start < rhs.m_start; });
+
+        size_t countedIntervals = 0;
+        for (; countedIntervals < m_pendingIntervals.size() && m_pendingIntervals[countedIntervals].m_start <= horizon; ++countedIntervals)
+        {
+            const UploadInterval& interval = m_pendingIntervals[countedIntervals];
+            const Clock::time_point start = AZStd::max(interval.m_start, m_copyBusyEnd);
+            if (interval.m_end > start)
+            {
+                m_copyBusySeconds += AZStd::chrono::duration<double>(interval.m_end - start).count();
+                m_copyBusyEnd = interval.m_end;
+            }
+        }
+        m_pendingIntervals.erase(m_pendingIntervals.begin(), m_pendingIntervals.begin() + countedIntervals);
+    }
+
+    void CopyQueueComponent::PublishBenchmarkStatistics()
+    {
+        const double elapsedSeconds = AZStd::chrono::duration<double>(Clock::now() - m_benchmarkStartTime).count();
+        const double throughputMBps = elapsedSeconds > 0.0 ? m_completedBytes / (1024.0 * 1024.0) / elapsedSeconds : 0.0;
+        const double copyBusyPercent = elapsedSeconds > 0.0 ? 100.0 * m_copyBusySeconds / elapsedSeconds : 0.0;
+        const double overlappingFramesPercent = m_benchmarkFrames > 0 ? 100.0 * m_framesOverlappingCopy / m_benchmarkFrames : 0.0;
+
+        ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::SetSampleStatistic, "PayloadBytes", static_cast<double>(m_payloadSize));
+        ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::SetSampleStatistic, "UploadsInFlight", static_cast<double>(m_uploadSlots.size()));
+        ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::SetSampleStatistic, "UploadType", static_cast<double>(m_uploadType));
+        ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::SetSampleStatistic, "CompletedUploads", static_cast<double>(m_completedUploads));
+        ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::SetSampleStatistic, "FailedUploads", static_cast<double>(m_failedUploads));
+        ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::SetSampleStatistic, "ThroughputMBps", throughputMBps);
+        ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::SetSampleStatistic, "LatencyP50Ms", m_latencyMs.GetQuantile(0.5));
+        ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::SetSampleStatistic, "LatencyP90Ms", m_latencyMs.GetQuantile(0.9));
+        ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::SetSampleStatistic, "LatencyP99Ms", m_latencyMs.GetQuantile(0.99));
+        ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::SetSampleStatistic, "LatencyMaxMs", m_latencyMs.GetMaximum());
+        ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::SetSampleStatistic, "CopyBusyPercent", copyBusyPercent);
+        ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::SetSampleStatistic, "FramesOverlappingCopyPercent", overlappingFramesPercent);
+        ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::SetSampleStatistic, "SubmitMs", m_averageSubmitMs);
+        ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::SetSampleStatistic, "FrameMs", m_averageFrameMs);
+        ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::SetSampleStatistic, "IdleFrameMs", m_averageIdleFrameMs);
+    }
+
+    void CopyQueueComponent::DrawSidebar()
+    {
+        ImGui::Spacing();
+        ImGui::Text("Upload Benchmark");
+
+        bool settingsChanged = ScriptableImGui::Checkbox("Run Benchmark", &m_benchmarkEnabled);
+        settingsChanged |= ScriptableImGui::Combo("Payload Size", &m_payloadSizeIndex, CopyQueue::PayloadSizeNames, PayloadSizeCount);
+        settingsChanged |= ScriptableImGui::SliderInt("Uploads In Flight", &m_requestedUploadsInFlight, 1, MaxUploadsInFlight);
+        settingsChanged |= ScriptableImGui::Combo("Upload Type", &m_uploadType, CopyQueue::UploadTypeNames, static_cast<int>(AZ_ARRAY_SIZE(CopyQueue::UploadTypeNames)));
+        if (settingsChanged)
+        {
+            m_benchmarkResourcesDirty = true;
+        }
+
+        if (!m_benchmarkEnabled)
+        {
+            ImGui::Text("Frame: %.2f ms", m_averageIdleFrameMs);
+            m_imguiSidebar.End();
+            return;
+        }
+
+        if (ScriptableImGui::Button("Reset Statistics"))
+        {
+            ResetBenchmarkStatistics();
+        }
+
+        if (m_uploadSlots.size() < static_cast<size_t>(m_requestedUploadsInFlight))
+        {
+            ImGui::Text("Limited to %zu in flight at this size", m_uploadSlots.size());
+        }
+
+        ImGui::Spacing();
+        ImGui::Separator();
+        ImGui::Spacing();
+
+        const double elapsedSeconds = AZStd::chrono::duration<double>(Clock::now() - m_benchmarkStartTime).count();
+        if (elapsedSeconds > 0.0)
+        {
+            ImGui::Text("Throughput: %.1f MB/s", m_completedBytes / (1024.0 * 1024.0) / elapsedSeconds);
+            ImGui::Text("Copy queue busy: %.1f%% of the time", 100.0 * m_copyBusySeconds / elapsedSeconds);
+        }
+        ImGui::Text("Completed uploads: %llu", static_cast<unsigned long long>(m_completedUploads));
+        ImGui::Text("Latency p50 / p90 / p99: %.2f / %.2f / %.2f ms",
+            m_latencyMs.GetQuantile(0.5), m_latencyMs.GetQuantile(0.9), m_latencyMs.GetQuantile(0.99));
+        ImGui::Text("Latency max: %.2f ms", m_latencyMs.GetMaximum());
+        if (m_benchmarkFrames > 0)
+        {
+            ImGui::Text("Frames with uploads in flight: %.1f%%", 100.0 * m_framesOverlappingCopy / m_benchmarkFrames);
+        }
+        ImGui::Text("Submit: %.3f ms per frame", m_averageSubmitMs);
+        ImGui::Text("Frame: %.2f ms (%.2f ms without uploads)", m_averageFrameMs, m_averageIdleFrameMs);
+
+        m_imguiSidebar.End();
+    }
 } // namespace AtomSampleViewer
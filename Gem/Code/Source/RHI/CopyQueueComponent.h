@@ -9,6 +9,11 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 #include <Atom/RPI.Public/Image/StreamingImage.h>
 #include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
@@ -17,10 +22,14 @@
 #include <Atom/RHI/Device.h>
 #include <Atom/RHI/DrawItem.h>
 #include <Atom/RHI/Factory.h>
+#include <Atom/RHI/Fence.h>
 #include <Atom/RHI/FrameScheduler.h>
 #include <Atom/RHI/PipelineState.h>
+#include <Atom/RHI/StreamingImagePool.h>
 
 #include <RHI/BasicRHIComponent.h>
+#include <Utils/ImGuiSidebar.h>
+#include <Utils/StreamingStatistics.h>
 
 namespace AtomSampleViewer
 {
@@ -29,8 +38,14 @@ namespace AtomSampleViewer
    //! In effect this tests the AsyncUploadQueue class in the RHI back-end implementations.
    //! The expected output is a textured quad where the texture is frequently replaced and the 
    //! position of the quad frequently changes.
+   //!
+   //! The sidebar also has an upload benchmark. It keeps a number of buffer and/or image uploads of a chosen size in flight
+   //! on the copy queue, and reports the throughput, the latency percentiles of each upload, how much of the time the copy
+   //! queue was busy while frames kept rendering, and what that cost the frame time. The results are published as sample
+   //! statistics so scripts can capture them.
     class CopyQueueComponent final
         : public BasicRHIComponent
+        , public AZ::TickBus::Handler
     {
     public:
         AZ_COMPONENT(CopyQueueComponent, "{581AB2F2-C969-4572-9B40-4EE13D862C72}", AZ::Component);
@@ -50,6 +65,9 @@ namespace AtomSampleViewer
         // RHISystemNotificationBus::Handler
         void OnFramePrepare(AZ::RHI::FrameGraphBuilder& frameGraphBuilder) override;
 
+        // AZ::TickBus::Handler
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+
         void UploadTextureAsAsset(const char* filePath, int index);
 
         /// Updates the content of the vertex position buffer to animated based on a time value
@@ -103,6 +121,104 @@ namespace AtomSampleViewer
             "textures/streaming/streaming3.dds.streamingimage",
         };
         AZStd::array<AZ::Data::Instance<AZ::RPI::StreamingImage>, 3> m_images;
+
+        // Upload benchmark
+
+        using Clock = AZStd::chrono::steady_clock;
+
+        enum UploadType : int
+        {
+            UploadTypeBuffers = 0,
+            UploadTypeImages,
+            UploadTypeMixed
+        };
+
+        //! Payload sizes are powers of 4, so an RGBA8 image of the same size is square
+        static constexpr int PayloadSizeCount = 6;
+        static constexpr uint64_t PayloadSizes[PayloadSizeCount] = {
+            4ull * 1024, 64ull * 1024, 1024ull * 1024, 16ull * 1024 * 1024, 64ull * 1024 * 1024, 256ull * 1024 * 1024 };
+        static constexpr int MaxUploadsInFlight = 16;
+
+        //! Caps the GPU memory of the destination resources at large payload sizes
+        static constexpr uint64_t MaxBytesInFlight = 1024ull * 1024 * 1024;
+
+        //! One destination resource and the upload that is in flight to it. The completion is signaled from the thread that
+        //! waits on the copy queue, so it is published through m_complete.
+        struct UploadSlot
+        {
+            bool m_isImage = false;
+            bool m_inFlight = false;
+            Clock::time_point m_submitTime;
+            Clock::time_point m_completeTime;
+            AZStd::atomic_bool m_complete{ false };
+
+            AZ::RHI::Ptr<AZ::RHI::Buffer> m_buffer;
+            AZ::RHI::Ptr<AZ::RHI::Image> m_image;
+
+            // Declared last so it's released first, which waits for any thread that still signals this slot
+            AZ::RHI::Ptr<AZ::RHI::Fence> m_fence;
+        };
+
+        //! Start and end of an upload that completed, for the time the copy queue was busy
+        struct UploadInterval
+        {
+            Clock::time_point m_start;
+            Clock::time_point m_end;
+        };
+
+        //! Creates the destination resources and source data for the current settings. Requires no upload in flight.
+        void CreateBenchmarkResources();
+        void ReleaseBenchmarkResources();
+        void ResetBenchmarkStatistics();
+
+        //! Called once per frame. Retires the completed uploads, submits new ones to the free slots, and updates the statistics.
+        void UpdateBenchmark();
+        void RetireCompletedUploads(Clock::time_point now);
+        void SubmitUploads();
+        bool SubmitBufferUpload(UploadSlot& slot);
+        bool SubmitImageUpload(UploadSlot& slot);
+
+        //! Adds the parts of the completed upload intervals that don't overlap ones already counted to m_copyBusySeconds.
+        //! Only intervals that started before every upload still in flight are counted, so they're counted in start order.
+        void AccumulateCopyBusyTime(Clock::time_point now);
+
+        void PublishBenchmarkStatistics();
+        void DrawSidebar();
+
+        ImGuiSidebar m_imguiSidebar;
+
+        // Settings, changed from the sidebar
+        bool m_benchmarkEnabled = false;
+        int m_payloadSizeIndex = 2;
+        int m_requestedUploadsInFlight = 4;
+        int m_uploadType = UploadTypeBuffers;
+
+        //! Set when the settings change. The resources are recreated once the uploads in flight have completed.
+        bool m_benchmarkResourcesDirty = true;
+
+        AZ::RHI::Ptr<AZ::RHI::BufferPool> m_benchmarkBufferPool;
+        AZ::RHI::Ptr<AZ::RHI::StreamingImagePool> m_benchmarkImagePool;
+        AZStd::vector<AZStd::unique_ptr<UploadSlot>> m_uploadSlots;
+        AZStd::vector<uint8_t> m_sourceData;
+        uint64_t m_payloadSize = 0;
+        uint32_t m_imageWidth = 0;
+        uint32_t m_uploadsInFlight = 0;
+
+        // Statistics since the last reset
+        Clock::time_point m_benchmarkStartTime;
+        Clock::time_point m_lastFrameTime;
+        StreamingStatistics m_latencyMs;
+        AZStd::vector<UploadInterval> m_pendingIntervals;
+        Clock::time_point m_copyBusyEnd;
+        double m_copyBusySeconds = 0.0;
+        uint64_t m_completedBytes = 0;
+        uint64_t m_completedUploads = 0;
+        uint64_t m_failedUploads = 0;
+        uint64_t m_benchmarkFrames = 0;
+        uint64_t m_framesOverlappingCopy = 0;
+        float m_averageSubmitMs = 0.0f;
+        float m_averageFrameMs = 0.0f;
+        float m_averageIdleFrameMs = 0.0f; //!< Frame time while the benchmark is off, to compare against
     };
 } // namespace AtomSampleViewer
 #pragma once
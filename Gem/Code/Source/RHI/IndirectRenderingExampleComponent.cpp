@@ -9,6 +9,7 @@
 #include <RHI/IndirectRenderingExampleComponent.h>
 #include <Utils/Utils.h>
 
+#include <Automation/ScriptRunnerBus.h>
 #include <SampleComponentManager.h>
 
 #include <Atom/RHI/CommandList.h>
@@ -20,6 +21,8 @@
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Math/MathUtils.h>
 #include <AzCore/Math/Random.h>
+#include <AzCore/Math/Simd.h>
+#include <AzCore/std/chrono/chrono.h>
 
 namespace AtomSampleViewer
 {
@@ -33,7 +36,79 @@ namespace AtomSampleViewer
         const char* CulledIndirectBufferAttachmentId = "CulledIndirectBufferAttachmentId";
         const char* CountBufferAttachmentId  = "CountBufferAttachmentId";
         const char* DepthBufferAttachmentId = "DepthBufferAttachmentId";
+        const char* InstanceOffsetsAttachmentId = "InstanceOffsetsAttachmentId";
+        const char* InstanceVelocitiesAttachmentId = "InstanceVelocitiesAttachmentId";
         const AZ::Vector2 VelocityRange(0.1f, 0.3f);
+        const float OffsetBounds = 2.5f;
+        const size_t InstancesPerJob = 16 * 1024;
+        const float TimingSmoothing = 0.05f;
+
+        uint32_t Hash(uint32_t value)
+        {
+            value ^= value >> 16;
+            value *= 0x7feb352du;
+            value ^= value >> 15;
+            value *= 0x846ca68bu;
+            value ^= value >> 16;
+            return value;
+        }
+
+        // Velocity of an instance that starts again from the left. The same as in IndirectInstanceUpdate.azsl.
+        float GetRandomVelocity(uint32_t index, uint32_t seed)
+        {
+            const float random = static_cast<float>(Hash(index ^ Hash(seed)) & 0xFFFFFFu) / 16777216.0f;
+            return AZ::Lerp(VelocityRange.GetX(), VelocityRange.GetY(), random);
+        }
+
+        void WrapInstance(float* offsets, float* velocities, size_t index, uint32_t seed)
+        {
+            if (offsets[index] > OffsetBounds)
+            {
+                offsets[index] = -OffsetBounds;
+                velocities[index] = GetRandomVelocity(aznumeric_cast<uint32_t>(index), seed);
+            }
+        }
+
+        // Reads the instance offsets that the GPU path updates in place
+        void UseInstanceOffsetsAttachment(AZ::RHI::FrameGraphInterface frameGraph, uint32_t instanceCount)
+        {
+            AZ::RHI::BufferScopeAttachmentDescriptor descriptor;
+            descriptor.m_attachmentId = InstanceOffsetsAttachmentId;
+            descriptor.m_loadStoreAction.m_loadAction = AZ::RHI::AttachmentLoadAction::Load;
+            descriptor.m_bufferViewDescriptor = AZ::RHI::BufferViewDescriptor::CreateStructured(0, instanceCount, sizeof(float));
+            frameGraph.UseShaderAttachment(descriptor, AZ::RHI::ScopeAttachmentAccess::Read);
+        }
+
+        // Moves the instances in [begin, end) the same way IndirectInstanceUpdate.azsl does on the GPU
+        void IntegrateInstances(float* offsets, float* velocities, size_t begin, size_t end, float deltaTime, uint32_t seed)
+        {
+            using namespace AZ::Simd;
+
+            const Vec4::FloatType deltaTimes = Vec4::Splat(deltaTime);
+            const Vec4::FloatType bounds = Vec4::Splat(OffsetBounds);
+
+            size_t index = begin;
+            for (; index + 4 <= end; index += 4)
+            {
+                const Vec4::FloatType moved = Vec4::Madd(Vec4::LoadUnaligned(velocities + index), deltaTimes, Vec4::LoadUnaligned(offsets + index));
+                Vec4::StoreUnaligned(offsets + index, moved);
+
+                // Few instances reach the bounds in any frame, so those are wrapped one at a time
+                if (!Vec4::CmpAllLtEq(moved, bounds))
+                {
+                    for (size_t lane = index; lane < index + 4; ++lane)
+                    {
+                        WrapInstance(offsets, velocities, lane, seed);
+                    }
+                }
+            }
+
+            for (; index < end; ++index)
+            {
+                offsets[index] += velocities[index] * deltaTime;
+                WrapInstance(offsets, velocities, index, seed);
+            }
+        }
     }
 
     float GetRandomFloat(float min, float max)
@@ -60,6 +135,12 @@ namespace AtomSampleViewer
 
     void IndirectRenderingExampleComponent::OnTick(float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
+        m_averageFrameMs = AZ::Lerp(m_averageFrameMs, deltaTime * 1000.0f, IndirectRendering::TimingSmoothing);
+
+        // The settings below are drawn after the update, so a path picked in the UI takes effect on the next frame.
+        // The GPU path needs the instance update pipeline; without it the instances keep moving on the CPU.
+        m_activeUpdatePath = (m_updatePath == UpdatePathGpu && m_instanceUpdatePipelineState) ? UpdatePathGpu : UpdatePathCpu;
+
         UpdateInstancesData(deltaTime);
         if (m_updateIndirectDispatchArguments)
         {
@@ -107,6 +188,14 @@ namespace AtomSampleViewer
                 RHI::BufferBindFlags::Indirect | RHI::BufferBindFlags::ShaderReadWrite,
                 m_indirectDrawBufferSignature->GetByteStride() * m_numObjects);
             builder.CreateTransientBuffer(culledCommandsBufferDesc);
+
+            if (IsGpuUpdateActive())
+            {
+                // The GPU path moves the instances in place, so the motion buffers go through the frame graph
+                // to get the barriers between the update, the culling and the drawing.
+                builder.ImportBuffer(RHI::AttachmentId{ IndirectRendering::InstanceOffsetsAttachmentId }, m_instanceOffsetsBuffer);
+                builder.ImportBuffer(RHI::AttachmentId{ IndirectRendering::InstanceVelocitiesAttachmentId }, m_instanceVelocitiesBuffer);
+            }
         }
 
         BasicRHIComponent::OnFramePrepare(frameGraphBuilder);
@@ -153,11 +242,6 @@ namespace AtomSampleViewer
 
             SetFullScreenRect(bufferData.m_quadPositions.data(), nullptr, bufferData.m_quadIndices.data());
 
-            for (uint32_t i = 0; i < bufferData.m_instanceIndices.size(); ++i)
-            {
-                bufferData.m_instanceIndices[i] = i;
-            }
-
             m_inputAssemblyBuffer = RHI::Factory::Get().CreateBuffer();
 
             RHI::BufferInitRequest request;
@@ -231,11 +315,26 @@ namespace AtomSampleViewer
                 return;
             }
 
+            // The instance indices are too many to live in BufferData with the geometry
+            AZStd::vector<uint32_t> instanceIndices(s_maxNumberOfObjects);
+            for (uint32_t i = 0; i < s_maxNumberOfObjects; ++i)
+            {
+                instanceIndices[i] = i;
+            }
+
+            m_instanceIndicesBuffer = RHI::Factory::Get().CreateBuffer();
+
+            request = {};
+            request.m_buffer = m_instanceIndicesBuffer.get();
+            request.m_descriptor = RHI::BufferDescriptor{ RHI::BufferBindFlags::InputAssembly, sizeof(uint32_t) * instanceIndices.size() };
+            request.m_initialData = instanceIndices.data();
+            m_inputAssemblyBufferPool->InitBuffer(request);
+
             instancesIndicesStreamBufferView =
             {
-                *m_inputAssemblyBuffer,
-                offsetof(BufferData, m_instanceIndices),
-                sizeof(BufferData::m_instanceIndices),
+                *m_instanceIndicesBuffer,
+                0,
+                static_cast<uint32_t>(sizeof(uint32_t) * instanceIndices.size()),
                 sizeof(uint32_t)
             };
 
@@ -515,21 +614,24 @@ namespace AtomSampleViewer
         uint32_t maxIndirectDrawCount = device->GetLimits().m_maxIndirectDrawCount;
 
         // Populate the data for each instance using some random values.
-        m_instancesData.resize(s_maxNumberOfObjects);
-        for (InstanceData& data : m_instancesData)
+        // The x offset and the velocity are animated, and live in m_instanceOffsetsX and m_instanceVelocitiesX instead.
+        AZStd::vector<InstanceData> instancesData(s_maxNumberOfObjects);
+        for (uint32_t i = 0; i < s_maxNumberOfObjects; ++i)
         {
+            InstanceData& data = instancesData[i];
             float scale = GetRandomFloat(0.01, 0.1f);
-            data.m_offset = AZ::Vector4(GetRandomFloat(-4.0f, -2.0f), GetRandomFloat(-1.f, 1.f), GetRandomFloat(0.f, 1.f), 0.f);
+            data.m_offset = AZ::Vector4(m_instanceOffsetsX[i], GetRandomFloat(-1.f, 1.f), GetRandomFloat(0.f, 1.f), 0.f);
             data.m_scale = AZ::Vector4(scale, scale, 1.f, 0.f);
             data.m_color = AZ::Color(GetRandomFloat(0.5f, 1.0f), GetRandomFloat(0.5f, 1.0f), GetRandomFloat(0.5f, 1.0f), 1.0f);
-            data.m_velocity.Set(GetRandomFloat(IndirectRendering::VelocityRange.GetX(), IndirectRendering::VelocityRange.GetY()));
+            data.m_velocity.Set(m_instanceVelocitiesX[i]);
         }
 
+        // This data never changes, so it is kept in device memory rather than read over the bus every frame.
         m_instancesBufferPool = RHI::Factory::Get().CreateBufferPool();
 
         RHI::BufferPoolDescriptor bufferPoolDesc;
         bufferPoolDesc.m_bindFlags = RHI::BufferBindFlags::ShaderRead;
-        bufferPoolDesc.m_heapMemoryLevel = RHI::HeapMemoryLevel::Host;
+        bufferPoolDesc.m_heapMemoryLevel = RHI::HeapMemoryLevel::Device;
         m_instancesBufferPool->Init(*device, bufferPoolDesc);
 
         m_instancesDataBuffer = RHI::Factory::Get().CreateBuffer();
@@ -539,10 +641,10 @@ namespace AtomSampleViewer
         request.m_descriptor = RHI::BufferDescriptor{
             RHI::BufferBindFlags::ShaderRead,
             sizeof(InstanceData) * s_maxNumberOfObjects };
-        request.m_initialData = m_instancesData.data();
+        request.m_initialData = instancesData.data();
         m_instancesBufferPool->InitBuffer(request);
 
-        auto descriptor = RHI::BufferViewDescriptor::CreateStructured(0, static_cast<uint32_t>(m_instancesData.size()), sizeof(InstanceData));
+        auto descriptor = RHI::BufferViewDescriptor::CreateStructured(0, s_maxNumberOfObjects, sizeof(InstanceData));
         m_instancesDataBufferView = m_instancesDataBuffer->GetBufferView(descriptor);
                   
         if(!m_instancesDataBufferView.get())
@@ -581,12 +683,15 @@ namespace AtomSampleViewer
 
         {
             const Name instancesDataId{ "m_instancesData" };
+            const Name instanceOffsetsId{ "m_instanceOffsetsX" };
             const Name matrixId{ "m_matrix" };
 
             FindShaderInputIndex(&m_sceneInstancesDataBufferIndex, m_sceneShaderResourceGroup, instancesDataId, IndirectRendering::SampleName);
+            FindShaderInputIndex(&m_sceneInstanceOffsetsBufferIndex, m_sceneShaderResourceGroup, instanceOffsetsId, IndirectRendering::SampleName);
             FindShaderInputIndex(&m_sceneMatrixInputIndex, m_sceneShaderResourceGroup, matrixId, IndirectRendering::SampleName);
             float screenAspect = GetViewportWidth() / GetViewportHeight();
             m_sceneShaderResourceGroup->SetBufferView(m_sceneInstancesDataBufferIndex, m_instancesDataBufferView.get());
+            m_sceneShaderResourceGroup->SetBufferView(m_sceneInstanceOffsetsBufferIndex, m_instanceOffsetsRingBufferViews[m_instanceOffsetsRingIndex].get());
             m_sceneShaderResourceGroup->SetConstant(m_sceneMatrixInputIndex, AZ::Matrix4x4::CreateScale(AZ::Vector3(1.f/ screenAspect, 1.f, 1.f)));
             m_sceneShaderResourceGroup->Compile();
         }
@@ -597,6 +702,179 @@ namespace AtomSampleViewer
         }
     }
 
+    void IndirectRenderingExampleComponent::InitInstanceMotionResources()
+    {
+        RHI::Ptr<RHI::Device> device = Utils::GetRHIDevice();
+
+        m_instanceOffsetsX.resize(s_maxNumberOfObjects);
+        m_instanceVelocitiesX.resize(s_maxNumberOfObjects);
+        for (uint32_t i = 0; i < s_maxNumberOfObjects; ++i)
+        {
+            m_instanceOffsetsX[i] = GetRandomFloat(-4.0f, -2.0f);
+            m_instanceVelocitiesX[i] = GetRandomFloat(IndirectRendering::VelocityRange.GetX(), IndirectRendering::VelocityRange.GetY());
+        }
+
+        // The ring of buffers the CPU path uploads the offsets through
+        {
+            m_instanceOffsetsRingBufferPool = RHI::Factory::Get().CreateBufferPool();
+
+            RHI::BufferPoolDescriptor bufferPoolDesc;
+            bufferPoolDesc.m_bindFlags = RHI::BufferBindFlags::ShaderRead;
+            bufferPoolDesc.m_heapMemoryLevel = RHI::HeapMemoryLevel::Host;
+            m_instanceOffsetsRingBufferPool->Init(*device, bufferPoolDesc);
+
+            const uint32_t byteCount = sizeof(float) * s_maxNumberOfObjects;
+            for (uint32_t i = 0; i < s_instanceOffsetsRingSize; ++i)
+            {
+                m_instanceOffsetsRingBuffers[i] = RHI::Factory::Get().CreateBuffer();
+
+                RHI::BufferInitRequest request;
+                request.m_buffer = m_instanceOffsetsRingBuffers[i].get();
+                request.m_descriptor = RHI::BufferDescriptor{ RHI::BufferBindFlags::ShaderRead, byteCount };
+                request.m_initialData = m_instanceOffsetsX.data();
+                m_instanceOffsetsRingBufferPool->InitBuffer(request);
+
+                m_instanceOffsetsRingBufferViews[i] = m_instanceOffsetsRingBuffers[i]->GetBufferView(
+                    RHI::BufferViewDescriptor::CreateStructured(0, s_maxNumberOfObjects, sizeof(float)));
+
+                // Host memory is coherent, so the buffer is mapped once instead of every frame. It's unmapped in Deactivate().
+                RHI::BufferMapRequest mapRequest(*m_instanceOffsetsRingBuffers[i], 0, byteCount);
+                RHI::BufferMapResponse mapResponse;
+                m_instanceOffsetsRingBufferPool->MapBuffer(mapRequest, mapResponse);
+                m_instanceOffsetsRingData[i] = static_cast<float*>(mapResponse.m_data);
+            }
+        }
+
+        // The compute pre-pass of the GPU path
+        {
+            m_instanceMotionBufferPool = RHI::Factory::Get().CreateBufferPool();
+
+            RHI::BufferPoolDescriptor bufferPoolDesc;
+            bufferPoolDesc.m_bindFlags = RHI::BufferBindFlags::ShaderReadWrite;
+            bufferPoolDesc.m_heapMemoryLevel = RHI::HeapMemoryLevel::Device;
+            m_instanceMotionBufferPool->Init(*device, bufferPoolDesc);
+
+            m_instanceUpdateShader = LoadShader(*m_assetLoadManager.get(), IndirectInstanceUpdateShaderFilePath, IndirectRendering::SampleName);
+            if (!m_instanceUpdateShader)
+            {
+                return;
+            }
+
+            RHI::PipelineStateDescriptorForDispatch pipelineStateDescriptor;
+            m_instanceUpdateShader->GetVariant(RPI::RootShaderVariantStableId).ConfigurePipelineState(pipelineStateDescriptor);
+            m_instanceUpdatePipelineState = m_instanceUpdateShader->AcquirePipelineState(pipelineStateDescriptor);
+            if (!m_instanceUpdatePipelineState)
+            {
+                AZ_Error(IndirectRendering::SampleName, false, "Failed to acquire default pipeline state for shader '%s'", IndirectInstanceUpdateShaderFilePath);
+                return;
+            }
+
+            m_instanceUpdateShaderResourceGroup = CreateShaderResourceGroup(m_instanceUpdateShader, "InstanceUpdateSrg", IndirectRendering::SampleName);
+
+            FindShaderInputIndex(&m_updateOffsetsBufferIndex, m_instanceUpdateShaderResourceGroup, Name{ "m_offsetsX" }, IndirectRendering::SampleName);
+            FindShaderInputIndex(&m_updateVelocitiesBufferIndex, m_instanceUpdateShaderResourceGroup, Name{ "m_velocitiesX" }, IndirectRendering::SampleName);
+            FindShaderInputIndex(&m_updateDeltaTimeIndex, m_instanceUpdateShaderResourceGroup, Name{ "m_deltaTime" }, IndirectRendering::SampleName);
+            FindShaderInputIndex(&m_updateOffsetBoundsIndex, m_instanceUpdateShaderResourceGroup, Name{ "m_offsetBounds" }, IndirectRendering::SampleName);
+            FindShaderInputIndex(&m_updateVelocityRangeIndex, m_instanceUpdateShaderResourceGroup, Name{ "m_velocityRange" }, IndirectRendering::SampleName);
+            FindShaderInputIndex(&m_updateNumInstancesIndex, m_instanceUpdateShaderResourceGroup, Name{ "m_numInstances" }, IndirectRendering::SampleName);
+            FindShaderInputIndex(&m_updateSeedIndex, m_instanceUpdateShaderResourceGroup, Name{ "m_seed" }, IndirectRendering::SampleName);
+
+            m_instanceUpdateShaderResourceGroup->SetConstant(m_updateOffsetBoundsIndex, IndirectRendering::OffsetBounds);
+            m_instanceUpdateShaderResourceGroup->SetConstant(m_updateVelocityRangeIndex, IndirectRendering::VelocityRange);
+        }
+    }
+
+    void IndirectRenderingExampleComponent::CreateGpuInstanceMotionBuffers()
+    {
+        // New buffers are created from the CPU copy rather than written in place, because frames that are still
+        // in flight may be using the current ones.
+        auto createBuffer = [this](const AZStd::vector<float>& initialData, RHI::Ptr<RHI::Buffer>& buffer, RHI::Ptr<RHI::BufferView>& bufferView)
+        {
+            buffer = RHI::Factory::Get().CreateBuffer();
+
+            RHI::BufferInitRequest request;
+            request.m_buffer = buffer.get();
+            request.m_descriptor = RHI::BufferDescriptor{ RHI::BufferBindFlags::ShaderReadWrite, sizeof(float) * initialData.size() };
+            request.m_initialData = initialData.data();
+            m_instanceMotionBufferPool->InitBuffer(request);
+
+            bufferView = buffer->GetBufferView(RHI::BufferViewDescriptor::CreateStructured(0, static_cast<uint32_t>(initialData.size()), sizeof(float)));
+        };
+
+        createBuffer(m_instanceOffsetsX, m_instanceOffsetsBuffer, m_instanceOffsetsBufferView);
+        createBuffer(m_instanceVelocitiesX, m_instanceVelocitiesBuffer, m_instanceVelocitiesBufferView);
+
+        m_instanceUpdateShaderResourceGroup->SetBufferView(m_updateOffsetsBufferIndex, m_instanceOffsetsBufferView.get());
+        m_instanceUpdateShaderResourceGroup->SetBufferView(m_updateVelocitiesBufferIndex, m_instanceVelocitiesBufferView.get());
+
+        m_gpuInstanceMotionCurrent = true;
+    }
+
+    void IndirectRenderingExampleComponent::CreateInstanceUpdateScope()
+    {
+        // This scope moves the instances on the GPU path. It does nothing on the CPU path.
+        struct InstanceUpdateScopeData
+        {
+            bool m_dispatch = false;
+            uint32_t m_numInstances = 0;
+        };
+
+        const auto prepareFunction = [this](RHI::FrameGraphInterface frameGraph, InstanceUpdateScopeData& scopeData)
+        {
+            scopeData.m_dispatch = IsGpuUpdateActive();
+            scopeData.m_numInstances = m_numObjects;
+            if (!scopeData.m_dispatch)
+            {
+                return;
+            }
+
+            for (const char* attachmentId : { IndirectRendering::InstanceOffsetsAttachmentId, IndirectRendering::InstanceVelocitiesAttachmentId })
+            {
+                RHI::BufferScopeAttachmentDescriptor descriptor;
+                descriptor.m_attachmentId = attachmentId;
+                descriptor.m_loadStoreAction.m_loadAction = RHI::AttachmentLoadAction::Load;
+                descriptor.m_bufferViewDescriptor = RHI::BufferViewDescriptor::CreateStructured(0, s_maxNumberOfObjects, sizeof(float));
+                frameGraph.UseShaderAttachment(descriptor, RHI::ScopeAttachmentAccess::ReadWrite);
+            }
+
+            frameGraph.SetEstimatedItemCount(1);
+        };
+
+        RHI::EmptyCompileFunction<InstanceUpdateScopeData> compileFunction;
+
+        const auto executeFunction = [this](const RHI::FrameGraphExecuteContext& context, const InstanceUpdateScopeData& scopeData)
+        {
+            if (!scopeData.m_dispatch)
+            {
+                return;
+            }
+
+            RHI::DispatchDirect dispatchArgs;
+            dispatchArgs.m_threadsPerGroupX = IndirectRendering::ThreadGroupSize;
+            dispatchArgs.m_totalNumberOfThreadsX = scopeData.m_numInstances;
+
+            RHI::DispatchItem dispatchItem;
+            dispatchItem.m_arguments = dispatchArgs;
+            dispatchItem.m_pipelineState = m_instanceUpdatePipelineState.get();
+            dispatchItem.m_shaderResourceGroups[0] = m_instanceUpdateShaderResourceGroup->GetRHIShaderResourceGroup();
+            dispatchItem.m_shaderResourceGroupCount = 1;
+
+            context.GetCommandList()->Submit(dispatchItem);
+        };
+
+        m_scopeProducers.emplace_back(
+            aznew RHI::ScopeProducerFunction<
+            InstanceUpdateScopeData,
+            decltype(prepareFunction),
+            decltype(compileFunction),
+            decltype(executeFunction)>(
+                RHI::ScopeId{ "IndirectInstanceUpdateScope" },
+                InstanceUpdateScopeData{},
+                prepareFunction,
+                compileFunction,
+                executeFunction));
+    }
+
     void IndirectRenderingExampleComponent::CreateResetCounterBufferScope()
     {
         // This scope resets the count buffer value to 0 every frame.
@@ -668,6 +946,11 @@ namespace AtomSampleViewer
             culledBufferAttachment.m_bufferViewDescriptor = RHI::BufferViewDescriptor::CreateStructured(0, m_numObjects, commandsStride);
             frameGraph.UseShaderAttachment(culledBufferAttachment, RHI::ScopeAttachmentAccess::ReadWrite);
 
+            if (IsGpuUpdateActive())
+            {
+                IndirectRendering::UseInstanceOffsetsAttachment(frameGraph, s_maxNumberOfObjects);
+            }
+
             if (m_deviceSupportsCountBuffer)
             {
                 // The count buffer that we will be writing the final count of operations.
@@ -813,6 +1096,11 @@ namespace AtomSampleViewer
                 frameGraph.UseAttachment(descriptor, RHI::ScopeAttachmentAccess::Read, RHI::ScopeAttachmentUsage::Indirect);
             }
 
+            if (IsGpuUpdateActive())
+            {
+                IndirectRendering::UseInstanceOffsetsAttachment(frameGraph, s_maxNumberOfObjects);
+            }
+
             frameGraph.SetEstimatedItemCount(uint32_t(std::ceil(m_numObjects/ float(maxIndirectDrawCount))));
         };
 
@@ -871,7 +1159,13 @@ namespace AtomSampleViewer
     {
         using namespace AZ;
 
-        m_numObjects = s_maxNumberOfObjects / 2;
+        m_numObjects = s_defaultNumberOfObjects;
+        m_updatePath = UpdatePathCpu;
+        m_activeUpdatePath = UpdatePathCpu;
+        m_gpuInstanceMotionCurrent = false;
+        m_instanceOffsetsRingIndex = 0;
+        m_averageFrameMs = 0.0f;
+        m_averageCpuUpdateMs = 0.0f;
 
         RHI::Ptr<RHI::Device> device = Utils::GetRHIDevice();
 
@@ -901,6 +1195,7 @@ namespace AtomSampleViewer
         AZStd::vector<AssetCollectionAsyncLoader::AssetToLoadInfo> assetList = {
             {IndirectDrawShaderFilePath, azrtti_typeid<RPI::ShaderAsset>()},
             {IndirectDispatchShaderFilePath, azrtti_typeid<RPI::ShaderAsset>()},
+            {IndirectInstanceUpdateShaderFilePath, azrtti_typeid<RPI::ShaderAsset>()},
         };
 
         // Configure the imgui progress list widget.
@@ -937,12 +1232,15 @@ namespace AtomSampleViewer
         InitInputAssemblyResources();
         InitShaderResources();
         InitIndirectRenderingResources();
+        InitInstanceMotionResources();
         InitInstancesDataResources();
 
-        // We use 3 scopes.
-        // The first one is for reseting the count buffer to 0.
-        // The second one is the compute scope in charge of culling.
+        // We use 4 scopes.
+        // The first one moves the instances when they are updated on the GPU.
+        // The second one is for reseting the count buffer to 0.
+        // The third one is the compute scope in charge of culling.
         // The last one is the graphic scope in charge of rendering the culled primitives.
+        CreateInstanceUpdateScope();
         if (m_deviceSupportsCountBuffer)
         {
             CreateResetCounterBufferScope();
@@ -958,12 +1256,34 @@ namespace AtomSampleViewer
 
     void IndirectRenderingExampleComponent::Deactivate()
     {
+        for (uint32_t i = 0; i < s_instanceOffsetsRingSize; ++i)
+        {
+            if (m_instanceOffsetsRingData[i])
+            {
+                m_instanceOffsetsRingBufferPool->UnmapBuffer(*m_instanceOffsetsRingBuffers[i]);
+                m_instanceOffsetsRingData[i] = nullptr;
+            }
+        }
+        m_instanceOffsetsRingBufferViews.fill(nullptr);
+        m_instanceOffsetsRingBuffers.fill(nullptr);
+        m_instanceOffsetsRingBufferPool = nullptr;
+
+        m_instanceOffsetsBufferView = nullptr;
+        m_instanceVelocitiesBufferView = nullptr;
+        m_instanceOffsetsBuffer = nullptr;
+        m_instanceVelocitiesBuffer = nullptr;
+        m_instanceMotionBufferPool = nullptr;
+        m_instanceUpdatePipelineState = nullptr;
+        m_instanceUpdateShaderResourceGroup = nullptr;
+        m_instanceUpdateShader = nullptr;
+
         m_inputAssemblyBufferPool = nullptr;
         m_shaderBufferPool = nullptr;
         m_instancesBufferPool = nullptr;
         m_copyBufferPool = nullptr;
 
         m_inputAssemblyBuffer = nullptr;
+        m_instanceIndicesBuffer = nullptr;
         m_sourceIndirectBuffer = nullptr;
         m_instancesDataBuffer = nullptr;
         m_resetCounterBuffer = nullptr;
@@ -983,7 +1303,8 @@ namespace AtomSampleViewer
         m_indirectDrawBufferSignature = nullptr;
         m_indirectDispatchBufferSignature = nullptr;
 
-        m_instancesData.clear();
+        m_instanceOffsetsX = {};
+        m_instanceVelocitiesX = {};
 
         m_imguiSidebar.Deactivate();
         AzFramework::WindowNotificationBus::Handler::BusDisconnect();
@@ -1003,33 +1324,96 @@ namespace AtomSampleViewer
         {
             m_updateIndirectDispatchArguments = true;
         }
+
+        ImGui::Spacing();
+        ImGui::Text("Instance Update");
+        ScriptableImGui::RadioButton("CPU (SIMD jobs, ring buffer upload)", &m_updatePath, UpdatePathCpu);
+        ScriptableImGui::RadioButton("GPU (compute pre-pass)", &m_updatePath, UpdatePathGpu);
+
+        ImGui::Spacing();
+        ImGui::Separator();
+        ImGui::Spacing();
+
+        ImGui::Text("Frame: %.2f ms", m_averageFrameMs);
+        ImGui::Text("CPU update: %.3f ms", m_averageCpuUpdateMs);
+        ImGui::Text("Upload: %.2f MB per frame", m_uploadedBytes / (1024.0f * 1024.0f));
+
         m_imguiSidebar.End();
     }
 
     void IndirectRenderingExampleComponent::UpdateInstancesData(float deltaTime)
     {
-        using namespace AZ;
-        AZ::SimpleLcgRandom random;
-        const float offsetBounds = 2.5f;
-        for (uint32_t i = 0; i < m_numObjects; ++i)
+        const auto startTime = AZStd::chrono::steady_clock::now();
+
+        ++m_updateSeed;
+        if (m_activeUpdatePath == UpdatePathGpu)
+        {
+            UpdateInstancesOnGpu(deltaTime);
+        }
+        else
+        {
+            UpdateInstancesOnCpu(deltaTime);
+        }
+
+        const float updateMs = AZStd::chrono::duration<float, AZStd::milli>(AZStd::chrono::steady_clock::now() - startTime).count();
+        m_averageCpuUpdateMs = AZ::Lerp(m_averageCpuUpdateMs, updateMs, IndirectRendering::TimingSmoothing);
+
+        ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::SetSampleStatistic, "InstanceCount", static_cast<double>(m_numObjects));
+        ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::SetSampleStatistic, "GpuUpdate", m_activeUpdatePath == UpdatePathGpu ? 1.0 : 0.0);
+        ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::SetSampleStatistic, "FrameMs", m_averageFrameMs);
+        ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::SetSampleStatistic, "CpuUpdateMs", m_averageCpuUpdateMs);
+        ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::SetSampleStatistic, "UploadBytes", static_cast<double>(m_uploadedBytes));
+    }
+
+    void IndirectRenderingExampleComponent::UpdateInstancesOnCpu(float deltaTime)
+    {
+        // Only the live instances are uploaded, into the ring buffer that the GPU finished reading the longest time ago.
+        // Each job copies the offsets it just moved while they are still in the cache.
+        m_instanceOffsetsRingIndex = (m_instanceOffsetsRingIndex + 1) % s_instanceOffsetsRingSize;
+
+        float* offsets = m_instanceOffsetsX.data();
+        float* velocities = m_instanceVelocitiesX.data();
+        float* ringData = m_instanceOffsetsRingData[m_instanceOffsetsRingIndex];
+        const uint32_t seed = m_updateSeed;
+        Utils::ParallelForChunks(m_numObjects, IndirectRendering::InstancesPerJob, [=](size_t begin, size_t end)
         {
-            m_instancesData[i].m_offset.SetX(m_instancesData[i].m_offset.GetX() + m_instancesData[i].m_velocity.GetX() * deltaTime);
-            if (m_instancesData[i].m_offset.GetX() > offsetBounds)
+            IndirectRendering::IntegrateInstances(offsets, velocities, begin, end, deltaTime, seed);
+            if (ringData)
             {
-                m_instancesData[i].m_offset.SetX(-offsetBounds);
-                m_instancesData[i].m_velocity.Set(GetRandomFloat(IndirectRendering::VelocityRange.GetX(), IndirectRendering::VelocityRange.GetY()));
+                ::memcpy(ringData + begin, offsets + begin, sizeof(float) * (end - begin));
             }
-        }
+        });
+        m_uploadedBytes = ringData ? static_cast<uint32_t>(sizeof(float) * m_numObjects) : 0;
+
+        m_sceneShaderResourceGroup->SetBufferView(m_sceneInstanceOffsetsBufferIndex, m_instanceOffsetsRingBufferViews[m_instanceOffsetsRingIndex].get());
+        m_sceneShaderResourceGroup->Compile();
 
-        RHI::BufferMapRequest request(*m_instancesDataBuffer, 0, sizeof(InstanceData) * m_numObjects);
-        RHI::BufferMapResponse response;
+        // The GPU motion buffers fall behind. Switching back to the GPU path recreates them from the CPU copy.
+        m_gpuInstanceMotionCurrent = false;
+    }
 
-        m_instancesBufferPool->MapBuffer(request, response);
-        if (response.m_data)
+    void IndirectRenderingExampleComponent::UpdateInstancesOnGpu(float deltaTime)
+    {
+        // The CPU copy isn't updated on this path, so switching back to the CPU path continues from where the GPU path started
+        if (!m_gpuInstanceMotionCurrent)
         {
-            ::memcpy(response.m_data, m_instancesData.data(), request.m_byteCount);
-            m_instancesBufferPool->UnmapBuffer(*m_instancesDataBuffer);
+            CreateGpuInstanceMotionBuffers();
         }
+
+        m_instanceUpdateShaderResourceGroup->SetConstant(m_updateDeltaTimeIndex, deltaTime);
+        m_instanceUpdateShaderResourceGroup->SetConstant(m_updateNumInstancesIndex, m_numObjects);
+        m_instanceUpdateShaderResourceGroup->SetConstant(m_updateSeedIndex, m_updateSeed);
+        m_instanceUpdateShaderResourceGroup->Compile();
+
+        m_sceneShaderResourceGroup->SetBufferView(m_sceneInstanceOffsetsBufferIndex, m_instanceOffsetsBufferView.get());
+        m_sceneShaderResourceGroup->Compile();
+
+        m_uploadedBytes = 0;
+    }
+
+    bool IndirectRenderingExampleComponent::IsGpuUpdateActive() const
+    {
+        return m_activeUpdatePath == UpdatePathGpu && m_gpuInstanceMotionCurrent && m_instanceUpdatePipelineState;
     }
 
     void IndirectRenderingExampleComponent::OnWindowResized(uint32_t width, uint32_t height)
@@ -1048,7 +1432,7 @@ namespace AtomSampleViewer
 
         RHI::DispatchDirect args;
         args.m_threadsPerGroupX = IndirectRendering::ThreadGroupSize;
-        args.m_totalNumberOfThreadsX = aznumeric_cast<uint16_t>(m_numObjects);
+        args.m_totalNumberOfThreadsX = m_numObjects;
         m_indirectDispatchWriter->Dispatch(args);
 
         m_indirectDispatchWriter->Flush();
@@ -30,6 +30,7 @@
 #include <Atom/RHI/PipelineState.h>
 
 #include <Atom/RHI.Reflect/IndirectBufferLayout.h>
+#include <Atom/RHI.Reflect/Limits.h>
 
 #include <RHI/BasicRHIComponent.h>
 #include <Utils/ImGuiSidebar.h>
@@ -44,9 +45,14 @@ namespace AtomSampleViewer
     //! The commands are generated at initialization by the CPU. Each frame
     //! a compute shader culls the commands that are outside a designated area
     //! and the remaining commands are draw using indirect calls.
-    //! The sample has two user control variables:
-    //! - The number of primitives to render
+    //! The sample has three user control variables:
+    //! - The number of primitives to render, up to a million
     //! - The cull area.
+    //! - Whether the primitives are moved on the CPU or the GPU.
+    //!
+    //! Only the x offset of each primitive changes, so it is kept in its own buffer. The CPU path integrates
+    //! it with SIMD over job system chunks and writes only the live range into a persistently mapped ring buffer.
+    //! The GPU path moves the primitives in a compute pre-pass and uploads nothing.
     //!
     //! Depending on the capabilities of the platform the sample can run the following indirect commands:
     //! 1) - Inline Constants Command
@@ -77,12 +83,19 @@ namespace AtomSampleViewer
         static constexpr char LogName[] = "IndirectRenderingExampleComponent";
         static constexpr char IndirectDrawShaderFilePath[] = "Shaders/RHI/IndirectDraw.azshader";
         static constexpr char IndirectDispatchShaderFilePath[] = "Shaders/RHI/IndirectDispatch.azshader";
+        static constexpr char IndirectInstanceUpdateShaderFilePath[] = "Shaders/RHI/IndirectInstanceUpdate.azshader";
         static constexpr char IndirectDrawVariantLabel[] = "IndirectDraw variant";
         static constexpr char IndirectDispatchVariantLabel[] = "IndirectDispatch variant";
 
     private:
         /// Max number of objects to render.
-        static const uint32_t s_maxNumberOfObjects = 4096;
+        static const uint32_t s_maxNumberOfObjects = 1024 * 1024;
+
+        /// Number of objects to render when the sample starts.
+        static const uint32_t s_defaultNumberOfObjects = 2048;
+
+        /// Number of instance offset buffers the CPU path cycles through, so it never writes to one the GPU may still be reading.
+        static const uint32_t s_instanceOffsetsRingSize = AZ::RHI::Limits::Device::FrameCountMax;
 
         /// Data to be use for Input Assembly.
         struct BufferData
@@ -91,7 +104,6 @@ namespace AtomSampleViewer
             AZStd::array<VertexPosition, 4> m_quadPositions;
             AZStd::array<uint16_t, 3> m_triangleIndices;
             AZStd::array<uint16_t, 6> m_quadIndices;
-            AZStd::array<uint32_t, s_maxNumberOfObjects> m_instanceIndices;
         };
 
         /// Data specific to an object.
@@ -119,6 +131,13 @@ namespace AtomSampleViewer
 
         static const uint32_t NumSequencesType = static_cast<uint32_t>(SequenceType::Count);
 
+        /// Where the instances are moved each frame.
+        enum UpdatePath : int
+        {
+            UpdatePathCpu = 0,      // SIMD integration over job system chunks, uploaded through a ring buffer.
+            UpdatePathGpu           // Compute pre-pass, nothing is uploaded.
+        };
+
         // AZ::Component
         void Activate() override;
         void Deactivate() override;
@@ -143,11 +162,18 @@ namespace AtomSampleViewer
         void InitShaderResources();
         void InitIndirectRenderingResources();
         void InitInstancesDataResources();
+        void InitInstanceMotionResources();
+        void CreateGpuInstanceMotionBuffers();
+        void CreateInstanceUpdateScope();
         void CreateResetCounterBufferScope();
         void CreateCullingScope();
         void CreateDrawingScope();
         void DrawSampleSettings();
         void UpdateInstancesData(float deltaTime);
+        void UpdateInstancesOnCpu(float deltaTime);
+        void UpdateInstancesOnGpu(float deltaTime);
+        // Whether this frame's instances were moved by the compute pre-pass, so its motion buffers must be imported and used
+        bool IsGpuUpdateActive() const;
         void UpdateIndirectDispatchArguments();
 
         AZ::RHI::InputStreamLayout m_inputStreamLayout;
@@ -158,6 +184,7 @@ namespace AtomSampleViewer
         AZ::RHI::Ptr<AZ::RHI::BufferPool> m_copyBufferPool;
 
         AZ::RHI::Ptr<AZ::RHI::Buffer> m_inputAssemblyBuffer;
+        AZ::RHI::Ptr<AZ::RHI::Buffer> m_instanceIndicesBuffer;
         AZ::RHI::Ptr<AZ::RHI::Buffer> m_sourceIndirectBuffer;
         AZ::RHI::Ptr<AZ::RHI::Buffer> m_instancesDataBuffer;
         AZ::RHI::Ptr<AZ::RHI::Buffer> m_resetCounterBuffer;
@@ -185,6 +212,7 @@ namespace AtomSampleViewer
         AZ::RHI::Ptr<AZ::RHI::IndirectBufferSignature> m_indirectDispatchBufferSignature;
 
         AZ::RHI::ShaderInputBufferIndex m_sceneInstancesDataBufferIndex;
+        AZ::RHI::ShaderInputBufferIndex m_sceneInstanceOffsetsBufferIndex;
         AZ::RHI::ShaderInputConstantIndex m_sceneMatrixInputIndex;
         AZ::RHI::ShaderInputBufferIndex m_cullingCountBufferIndex;
         AZ::RHI::ShaderInputConstantIndex m_cullingOffsetIndex;
@@ -204,7 +232,44 @@ namespace AtomSampleViewer
 
         uint32_t m_numObjects = 0;
 
-        AZStd::vector<InstanceData> m_instancesData;
+        // Instance motion, as structure of arrays. Only the x offset of an instance changes.
+        AZStd::vector<float> m_instanceOffsetsX;
+        AZStd::vector<float> m_instanceVelocitiesX;
+        uint32_t m_updateSeed = 0;
+
+        int m_updatePath = UpdatePathCpu; // Selected in the UI
+        int m_activeUpdatePath = UpdatePathCpu; // Used for the current frame, picked at the start of each tick
+        // Whether the GPU motion buffers hold the latest instance offsets. They are recreated from the CPU copy when they don't.
+        bool m_gpuInstanceMotionCurrent = false;
+
+        // CPU path. Each ring buffer stays mapped for as long as it exists.
+        AZ::RHI::Ptr<AZ::RHI::BufferPool> m_instanceOffsetsRingBufferPool;
+        AZStd::array<AZ::RHI::Ptr<AZ::RHI::Buffer>, s_instanceOffsetsRingSize> m_instanceOffsetsRingBuffers;
+        AZStd::array<AZ::RHI::Ptr<AZ::RHI::BufferView>, s_instanceOffsetsRingSize> m_instanceOffsetsRingBufferViews;
+        AZStd::array<float*, s_instanceOffsetsRingSize> m_instanceOffsetsRingData = {};
+        uint32_t m_instanceOffsetsRingIndex = 0;
+
+        // GPU path
+        AZ::RHI::Ptr<AZ::RHI::BufferPool> m_instanceMotionBufferPool;
+        AZ::RHI::Ptr<AZ::RHI::Buffer> m_instanceOffsetsBuffer;
+        AZ::RHI::Ptr<AZ::RHI::Buffer> m_instanceVelocitiesBuffer;
+        AZ::RHI::Ptr<AZ::RHI::BufferView> m_instanceOffsetsBufferView;
+        AZ::RHI::Ptr<AZ::RHI::BufferView> m_instanceVelocitiesBufferView;
+        AZ::RHI::ConstPtr<AZ::RHI::PipelineState> m_instanceUpdatePipelineState;
+        AZ::Data::Instance<AZ::RPI::Shader> m_instanceUpdateShader;
+        AZ::Data::Instance<AZ::RPI::ShaderResourceGroup> m_instanceUpdateShaderResourceGroup;
+        AZ::RHI::ShaderInputBufferIndex m_updateOffsetsBufferIndex;
+        AZ::RHI::ShaderInputBufferIndex m_updateVelocitiesBufferIndex;
+        AZ::RHI::ShaderInputConstantIndex m_updateDeltaTimeIndex;
+        AZ::RHI::ShaderInputConstantIndex m_updateOffsetBoundsIndex;
+        AZ::RHI::ShaderInputConstantIndex m_updateVelocityRangeIndex;
+        AZ::RHI::ShaderInputConstantIndex m_updateNumInstancesIndex;
+        AZ::RHI::ShaderInputConstantIndex m_updateSeedIndex;
+
+        // Timings, smoothed over recent frames
+        float m_averageFrameMs = 0.0f;
+        float m_averageCpuUpdateMs = 0.0f;
+        uint32_t m_uploadedBytes = 0;
 
         SequenceType m_mode = SequenceType::DrawOnly;
         bool m_updateIndirectDispatchArguments = false;
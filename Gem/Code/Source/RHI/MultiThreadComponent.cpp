@@ -7,21 +7,38 @@
  */
 #include <RHI/MultiThreadComponent.h>
 
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Math/MathUtils.h>
 #include <AzCore/Math/MatrixUtils.h>
+#include <AzCore/std/chrono/chrono.h>
 
 #include <Atom/RHI/DrawItem.h>
 #include <Atom/RHI.Reflect/RenderAttachmentLayoutBuilder.h>
 #include <Atom/RPI.Public/Shader/Shader.h>
 #include <AzCore/Math/Random.h>
+#include <Automation/ScriptableImGui.h>
+#include <Automation/ScriptRunnerBus.h>
 #include <SampleComponentManager.h>
 #include <Utils/Utils.h>
 
+#include <imgui/imgui.h>
+
 
 namespace AtomSampleViewer
 {
     // static const variables.
     const AZ::Vector3 MultiThreadComponent::m_up = AZ::Vector3(0.0f, 1.0f, 0.0f);
 
+    namespace
+    {
+        using Clock = AZStd::chrono::steady_clock;
+
+        uint32_t MicrosecondsSince(Clock::time_point startTime)
+        {
+            return aznumeric_cast<uint32_t>(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(Clock::now() - startTime).count());
+        }
+    }
+
     void MultiThreadComponent::Reflect(AZ::ReflectContext* context)
     {
         if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
@@ -35,59 +52,170 @@ namespace AtomSampleViewer
     MultiThreadComponent::MultiThreadComponent()
     {
         m_depthStencilID = AZ::RHI::AttachmentId{ "DepthStencilID" };
-
-        uint32_t index = 0;
-
-        // Create positions for each cube
-        for (uint32_t j = 0; j < s_cubesPerLine*s_cubeSpacing; j+= s_cubeSpacing)
-        {
-            for (uint32_t i = 0; i < s_cubesPerLine*s_cubeSpacing; i+= s_cubeSpacing)
-            {
-                m_cubeTransforms[index] = AZ::Matrix4x4::CreateTranslation(AZ::Vector3(static_cast<float>(i), static_cast<float>(j), 0.0f));
-                ++index;
-            }
-        }
-
         m_supportRHISamplePipeline = true;
     }
 
     void MultiThreadComponent::OnFramePrepare(AZ::RHI::FrameGraphBuilder& frameGraphBuilder)
     {
         m_time += 0.005f;
+
+        // The scopes of the previous frame have finished executing, so the cubes can be rebuilt here
+        if (m_numberOfCubes != aznumeric_cast<uint32_t>(m_cubesPerLine * m_cubesPerLine))
+        {
+            CreateCubes();
+        }
+
         BasicRHIComponent::OnFramePrepare(frameGraphBuilder);
     }
 
-    void MultiThreadComponent::Activate()
+    void MultiThreadComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
-        // This is done here instead of doing it in the constructor, 
-        // since m_windowContext might not be yet initialized at construction time. 
-        float fieldOfView = AZ::Constants::Pi / 4.0f;
-        float screenAspect = GetViewportWidth() / GetViewportHeight();
-
-        float heighOfCubePlane = static_cast<float>(s_cubesPerLine * s_cubeSpacing);
-        float distanceFromCubePlane = 1.0f * (1 / tanf(fieldOfView/2)) * heighOfCubePlane/2;
+        UpdateTimings();
 
-        float centerOfScreen = heighOfCubePlane/2;
-        AZ::Vector3 m_worldPosition = AZ::Vector3(centerOfScreen, centerOfScreen, distanceFromCubePlane);
-        m_lookAt = AZ::Vector3(centerOfScreen, centerOfScreen, 0.0f);
-        MakePerspectiveFovMatrixRH(m_viewProjMatrix, fieldOfView, screenAspect, m_zNear, m_zFar);
-        m_viewProjMatrix = m_viewProjMatrix * CreateViewMatrix(m_worldPosition, m_up, m_lookAt);
+        if (m_imguiSidebar.Begin())
+        {
+            DrawSidebar();
+        }
+    }
 
+    void MultiThreadComponent::Activate()
+    {
         CreateInputAssemblyBuffer();
         CreatePipeline();
+        CreateCubes();
         CreateScope();
+
+        m_imguiSidebar.Activate();
+        AZ::TickBus::Handler::BusConnect();
         AZ::RHI::RHISystemNotificationBus::Handler::BusConnect();
     }
 
     void MultiThreadComponent::Deactivate()
     {
         AZ::RHI::RHISystemNotificationBus::Handler::BusDisconnect();
+        AZ::TickBus::Handler::BusDisconnect();
+        m_imguiSidebar.Deactivate();
+        ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::ClearSampleStatistics);
+
         m_windowContext = nullptr;
         m_bufferPool = nullptr;
         m_inputAssemblyBuffer = nullptr;
-        m_shaderResourceGroups.fill(nullptr);
+        m_shaderResourceGroups.clear();
+        m_sceneShaderResourceGroup = nullptr;
+        m_shader = nullptr;
         m_pipelineState = nullptr;
         m_scopeProducers.clear();
+        m_numberOfCubes = 0;
+        m_averageRecordMs.clear();
+    }
+
+    void MultiThreadComponent::CreateCubes()
+    {
+        const uint32_t cubesPerLine = aznumeric_cast<uint32_t>(AZStd::clamp<int>(m_cubesPerLine, 1, s_maxCubesPerLine));
+        m_cubesPerLine = aznumeric_cast<int>(cubesPerLine);
+        m_numberOfCubes = cubesPerLine * cubesPerLine;
+
+        // Create positions for each cube
+        m_cubeTransforms.resize(m_numberOfCubes);
+        uint32_t index = 0;
+        for (uint32_t j = 0; j < cubesPerLine * s_cubeSpacing; j += s_cubeSpacing)
+        {
+            for (uint32_t i = 0; i < cubesPerLine * s_cubeSpacing; i += s_cubeSpacing)
+            {
+                m_cubeTransforms[index] = AZ::Matrix4x4::CreateTranslation(AZ::Vector3(static_cast<float>(i), static_cast<float>(j), 0.0f));
+                ++index;
+            }
+        }
+
+        // Frame the camera on the cube plane. This is done here instead of doing it in the constructor,
+        // since m_windowContext might not be yet initialized at construction time.
+        float fieldOfView = AZ::Constants::Pi / 4.0f;
+        float screenAspect = GetViewportWidth() / GetViewportHeight();
+
+        float heighOfCubePlane = static_cast<float>(cubesPerLine * s_cubeSpacing);
+        float distanceFromCubePlane = 1.0f * (1 / tanf(fieldOfView/2)) * heighOfCubePlane/2;
+
+        float centerOfScreen = heighOfCubePlane/2;
+        AZ::Vector3 worldPosition = AZ::Vector3(centerOfScreen, centerOfScreen, distanceFromCubePlane);
+        m_lookAt = AZ::Vector3(centerOfScreen, centerOfScreen, 0.0f);
+        MakePerspectiveFovMatrixRH(m_viewProjMatrix, fieldOfView, screenAspect, m_zNear, AZStd::max(m_zFar, distanceFromCubePlane * 2.0f));
+        m_viewProjMatrix = m_viewProjMatrix * CreateViewMatrix(worldPosition, m_up, m_lookAt);
+
+        if (!m_shader)
+        {
+            return;
+        }
+
+        // The view-projection matrix is shared by every cube, so it's only written when the cubes change
+        m_sceneShaderResourceGroup->SetConstant(m_shaderIndexViewProj, m_viewProjMatrix);
+        m_sceneShaderResourceGroup->Compile();
+
+        // Existing SRGs are kept, so growing the cube count only creates the new ones
+        const size_t previousCount = m_shaderResourceGroups.size();
+        m_shaderResourceGroups.resize(m_numberOfCubes);
+        for (size_t i = previousCount; i < m_shaderResourceGroups.size(); ++i)
+        {
+            m_shaderResourceGroups[i] = CreateShaderResourceGroup(m_shader, "MultiThreadInstanceSrg", "MultiThreadComponent");
+        }
+
+        if (previousCount == 0 && !m_shaderResourceGroups.empty())
+        {
+            FindShaderInputIndex(&m_shaderIndexWorldMat, m_shaderResourceGroups[0], AZ::Name{"m_worldMatrix"}, "MultiThreadComponent");
+        }
+    }
+
+    void MultiThreadComponent::UpdateTimings()
+    {
+        constexpr float Smoothing = 0.05f;
+        m_averagePrepareMs = AZ::Lerp(m_averagePrepareMs, m_prepareMicroseconds.load() / 1000.0f, Smoothing);
+        m_averageCompileMs = AZ::Lerp(m_averageCompileMs, m_compileMicroseconds.load() / 1000.0f, Smoothing);
+
+        const size_t commandListCount = AZStd::min(m_commandListCount.load(), s_maxTimedCommandLists);
+        if (m_averageRecordMs.size() != commandListCount)
+        {
+            // Statistics of command lists that no longer exist would otherwise linger
+            ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::ClearSampleStatistics);
+            m_averageRecordMs.resize(commandListCount, 0.0f);
+        }
+
+        float totalRecordMs = 0.0f;
+        for (size_t i = 0; i < commandListCount; ++i)
+        {
+            m_averageRecordMs[i] = AZ::Lerp(m_averageRecordMs[i], m_recordMicroseconds[i].load() / 1000.0f, Smoothing);
+            totalRecordMs += m_averageRecordMs[i];
+
+            ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::SetSampleStatistic,
+                AZStd::string::format("RecordCommandList%zuMs", i), m_averageRecordMs[i]);
+        }
+
+        ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::SetSampleStatistic, "DrawCount", static_cast<double>(m_shaderResourceGroups.size()));
+        ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::SetSampleStatistic, "CommandListCount", static_cast<double>(commandListCount));
+        ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::SetSampleStatistic, "ParallelCompile", m_parallelCompile ? 1.0 : 0.0);
+        ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::SetSampleStatistic, "PrepareMs", m_averagePrepareMs);
+        ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::SetSampleStatistic, "CompileMs", m_averageCompileMs);
+        ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::SetSampleStatistic, "RecordTotalMs", totalRecordMs);
+    }
+
+    void MultiThreadComponent::DrawSidebar()
+    {
+        ImGui::Spacing();
+        ScriptableImGui::SliderInt("Cubes Per Line", &m_cubesPerLine, 1, s_maxCubesPerLine);
+        ImGui::Text("Draw calls: %zu", m_shaderResourceGroups.size());
+        ScriptableImGui::Checkbox("Parallel SRG Compile", &m_parallelCompile);
+
+        ImGui::Spacing();
+        ImGui::Separator();
+        ImGui::Spacing();
+
+        ImGui::Text("Prepare: %.3f ms", m_averagePrepareMs);
+        ImGui::Text("Compile: %.3f ms", m_averageCompileMs);
+        ImGui::Text("Record, %zu command lists:", m_averageRecordMs.size());
+        for (size_t i = 0; i < m_averageRecordMs.size(); ++i)
+        {
+            ImGui::Text("  Command list %zu: %.3f ms", i, m_averageRecordMs[i]);
+        }
+
+        m_imguiSidebar.End();
     }
 
     MultiThreadComponent::SingleCubeBufferData MultiThreadComponent::CreateSingleCubeBufferData(const AZ::Vector4 color)
@@ -214,9 +342,10 @@ namespace AtomSampleViewer
         const char* shaderFilePath = "Shaders/RHI/MultiThread.azshader";
         const char* sampleName = "MultiThreadComponent";
 
-        auto shader = LoadShader(shaderFilePath, sampleName);
-        if (shader == nullptr)
+        m_shader = LoadShader(shaderFilePath, sampleName);
+        if (m_shader == nullptr)
             return;
+        auto shader = m_shader;
 
         const AZ::RHI::Ptr<AZ::RHI::Device> device = Utils::GetRHIDevice();
         AZ::RHI::PipelineStateDescriptorForDraw pipelineDesc;
@@ -243,22 +372,21 @@ namespace AtomSampleViewer
         if (!perInstanceSrgLayout)
         {
             AZ_Error("MultiThreadComponent", false, "Failed to get shader resource group layout");
+            m_shader = nullptr;
             return;
         }
 
-        for (int i = 0; i < s_numberOfCubes; ++i)
-        {
-            m_shaderResourceGroups[i] = CreateShaderResourceGroup(shader, "MultiThreadInstanceSrg", sampleName);
-
-            FindShaderInputIndex(&m_shaderIndexWorldMat, m_shaderResourceGroups[i], AZ::Name{"m_worldMatrix"}, "MultiThreadComponent");
-            FindShaderInputIndex(&m_shaderIndexViewProj, m_shaderResourceGroups[i], AZ::Name{"m_viewProjMatrix"}, "MultiThreadComponent");
-        }
+        // The per-instance SRGs are created by CreateCubes(), since their number changes at runtime
+        m_sceneShaderResourceGroup = CreateShaderResourceGroup(shader, "MultiThreadSceneSrg", sampleName);
+        FindShaderInputIndex(&m_shaderIndexViewProj, m_sceneShaderResourceGroup, AZ::Name{"m_viewProjMatrix"}, "MultiThreadComponent");
     }
 
     void MultiThreadComponent::CreateScope()
     {
         const auto prepareFunction = [this](AZ::RHI::FrameGraphInterface frameGraph, [[maybe_unused]] ScopeData& scopeData)
         {
+            const Clock::time_point startTime = Clock::now();
+
             // Binds the swap chain as a color attachment. Clears it to black.
             {
                 AZ::RHI::ImageScopeAttachmentDescriptor descriptor;
@@ -287,25 +415,43 @@ namespace AtomSampleViewer
                 frameGraph.UseDepthStencilAttachment(dsDesc, AZ::RHI::ScopeAttachmentAccess::Write);
             }
 
-            // We will submit s_numberOfCubes draw items.
-            frameGraph.SetEstimatedItemCount(s_numberOfCubes);
+            // We will submit one draw item per cube.
+            frameGraph.SetEstimatedItemCount(aznumeric_cast<uint32_t>(m_shaderResourceGroups.size()));
+
+            m_prepareMicroseconds = MicrosecondsSince(startTime);
         };
 
         const auto compileFunction = [this]([[maybe_unused]] const AZ::RHI::FrameGraphCompileContext& context, [[maybe_unused]] const ScopeData& scopeData)
         {
-            AZ::Matrix4x4 rotation = AZ::Matrix4x4::CreateRotationY(m_time);
+            const Clock::time_point startTime = Clock::now();
+
+            const AZ::Matrix4x4 rotation = AZ::Matrix4x4::CreateRotationY(m_time);
+            const auto compileCubes = [this, &rotation](size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    m_shaderResourceGroups[i]->SetConstant(m_shaderIndexWorldMat, m_cubeTransforms[i] * rotation);
+                    m_shaderResourceGroups[i]->Compile();
+                }
+            };
 
-            for(int i = 0; i<s_numberOfCubes; ++i)
+            // Each cube has its own SRG, so contiguous chunks of them can be updated and queued for compile on separate jobs
+            if (m_parallelCompile)
             {
-                AZ::Matrix4x4 transform = m_cubeTransforms[i] * rotation;
-                m_shaderResourceGroups[i]->SetConstant(m_shaderIndexWorldMat, transform);
-                m_shaderResourceGroups[i]->SetConstant(m_shaderIndexViewProj, m_viewProjMatrix);
-                m_shaderResourceGroups[i]->Compile();
+                Utils::ParallelForChunks(m_shaderResourceGroups.size(), s_cubesPerCompileJob, compileCubes);
             }
+            else
+            {
+                compileCubes(0, m_shaderResourceGroups.size());
+            }
+
+            m_compileMicroseconds = MicrosecondsSince(startTime);
         };
 
         const auto executeFunction = [this](const AZ::RHI::FrameGraphExecuteContext& context, [[maybe_unused]] const ScopeData& scopeData)
         {
+            const Clock::time_point startTime = Clock::now();
+
             AZ::RHI::CommandList* commandList = context.GetCommandList();
 
             // Set persistent viewport and scissor state.
@@ -319,14 +465,18 @@ namespace AtomSampleViewer
             if (context.GetCommandListIndex() == context.GetCommandListCount() - 1)
             {
 #if defined(AZ_DEBUG_BUILD)
-                AZ_Printf("MultiThread", "Draw Calls: %d \n", s_numberOfCubes);
+                AZ_Printf("MultiThread", "Draw Calls: %zu \n", m_shaderResourceGroups.size());
                 AZ_Printf("MultiThread", "Num CommandLists: %d \n", context.GetCommandListCount());
 #endif
             }
             
             for (uint32_t i = context.GetSubmitRange().m_startIndex; i < context.GetSubmitRange().m_endIndex; ++i)
             {
-                const AZ::RHI::ShaderResourceGroup* shaderResourceGroups[] = { m_shaderResourceGroups[i]->GetRHIShaderResourceGroup() };
+                const AZ::RHI::ShaderResourceGroup* shaderResourceGroups[] =
+                {
+                    m_shaderResourceGroups[i]->GetRHIShaderResourceGroup(),
+                    m_sceneShaderResourceGroup->GetRHIShaderResourceGroup()
+                };
 
                 AZ::RHI::DrawItem drawItem;
                 drawItem.m_arguments = drawIndexed;
@@ -339,6 +489,17 @@ namespace AtomSampleViewer
 
                 commandList->Submit(drawItem, i);
             }
+
+            // Command lists are recorded in parallel, each one only writes its own slot
+            const uint32_t commandListIndex = context.GetCommandListIndex();
+            if (commandListIndex < s_maxTimedCommandLists)
+            {
+                m_recordMicroseconds[commandListIndex] = MicrosecondsSince(startTime);
+            }
+            if (commandListIndex == 0)
+            {
+                m_commandListCount = context.GetCommandListCount();
+            }
         };
 
         m_scopeProducers.emplace_back(
@@ -8,6 +8,11 @@
 #pragma once
 
 #include <RHI/BasicRHIComponent.h>
+#include <Utils/ImGuiSidebar.h>
+
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
 
 #include <Atom/RHI/Buffer.h>
 #include <Atom/RHI/BufferPool.h>
@@ -22,8 +27,14 @@ namespace AtomSampleViewer
     //! evaluate performance numbers to ensure parallelization by FrameScheduler.
     //! There will be one model rendered multiple times over multiple command lists with thousands 
     //! of draw calls with a total of million plus polygons.
+    //!
+    //! The number of cubes can be changed at runtime, up to more than 100K draws, to measure how the CPU side of the
+    //! frame scales with cores. The per-cube SRG updates and compiles can be split across the job system, and the
+    //! view-projection matrix lives in a single per-scene SRG. The CPU time of each phase (prepare, compile, and
+    //! recording each command list) is shown in the sidebar and published as sample statistics for scripts.
     class MultiThreadComponent final
         : public BasicRHIComponent
+        , public AZ::TickBus::Handler
     {
     public:
         AZ_COMPONENT(MultiThreadComponent, "{45950624-28A3-4946-B0FE-E07A640DC6CF}", AZ::Component);
@@ -39,9 +50,11 @@ namespace AtomSampleViewer
         void Deactivate() override;
 
     protected:
-        // We decrease the number of cubes on mobile due to performance.
-        static const uint32_t s_cubesPerLine = ATOMSAMPLEVIEWER_TRAIT_MULTITHREAD_SAMPLE_CUBES_PER_LINE;
-        static const uint32_t s_numberOfCubes = s_cubesPerLine* s_cubesPerLine;
+        // We decrease the default number of cubes on mobile due to performance.
+        static const uint32_t s_defaultCubesPerLine = ATOMSAMPLEVIEWER_TRAIT_MULTITHREAD_SAMPLE_CUBES_PER_LINE;
+        static constexpr uint32_t s_maxCubesPerLine = 320; // 102,400 cubes
+        static constexpr uint32_t s_cubesPerCompileJob = 256;
+        static constexpr uint32_t s_maxTimedCommandLists = 64;
         static const uint32_t s_geometryVertexCount = 24;
         static const uint32_t s_geometryIndexCount = 36;
 
@@ -60,11 +73,21 @@ namespace AtomSampleViewer
         // RHISystemNotificationBus::Handler
         void OnFramePrepare(AZ::RHI::FrameGraphBuilder& frameGraphBuilder) override;
 
+        // AZ::TickBus::Handler
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+
         SingleCubeBufferData CreateSingleCubeBufferData(const AZ::Vector4 color);
         void CreateInputAssemblyBuffer();
         void CreatePipeline();
         void CreateScope();
 
+        //! Rebuilds the cube transforms and per-instance SRGs for m_cubesPerLine, and frames the camera on them
+        void CreateCubes();
+
+        //! Folds the timings measured by the scope callbacks of the last frame into the smoothed ones and publishes them
+        void UpdateTimings();
+        void DrawSidebar();
+
         AZ::Matrix4x4 m_viewProjMatrix;
         static constexpr float m_zNear = 1.0f;
         static constexpr float m_zFar = 1000.0f;
@@ -73,7 +96,11 @@ namespace AtomSampleViewer
         static const uint32_t s_cubeSpacing = 3;
         float m_time = 0.0f;
 
-        AZStd::array<AZ::Matrix4x4, s_numberOfCubes> m_cubeTransforms;
+        int m_cubesPerLine = s_defaultCubesPerLine; //< Changed from the sidebar, applied by CreateCubes() in OnFramePrepare()
+        uint32_t m_numberOfCubes = 0;
+        bool m_parallelCompile = true;
+
+        AZStd::vector<AZ::Matrix4x4> m_cubeTransforms;
 
         AZ::RHI::Ptr<AZ::RHI::BufferPool> m_bufferPool;
         AZ::RHI::Ptr<AZ::RHI::Buffer> m_inputAssemblyBuffer;
@@ -81,10 +108,26 @@ namespace AtomSampleViewer
         AZ::RHI::InputStreamLayout m_streamLayoutDescriptor;
         AZ::RHI::ConstPtr<AZ::RHI::PipelineState> m_pipelineState;
 
-        AZStd::array<AZ::Data::Instance<AZ::RPI::ShaderResourceGroup>, s_numberOfCubes> m_shaderResourceGroups;
+        AZ::Data::Instance<AZ::RPI::Shader> m_shader;
+        AZ::Data::Instance<AZ::RPI::ShaderResourceGroup> m_sceneShaderResourceGroup;
+        AZStd::vector<AZ::Data::Instance<AZ::RPI::ShaderResourceGroup>> m_shaderResourceGroups;
         AZ::RHI::ShaderInputConstantIndex m_shaderIndexWorldMat;
         AZ::RHI::ShaderInputConstantIndex m_shaderIndexViewProj;
 
+        // CPU time of each phase of the last frame, written by the scope callbacks and read in UpdateTimings().
+        // Command lists are recorded in parallel, so each one writes its own slot.
+        AZStd::atomic<uint32_t> m_prepareMicroseconds{ 0 };
+        AZStd::atomic<uint32_t> m_compileMicroseconds{ 0 };
+        AZStd::atomic<uint32_t> m_commandListCount{ 0 };
+        AZStd::array<AZStd::atomic<uint32_t>, s_maxTimedCommandLists> m_recordMicroseconds = {};
+
+        // Smoothed timings shown in the sidebar, in milliseconds
+        float m_averagePrepareMs = 0.0f;
+        float m_averageCompileMs = 0.0f;
+        AZStd::vector<float> m_averageRecordMs;
+
+        ImGuiSidebar m_imguiSidebar;
+
         AZ::RHI::AttachmentId m_depthStencilID;
         AZStd::array<AZ::RHI::StreamBufferView, 2> m_streamBufferViews;
         AZ::RHI::IndexBufferView m_indexBufferView;
@@ -7,6 +7,7 @@
  */
 
 #include <RHI/SphericalHarmonicsExampleComponent.h>
+#include <Utils/SphericalHarmonicsProjection.h>
 #include <Utils/Utils.h>
 
 #include <SampleComponentManager.h>
@@ -21,6 +22,7 @@
 #include <Atom/RPI.Reflect/Shader/ShaderAsset.h>
 
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/chrono/chrono.h>
 
 #include <Atom/Component/DebugCamera/ArcBallControllerBus.h>
 #include <Atom/Component/DebugCamera/ArcBallControllerComponent.h>
@@ -28,7 +30,6 @@
 
 #include <Atom/Feature/SphericalHarmonics/SphericalHarmonicsUtility.h>
 
-#include <random>
 #include <sstream>
 
 namespace AtomSampleViewer
@@ -44,9 +45,26 @@ namespace AtomSampleViewer
         const char* demoShaderFilePath   = "Shaders/RHI/shdemo.azshader";
         const char* renderShaderFilePath = "Shaders/RHI/shrender.azshader";
 
-        // uniform distribution generator & sampler
-        std::default_random_engine generator;
-        std::uniform_real_distribution<double> distribution(0.0, 1.0);
+        // number of Hammersley points the fake light is integrated with
+        const uint32_t fakeLightSampleCount = 256 * 1024;
+
+        // the projection utility evaluates the SH basis itself, check that it matches the one used by the solvers of this sample
+        void ValidateProjectionBasis()
+        {
+            float dir[3] = { 0.48f, 0.6f, 0.64f };
+            float basis[SphericalHarmonicsProjection::CoefficientCount];
+            SphericalHarmonicsProjection::EvaluateBasis(dir, basis);
+
+            for (int l = 0; l < 4; ++l)
+            {
+                for (int m = -l; m <= l; ++m)
+                {
+                    [[maybe_unused]] const float expected = AZ::Render::SHBasis::Naive16(l, m, dir);
+                    AZ_Warning(sampleName, fabsf(basis[l * (l + 1) + m] - expected) < 1.0e-4f,
+                        "SH projection basis (%d, %d) is %f, the sample expects %f", l, m, basis[l * (l + 1) + m], expected);
+                }
+            }
+        }
     }
 
     void SphericalHarmonicsExampleComponent::Reflect(AZ::ReflectContext* context)
@@ -352,6 +370,9 @@ namespace AtomSampleViewer
                     executeFunction));
         }
 
+        SHExampleComponent::ValidateProjectionBasis();
+        m_recomputeFakeLight = true;
+
         AZ::TickBus::Handler::BusConnect();
         AZ::RHI::RHISystemNotificationBus::Handler::BusConnect();
         m_imguiSidebar.Activate();
@@ -402,112 +423,38 @@ namespace AtomSampleViewer
         }
     }
 
-    float SphericalHarmonicsExampleComponent::CalFakeLightSH(bool& flag)
+    void SphericalHarmonicsExampleComponent::ProjectFakeLightSH()
     {
-        static const uint32_t maxSample = 200000;
-
-        // distribute calculation over ticks to avoid blocking rendering pipeline
-        static const uint32_t samplePerTick = 1000;
-        static uint32_t sampleCount = 0;
-
-        // differential of solid angle, the surface area of unit sphere is (4 pi),
-        // and (maxSample) number of samples are drawn uniformly, thus
-        // for each sample its solid angle is (4pi / maxSample)
-        static double dw = (4.0 * AZ::Constants::Pi) / maxSample;
-
-        if (flag)
-        {
-            // reinitialize state
-            sampleCount = 0;
-            m_shaderInputSHFakeLightCoefficients = AZ::Matrix4x4::CreateZero();
-            flag = false;
-        }
-
-        if (sampleCount >= maxSample)
-        {
-            return 0.0;
-        }
+        const auto startTime = AZStd::chrono::steady_clock::now();
 
         // the shape of this light is demonsatrated in preset "fakeLightOriginal" in render mode
         // this function is a copy of fake light function in:
         //      http://silviojemma.com/public/papers/lighting/spherical-harmonic-lighting.pdf, page 15, figure 7
-        auto FakeLight = [](double theta, double phi)->double
+        // with theta and phi replaced by the Y-up direction they map to:
+        //      cos(theta) = y, -sin(theta - pi) * cos(phi - 2.5) = x * cos(2.5) + z * sin(2.5)
+        auto fakeLight = [](const float* x, const float* y, const float* z, float* radiance, size_t count)
         {
-            // increase energy level to form hdr
-            return 5.0 * (fmax(0.0, 5.0 * cos(theta) - 4.0) +
-                fmax(0.0, -4.0 * sin(theta - AZ::Constants::Pi) * cos(phi - 2.5) - 3.0));
+            const float cosOffset = cosf(2.5f);
+            const float sinOffset = sinf(2.5f);
+            for (size_t i = 0; i < count; ++i)
+            {
+                // increase energy level to form hdr
+                radiance[i] = 5.0f * (AZStd::max(0.0f, 5.0f * y[i] - 4.0f) +
+                    AZStd::max(0.0f, 4.0f * (x[i] * cosOffset + z[i] * sinOffset) - 3.0f));
+            }
         };
 
-        // quasi Monte Carlo sampling, without importance
-        for (uint32_t i = 0; i < samplePerTick; ++i)
+        // quasi Monte Carlo integration over a Hammersley set, without importance sampling
+        // this coefficient set will be shared by all three color channels, thus final reconstructed output will be greylevel color
+        const SphericalHarmonicsProjection::Coefficients coefficients =
+            SphericalHarmonicsProjection::ProjectFunction(fakeLight, SHExampleComponent::fakeLightSampleCount);
+
+        for (uint32_t index = 0; index < SphericalHarmonicsProjection::CoefficientCount; ++index)
         {
-            // independent identically distributed(i.i.d) samples drawn from uniform distribution [0, 1]
-            // because importance sampling is not used here so don't need to project to target distribution
-            double u1 = SHExampleComponent::distribution(SHExampleComponent::generator);
-            double u2 = SHExampleComponent::distribution(SHExampleComponent::generator);
-
-            // spherical coordinates (assume unit sphere radius = 1)
-            // zenith angle between up axis (y axis in this case) and sampled direction
-            double theta = acos(1.0 - 2.0 * u1);
-
-            // azimuth angle between +x axis and sampled direction's projection on parallel plane (x-z plane in this case) 
-            double phi = 2.0 * AZ::Constants::Pi * u2;
-
-            // cartesian coordinates of sample on unit sphere
-            // here Y-up -Z-forward axis system is used
-            float dir[3];
-            dir[0] = static_cast<float>(sin(theta) * cos(phi));
-            dir[1] = static_cast<float>(cos(theta));
-            dir[2] = static_cast<float>(sin(theta) * sin(phi));
-
-            // fake radiance computed from analytical light source at given direction
-            double L = FakeLight(theta, phi);
-
-            // evaluate single iteration of integral for all basises from band 0, order 0 to band 3, order 3
-            // this coefficient set will be shared by all three color channels, thus final reconstructed output will be greylevel color
-            // band 0
-            m_shaderInputSHFakeLightCoefficients.SetElement(0, 0, m_shaderInputSHFakeLightCoefficients.GetElement(0, 0) +
-                static_cast<float>(L * AZ::Render::SHBasis::Naive16(0, 0, dir) * dw));
-
-            // band 1
-            m_shaderInputSHFakeLightCoefficients.SetElement(0, 1, m_shaderInputSHFakeLightCoefficients.GetElement(0, 1) +
-                static_cast<float>(L * AZ::Render::SHBasis::Naive16(1, -1, dir) * dw));
-            m_shaderInputSHFakeLightCoefficients.SetElement(0, 2, m_shaderInputSHFakeLightCoefficients.GetElement(0, 2) +
-                static_cast<float>(L * AZ::Render::SHBasis::Naive16(1,  0, dir) * dw));
-            m_shaderInputSHFakeLightCoefficients.SetElement(0, 3, m_shaderInputSHFakeLightCoefficients.GetElement(0, 3) +
-                static_cast<float>(L * AZ::Render::SHBasis::Naive16(1,  1, dir) * dw));
-            
-            // band 2
-            m_shaderInputSHFakeLightCoefficients.SetElement(1, 0, m_shaderInputSHFakeLightCoefficients.GetElement(1, 0) +
-                static_cast<float>(L * AZ::Render::SHBasis::Naive16(2, -2, dir) * dw));
-            m_shaderInputSHFakeLightCoefficients.SetElement(1, 1, m_shaderInputSHFakeLightCoefficients.GetElement(1, 1) +
-                static_cast<float>(L * AZ::Render::SHBasis::Naive16(2, -1, dir) * dw));
-            m_shaderInputSHFakeLightCoefficients.SetElement(1, 2, m_shaderInputSHFakeLightCoefficients.GetElement(1, 2) +
-                static_cast<float>(L * AZ::Render::SHBasis::Naive16(2,  0, dir) * dw));
-            m_shaderInputSHFakeLightCoefficients.SetElement(1, 3, m_shaderInputSHFakeLightCoefficients.GetElement(1, 3) +
-                static_cast<float>(L * AZ::Render::SHBasis::Naive16(2,  1, dir) * dw));
-            m_shaderInputSHFakeLightCoefficients.SetElement(2, 0, m_shaderInputSHFakeLightCoefficients.GetElement(2, 0) +
-                static_cast<float>(L * AZ::Render::SHBasis::Naive16(2,  2, dir) * dw));
-
-            // band 3
-            m_shaderInputSHFakeLightCoefficients.SetElement(2, 1, m_shaderInputSHFakeLightCoefficients.GetElement(2, 1) +
-                static_cast<float>(L * AZ::Render::SHBasis::Naive16(3, -3, dir) * dw));
-            m_shaderInputSHFakeLightCoefficients.SetElement(2, 2, m_shaderInputSHFakeLightCoefficients.GetElement(2, 2) +
-                static_cast<float>(L * AZ::Render::SHBasis::Naive16(3, -2, dir) * dw));
-            m_shaderInputSHFakeLightCoefficients.SetElement(2, 3, m_shaderInputSHFakeLightCoefficients.GetElement(2, 3) +
-                static_cast<float>(L * AZ::Render::SHBasis::Naive16(3, -1, dir) * dw));
-            m_shaderInputSHFakeLightCoefficients.SetElement(3, 0, m_shaderInputSHFakeLightCoefficients.GetElement(3, 0) +
-                static_cast<float>(L * AZ::Render::SHBasis::Naive16(3,  0, dir) * dw));
-            m_shaderInputSHFakeLightCoefficients.SetElement(3, 1, m_shaderInputSHFakeLightCoefficients.GetElement(3, 1) +
-                static_cast<float>(L * AZ::Render::SHBasis::Naive16(3,  1, dir) * dw));
-            m_shaderInputSHFakeLightCoefficients.SetElement(3, 2, m_shaderInputSHFakeLightCoefficients.GetElement(3, 2) +
-                static_cast<float>(L * AZ::Render::SHBasis::Naive16(3,  2, dir) * dw));
-            m_shaderInputSHFakeLightCoefficients.SetElement(3, 3, m_shaderInputSHFakeLightCoefficients.GetElement(3, 3) +
-                static_cast<float>(L * AZ::Render::SHBasis::Naive16(3,  3, dir) * dw));
+            m_shaderInputSHFakeLightCoefficients.SetElement(index / 4, index % 4, coefficients[index]);
         }
 
-        sampleCount += samplePerTick;
-        return sampleCount / float(maxSample);
+        m_fakeLightProjectionMs = AZStd::chrono::duration<float, AZStd::milli>(AZStd::chrono::steady_clock::now() - startTime).count();
     }
 
     void SphericalHarmonicsExampleComponent::DrawIMGui()
@@ -609,41 +556,28 @@ namespace AtomSampleViewer
                 m_updateRenderSRG = true;
             }
 
-            static bool fakeLightDone = false;
-            float progress = CalFakeLightSH(m_recomputeFakeLight);
-            if (progress)
+            if (m_recomputeFakeLight)
             {
-                ImGui::Text("\n\nCalculaitng fake light SH: %.2f percent \n", progress * 100);
-
-                if (m_shaderInputPresetIndex == SHExampleComponent::FakeLight)
-                {
-                    m_updateRenderSRG = true;
-                }
+                ProjectFakeLightSH();
+                m_recomputeFakeLight = false;
+                m_updateRenderSRG = true;
             }
-            else
-            {
-                if (!fakeLightDone)
-                {
-                    m_updateRenderSRG = true;
-                    fakeLightDone = true;
-                }
 
-                ImGui::Text("\n\nFake light SH ready to use, result: ");
-                for (int32_t i = 0; i < 4; ++i)
+            ImGui::Text("\n\nFake light SH projected from %u samples in %.2f ms, result: ",
+                SHExampleComponent::fakeLightSampleCount, m_fakeLightProjectionMs);
+            for (int32_t i = 0; i < 4; ++i)
+            {
+                for (int32_t j = -i; j <= i; ++j)
                 {
-                    for (int32_t j = -i; j <= i; ++j)
-                    {
-                        int32_t index = i * (i + 1) + j;
-                        const float temp = m_shaderInputSHFakeLightCoefficients.GetElement(index / 4, index % 4);
-                        ImGui::Text("  Band %d, Order %d: \n    %f", i, j, temp);
-                    }
+                    int32_t index = i * (i + 1) + j;
+                    const float temp = m_shaderInputSHFakeLightCoefficients.GetElement(index / 4, index % 4);
+                    ImGui::Text("  Band %d, Order %d: \n    %f", i, j, temp);
                 }
+            }
 
-                if (ScriptableImGui::Button("Recompute"))
-                {
-                    fakeLightDone = false;
-                    m_recomputeFakeLight = true;
-                }
+            if (ScriptableImGui::Button("Recompute"))
+            {
+                m_recomputeFakeLight = true;
             }
         }
 
@@ -55,7 +55,9 @@ namespace AtomSampleViewer
         bool ReadInConfig(const AZ::ComponentConfig* baseConfig) override;
 
         void DrawIMGui();
-        float CalFakeLightSH(bool& flag);
+
+        // projects the fake light onto SH with the batched projection utility, across the job system
+        void ProjectFakeLightSH();
 
 
         // ------------------- demo mode variables -------------------
@@ -118,7 +120,8 @@ namespace AtomSampleViewer
         // ----------------------- gui variables -----------------------
         ImGuiSidebar m_imguiSidebar;
         bool m_mode = true;
-        bool m_recomputeFakeLight = false;
+        bool m_recomputeFakeLight = true;
+        float m_fakeLightProjectionMs = 0.0f;
         // -------------------------------------------------------------
 
 
@@ -154,6 +154,25 @@ namespace AtomSampleViewer
         constexpr const char* FileIoProfilerToolName = "File IO Profiler";
         constexpr const char* TransientAttachmentProfilerToolName = "Transient Attachment Profiler";
         constexpr const char* SampleSetting = "/O3DE/AtomSampleViewer/Sample";
+        constexpr const char* ScenePoolingSetting = "/O3DE/AtomSampleViewer/PoolSampleScenes";
+        constexpr const char* NoScenePoolSwitch = "noscenepool";
+        constexpr const char* RHISamplePipelineTemplateName = "RHISamplePipelineTemplate";
+        constexpr const char* RHISceneFeatureProcessorName = "AZ::Render::AuxGeomFeatureProcessor";
+
+        size_t HashPassState(const AZ::RPI::Pass* pass)
+        {
+            size_t hash = 0;
+            AZStd::hash_combine(hash, pass->GetPathName().GetHash());
+            AZStd::hash_combine(hash, pass->IsEnabled());
+            if (const AZ::RPI::ParentPass* parentPass = pass->AsParent())
+            {
+                for (const auto& child : parentPass->GetChildren())
+                {
+                    AZStd::hash_combine(hash, HashPassState(child.get()));
+                }
+            }
+            return hash;
+        }
     }
 
     bool IsValidNumMSAASamples(int16_t numSamples)
@@ -539,6 +558,16 @@ namespace AtomSampleViewer
         m_imguiFrameCaptureSaver.SetAvailableExtensions({ "png", "ppm", "dds" });
         m_imguiFrameCaptureSaver.Activate();
 
+        m_sampleAssetPrefetcher.Activate();
+
+        // Off unless the setting turns it on
+        m_isScenePoolingEnabled = false;
+        settingsRegistry->Get(m_isScenePoolingEnabled, ScenePoolingSetting);
+        if (commandLine->HasSwitch(NoScenePoolSwitch))
+        {
+            m_isScenePoolingEnabled = false;
+        }
+
         SampleComponentManagerRequestBus::Handler::BusConnect();
         m_scriptManager->Activate();
 
@@ -554,6 +583,7 @@ namespace AtomSampleViewer
         AzFramework::AssetCatalogEventBus::Handler::BusDisconnect();
         AZ::Render::ImGuiSystemNotificationBus::Handler::BusDisconnect();
         m_scriptManager->Deactivate();
+        m_sampleAssetPrefetcher.Deactivate();
         m_imguiFrameCaptureSaver.Deactivate();
         SampleComponentSingletonRequestBus::Handler::BusDisconnect();
         SampleComponentManagerRequestBus::Handler::BusDisconnect();
@@ -568,8 +598,9 @@ namespace AtomSampleViewer
         m_windowContext = nullptr;
         m_brdfTexture.reset();
 
-        ReleaseRHIScene();
-        ReleaseRPIScene();
+        ReleaseRHIScene(false);
+        ReleaseRPIScene(false);
+        m_scenePool.clear();
     }
 
     void SampleComponentManager::OnTick(float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
@@ -1285,11 +1316,11 @@ namespace AtomSampleViewer
         return m_isFrameCapturePending;
     }
 
-    void SampleComponentManager::RunMainTestSuite(const AZStd::string& suiteFilePath, bool exitOnTestEnd, int randomSeed)
+    void SampleComponentManager::RunMainTestSuite(const AZStd::string& suiteFilePath, bool exitOnTestEnd, int randomSeed, int shardIndex, int shardCount)
     {
         if (m_scriptManager)
         {
-            m_scriptManager->RunMainTestSuite(suiteFilePath, exitOnTestEnd, randomSeed);
+            m_scriptManager->RunMainTestSuite(suiteFilePath, exitOnTestEnd, randomSeed, shardIndex, shardCount);
         }
     }
 
@@ -1433,6 +1464,9 @@ namespace AtomSampleViewer
         }
         m_activeSamples.clear();
 
+        // A sample closed while its preloaded assets were still loading never reports that they finished
+        ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::SetPendingSampleAssetCount, 0u);
+
         // Force a reset of the shader variant finder to get more consistent testing of samples every time they are run, rather
         // than the first time for each sample being "special".
         auto variantFinder = AZ::Interface<AZ::RPI::IShaderVariantFinder>::Get();
@@ -1513,6 +1547,28 @@ namespace AtomSampleViewer
         return false;
     }
 
+    bool SampleComponentManager::PrefetchSample(const AZStd::string& sampleName)
+    {
+        return m_sampleAssetPrefetcher.Prefetch(sampleName);
+    }
+
+    void SampleComponentManager::RecordSamplePreloadAssets(const AZStd::vector<AZ::AssetCollectionAsyncLoader::AssetToLoadInfo>& assetList)
+    {
+        if (m_selectedSampleIndex >= 0 && static_cast<size_t>(m_selectedSampleIndex) < m_availableSamples.size())
+        {
+            const AZStd::string& sampleName = m_availableSamples[m_selectedSampleIndex].m_fullName;
+            m_sampleAssetPrefetcher.RecordSampleAssets(sampleName, assetList);
+
+            AZStd::vector<AZStd::string> assetPaths;
+            assetPaths.reserve(assetList.size());
+            for (const AZ::AssetCollectionAsyncLoader::AssetToLoadInfo& assetInfo : assetList)
+            {
+                assetPaths.push_back(assetInfo.m_assetPath);
+            }
+            m_scriptManager->RecordSampleAssets(sampleName, assetPaths);
+        }
+    }
+
     bool SampleComponentManager::ShowTool(const AZStd::string& toolName, bool enable)
     {
         if (toolName == PassTreeToolName)
@@ -1597,6 +1653,8 @@ namespace AtomSampleViewer
         
         m_exampleEntity->Activate();
 
+        m_sampleAssetPrefetcher.OnSampleActivated(sampleEntry.m_fullName);
+
         // Even though this is done in CameraReset(), the example component wasn't activated at the time so we have to send this event again.
         ExampleComponentRequestBus::Event(m_exampleEntity->GetId(), &ExampleComponentRequestBus::Events::ResetCamera);
     }
@@ -1613,12 +1671,183 @@ namespace AtomSampleViewer
         ExampleComponentRequestBus::Event(m_exampleEntity->GetId(), &ExampleComponentRequestBus::Events::ResetCamera);
     }
 
+    bool SampleComponentManager::ScenePoolKey::operator==(const ScenePoolKey& other) const
+    {
+        return m_pipelineType == other.m_pipelineType
+            && m_rootPassTemplate == other.m_rootPassTemplate
+            && m_materialPipelineName == other.m_materialPipelineName
+            && m_numMsaaSamples == other.m_numMsaaSamples;
+    }
+
+    SampleComponentManager::ScenePoolKey SampleComponentManager::GetScenePoolKey(SamplePipelineType pipelineType)
+    {
+        ScenePoolKey key;
+        key.m_pipelineType = pipelineType;
+        if (pipelineType == SamplePipelineType::RHI)
+        {
+            key.m_rootPassTemplate = RHISamplePipelineTemplateName;
+        }
+        else
+        {
+            key.m_rootPassTemplate = GetRootPassTemplateName();
+            key.m_materialPipelineName = GetMaterialPipelineName();
+            key.m_numMsaaSamples = m_numMsaaSamples;
+        }
+        return key;
+    }
+
+    size_t SampleComponentManager::HashActiveScenePasses() const
+    {
+        size_t hash = 0;
+        if (m_renderPipeline)
+        {
+            AZStd::hash_combine(hash, HashPassState(m_renderPipeline->GetRootPass().get()));
+        }
+        for (const AZ::RPI::RenderPipelinePtr& xrPipeline : m_xrPipelines)
+        {
+            AZStd::hash_combine(hash, HashPassState(xrPipeline->GetRootPass().get()));
+        }
+        return hash;
+    }
+
+    void SampleComponentManager::OnActiveSceneCreated(const ScenePoolKey& key)
+    {
+        m_activeSceneKey = key;
+        if (m_isScenePoolingEnabled)
+        {
+            // Pass trees are normally built on the next frame; build them now to record their clean state
+            RPI::PassSystemInterface::Get()->ProcessQueuedChanges();
+            m_activeScenePassStateHash = HashActiveScenePasses();
+        }
+    }
+
+    bool SampleComponentManager::ParkActiveScene(const AZ::RPI::ScenePtr& scene)
+    {
+        if (!m_isScenePoolingEnabled)
+        {
+            return false;
+        }
+
+        // The scene has to hold exactly the pipelines created for it. Samples that add their own pipelines should remove them
+        // when deactivated, and the BRDF pipeline removes itself after running once.
+        const AZ::Name brdfPipelineName("BRDFTexturePipeline");
+        size_t ownPipelineCount = 0;
+        for (const AZ::RPI::RenderPipelinePtr& pipeline : scene->GetRenderPipelines())
+        {
+            const bool isOwnPipeline = pipeline == m_renderPipeline || AZStd::find(m_xrPipelines.begin(), m_xrPipelines.end(), pipeline) != m_xrPipelines.end();
+            if (isOwnPipeline)
+            {
+                ++ownPipelineCount;
+            }
+            else if (pipeline->GetId() != brdfPipelineName)
+            {
+                AZ_TracePrintf("SampleComponentManager", "Not pooling scene '%s', the sample left pipeline '%s' in it\n", scene->GetName().GetCStr(), pipeline->GetId().GetCStr());
+                return false;
+            }
+        }
+        if (ownPipelineCount != (m_renderPipeline ? 1 : 0) + m_xrPipelines.size())
+        {
+            AZ_TracePrintf("SampleComponentManager", "Not pooling scene '%s', the sample removed one of its pipelines\n", scene->GetName().GetCStr());
+            return false;
+        }
+
+        // Passes the sample added, removed, enabled or disabled would carry over to the next sample
+        if (HashActiveScenePasses() != m_activeScenePassStateHash)
+        {
+            AZ_TracePrintf("SampleComponentManager", "Not pooling scene '%s', the sample changed its passes\n", scene->GetName().GetCStr());
+            return false;
+        }
+
+        // One scene per configuration; a parked scene with the same one is stale
+        AZStd::erase_if(m_scenePool, [this](const PooledScene& pooledScene) { return pooledScene.m_key == m_activeSceneKey; });
+        if (m_scenePool.size() >= MaxPooledScenes)
+        {
+            m_scenePool.erase(m_scenePool.begin());
+        }
+
+        PooledScene& pooledScene = m_scenePool.emplace_back();
+        pooledScene.m_key = m_activeSceneKey;
+        pooledScene.m_scene = scene;
+        pooledScene.m_renderPipeline = m_renderPipeline;
+        pooledScene.m_xrPipelines = m_xrPipelines;
+        pooledScene.m_rhiSamplePasses = m_rhiSamplePasses;
+        pooledScene.m_passStateHash = m_activeScenePassStateHash;
+        return true;
+    }
+
+    AZ::RPI::ScenePtr SampleComponentManager::TakePooledScene(const ScenePoolKey& key)
+    {
+        if (!m_isScenePoolingEnabled)
+        {
+            return nullptr;
+        }
+
+        auto pooledSceneIter = AZStd::find_if(m_scenePool.begin(), m_scenePool.end(), [&key](const PooledScene& pooledScene) { return pooledScene.m_key == key; });
+        if (pooledSceneIter == m_scenePool.end())
+        {
+            return nullptr;
+        }
+
+        AZ::RPI::ScenePtr scene = AZStd::move(pooledSceneIter->m_scene);
+        m_renderPipeline = AZStd::move(pooledSceneIter->m_renderPipeline);
+        m_xrPipelines = AZStd::move(pooledSceneIter->m_xrPipelines);
+        m_rhiSamplePasses = AZStd::move(pooledSceneIter->m_rhiSamplePasses);
+        m_activeScenePassStateHash = pooledSceneIter->m_passStateHash;
+        m_activeSceneKey = key;
+        m_scenePool.erase(pooledSceneIter);
+
+        // Undo what the previous sample may have changed on the pipelines themselves
+        auto* xrSystem = AZ::RHI::RHISystemInterface::Get()->GetXRSystem();
+        if (m_renderPipeline)
+        {
+            m_renderPipeline->SetDefaultViewFromEntity(m_cameraEntity->GetId());
+            EnableRenderPipeline(!xrSystem || xrSystem->IsDefaultRenderPipelineEnabledOnHost());
+        }
+        if (!m_xrPipelines.empty())
+        {
+            if (key.m_pipelineType == SamplePipelineType::RHI)
+            {
+                m_xrPipelines[0]->SetDefaultViewFromEntity(m_cameraEntity->GetId());
+                m_xrPipelines[1]->SetDefaultViewFromEntity(m_cameraEntity->GetId());
+            }
+            else
+            {
+                m_xrPipelines[0]->SetDefaultStereoscopicViewFromEntity(m_cameraEntity->GetId(), RPI::ViewType::XrLeft);
+                m_xrPipelines[1]->SetDefaultStereoscopicViewFromEntity(m_cameraEntity->GetId(), RPI::ViewType::XrRight);
+            }
+            EnableXrPipelines(false);
+        }
+
+        return scene;
+    }
+
+    void SampleComponentManager::SetScenePoolingEnabled(bool enabled)
+    {
+        m_isScenePoolingEnabled = enabled;
+        if (!enabled)
+        {
+            m_scenePool.clear();
+        }
+    }
+
     void SampleComponentManager::CreateSceneForRHISample()
     {
+        const ScenePoolKey sceneKey = GetScenePoolKey(SamplePipelineType::RHI);
+        m_rhiScene = TakePooledScene(sceneKey);
+        if (m_rhiScene)
+        {
+            // Recreate the feature processors so nothing the previous sample added to them carries over
+            m_rhiScene->DisableAllFeatureProcessors();
+            m_rhiScene->EnableFeatureProcessor(RPI::FeatureProcessorId(RHISceneFeatureProcessorName));
+            RPI::RPISystemInterface::Get()->RegisterScene(m_rhiScene);
+            SetupImGuiContext();
+            return;
+        }
+
         // Create and register the rhi scene with only feature processors required for AtomShimRenderer (only for AtomSampleViewerLauncher)
         RPI::SceneDescriptor sceneDesc;
         sceneDesc.m_nameId = AZ::Name("RHI");
-        sceneDesc.m_featureProcessorNames.push_back("AZ::Render::AuxGeomFeatureProcessor");
+        sceneDesc.m_featureProcessorNames.push_back(RHISceneFeatureProcessorName);
         m_rhiScene = RPI::Scene::CreateScene(sceneDesc);
         m_rhiScene->Activate();
 
@@ -1629,7 +1858,7 @@ namespace AtomSampleViewer
         {
             RPI::RenderPipelineDescriptor pipelineDesc;
             pipelineDesc.m_name = "RHISamplePipeline";
-            pipelineDesc.m_rootPassTemplate = "RHISamplePipelineTemplate";
+            pipelineDesc.m_rootPassTemplate = RHISamplePipelineTemplateName;
             // Add view to pipeline since there are few RHI samples are using ViewSrg
             pipelineDesc.m_mainViewTagName = "MainCamera";
 
@@ -1692,12 +1921,19 @@ namespace AtomSampleViewer
         RPI::RPISystemInterface::Get()->RegisterScene(m_rhiScene);  
         // Setup imGui since a new render pipeline with imgui pass was created
         SetupImGuiContext();
+
+        OnActiveSceneCreated(sceneKey);
     }
 
-    void SampleComponentManager::ReleaseRHIScene()
+    void SampleComponentManager::ReleaseRHIScene(bool allowPooling)
     {
         if (m_rhiScene)
         {
+            if (allowPooling)
+            {
+                ParkActiveScene(m_rhiScene);
+            }
+
             m_rhiSamplePasses.clear();
             m_xrPipelines.clear();
             m_renderPipeline = nullptr;
@@ -1721,11 +1957,24 @@ namespace AtomSampleViewer
         const char* supervariantName = isNonMsaaPipeline ? AZ::RPI::NoMsaaSupervariantName : "";
         AZ::RPI::ShaderSystemInterface::Get()->SetSupervariantName(AZ::Name(supervariantName));
 
-        // Create and register a scene with all available feature processors
-        RPI::SceneDescriptor sceneDesc;
-        sceneDesc.m_nameId = AZ::Name("RPI");
-        m_rpiScene = RPI::Scene::CreateScene(sceneDesc);
-        m_rpiScene->EnableAllFeatureProcessors();
+        const ScenePoolKey sceneKey = GetScenePoolKey(SamplePipelineType::RPI);
+        m_rpiScene = TakePooledScene(sceneKey);
+        const bool isPooledScene = m_rpiScene != nullptr;
+        if (isPooledScene)
+        {
+            // Recreate the feature processors so nothing the previous sample added or set on them, like meshes, lights,
+            // decals or post-process settings, carries over. This also brings back the ones the previous sample disabled.
+            m_rpiScene->DisableAllFeatureProcessors();
+            m_rpiScene->EnableAllFeatureProcessors();
+        }
+        else
+        {
+            // Create and register a scene with all available feature processors
+            RPI::SceneDescriptor sceneDesc;
+            sceneDesc.m_nameId = AZ::Name("RPI");
+            m_rpiScene = RPI::Scene::CreateScene(sceneDesc);
+            m_rpiScene->EnableAllFeatureProcessors();
+        }
 
         // Bind m_rpiScene to the GameEntityContext's AzFramework::Scene so the RPI Scene can be found by the entity context
         auto sceneSystem = AzFramework::SceneSystemInterface::Get();
@@ -1736,6 +1985,13 @@ namespace AtomSampleViewer
         [[maybe_unused]] bool result = mainScene->SetSubsystem(m_rpiScene);
         AZ_Assert(result, "SampleComponentManager failed to register the RPI scene with the general scene.");
 
+        if (isPooledScene)
+        {
+            RPI::RPISystemInterface::Get()->RegisterScene(m_rpiScene);
+            SetupImGuiContext();
+            return;
+        }
+
         m_rpiScene->Activate();
 
         // Register scene to RPI system so it will be processed/rendered per tick
@@ -1826,12 +2082,19 @@ namespace AtomSampleViewer
 
         // Setup imGui since a new render pipeline with imgui pass was created
         SetupImGuiContext();
+
+        OnActiveSceneCreated(sceneKey);
     }
 
-    void SampleComponentManager::ReleaseRPIScene()
+    void SampleComponentManager::ReleaseRPIScene(bool allowPooling)
     {
         if (m_rpiScene)
         {
+            if (allowPooling)
+            {
+                ParkActiveScene(m_rpiScene);
+            }
+
             m_xrPipelines.clear();
             m_renderPipeline = nullptr;
 
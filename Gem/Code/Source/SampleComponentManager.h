@@ -42,6 +42,7 @@
 #include <Utils/ImGuiSaveFilePath.h>
 #include <Utils/ImGuiHistogramQueue.h>
 #include <Utils/ImGuiMessageBox.h>
+#include <Utils/SampleAssetPrefetcher.h>
 
 namespace AZ
 {
@@ -94,14 +95,54 @@ namespace AtomSampleViewer
 
         // For RHI samples
         void CreateSceneForRHISample();
-        void ReleaseRHIScene();
+        void ReleaseRHIScene(bool allowPooling = true);
         void SwitchSceneForRHISample();
 
         // For RPI samples
         void CreateSceneForRPISample();
-        void ReleaseRPIScene();
+        void ReleaseRPIScene(bool allowPooling = true);
         void SwitchSceneForRPISample();
 
+        // Scenes and their render pipelines are expensive to build, and consecutive samples mostly ask for the same one.
+        // A released scene is parked in m_scenePool instead of destroyed, unless the sample left it changed, and the next
+        // sample that needs the same configuration gets it back.
+        struct ScenePoolKey
+        {
+            SamplePipelineType m_pipelineType = SamplePipelineType::RHI;
+            AZStd::string m_rootPassTemplate;
+            AZStd::string m_materialPipelineName;
+            int16_t m_numMsaaSamples = 1;
+
+            bool operator==(const ScenePoolKey& other) const;
+        };
+
+        struct PooledScene
+        {
+            ScenePoolKey m_key;
+            AZ::RPI::ScenePtr m_scene;
+            AZ::RPI::RenderPipelinePtr m_renderPipeline;
+            AZStd::vector<AZ::RPI::RenderPipelinePtr> m_xrPipelines;
+            AZStd::vector<AZ::RPI::Ptr<RHISamplePass>> m_rhiSamplePasses;
+            size_t m_passStateHash = 0;
+        };
+
+        static constexpr size_t MaxPooledScenes = 2;
+
+        ScenePoolKey GetScenePoolKey(SamplePipelineType pipelineType);
+
+        //! Hashes the pass tree of the active scene's pipelines, including which passes are enabled
+        size_t HashActiveScenePasses() const;
+
+        //! Records the state of a newly created scene, to check it is unchanged when it is released
+        void OnActiveSceneCreated(const ScenePoolKey& key);
+
+        //! Moves the active scene and its pipelines into m_scenePool. Returns false if pooling is disabled or the sample
+        //! changed the scene in a way that can't be undone, in which case it should be destroyed.
+        bool ParkActiveScene(const AZ::RPI::ScenePtr& scene);
+
+        //! Takes a scene with the given configuration out of m_scenePool and makes its pipelines active
+        AZ::RPI::ScenePtr TakePooledScene(const ScenePoolKey& key);
+
         void RenderImGui(float deltaTime);
 
         void ShowMenuBar();
@@ -129,7 +170,7 @@ namespace AtomSampleViewer
         bool ShowTool(const AZStd::string& toolName, bool enable) override;
         void RequestFrameCapture(const AZStd::string& filePath, bool hideImGui) override;
         bool IsFrameCapturePending() override;
-        void RunMainTestSuite(const AZStd::string& suiteFilePath, bool exitOnTestEnd, int randomSeed) override;
+        void RunMainTestSuite(const AZStd::string& suiteFilePath, bool exitOnTestEnd, int randomSeed, int shardIndex, int shardCount) override;
         void SetNumMSAASamples(int16_t numMsaaSamples) override;
         int16_t GetNumMSAASamples() override;
         void SetDefaultNumMSAASamples(int16_t defaultNumMsaaSamples) override;
@@ -145,6 +186,9 @@ namespace AtomSampleViewer
         void ClearRPIScene() override;
         void EnableRenderPipeline(bool value) override;
         void EnableXrPipelines(bool value) override;
+        bool PrefetchSample(const AZStd::string& sampleName) override;
+        void RecordSamplePreloadAssets(const AZStd::vector<AZ::AssetCollectionAsyncLoader::AssetToLoadInfo>& assetList) override;
+        void SetScenePoolingEnabled(bool enabled) override;
 
         // FrameCaptureNotificationBus overrides...
         void OnFrameCaptureFinished(AZ::Render::FrameCaptureResult result, const AZStd::string& info) override;
@@ -237,6 +281,7 @@ namespace AtomSampleViewer
         AZStd::string m_frameCaptureFilePath;
 
         AZStd::unique_ptr<ScriptManager> m_scriptManager;
+        SampleAssetPrefetcher m_sampleAssetPrefetcher;
         AZStd::unique_ptr<ScriptableImGui> m_scriptableImGui;
 
         AZStd::shared_ptr<AZ::RPI::WindowContext> m_windowContext;
@@ -258,5 +303,11 @@ namespace AtomSampleViewer
         // Cache PC and XR pipelines
         AZ::RPI::RenderPipelinePtr m_renderPipeline = nullptr;
         AZStd::vector<AZ::RPI::RenderPipelinePtr> m_xrPipelines;
+
+        // Released scenes kept for reuse, see ParkActiveScene()
+        AZStd::vector<PooledScene> m_scenePool;
+        bool m_isScenePoolingEnabled = false;
+        ScenePoolKey m_activeSceneKey;
+        size_t m_activeScenePassStateHash = 0;
     };
 } // namespace AtomSampleViewer
@@ -7,6 +7,7 @@
  */
 #pragma once
 
+#include <Atom/Utils/AssetCollectionAsyncLoader.h>
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/std/string/string.h>
 
@@ -92,7 +93,9 @@ namespace AtomSampleViewer
         //! @param suiteFilePath path to the compiled luac test script
         //! @param exitOnTestEnd if true, exits AtomSampleViewerStandalone when the script finishes, used in jenkins
         //! @param randomSeed the seed for the random generator, frequently used inside lua tests to shuffle the order of the test execution
-        virtual void RunMainTestSuite(const AZStd::string& suiteFilePath, bool exitOnTestEnd, int randomSeed) = 0;
+        //! @param shardIndex which part of the suite this process runs, in [0, shardCount)
+        //! @param shardCount the number of processes the suite is split across, 1 to run the whole suite
+        virtual void RunMainTestSuite(const AZStd::string& suiteFilePath, bool exitOnTestEnd, int randomSeed, int shardIndex, int shardCount) = 0;
 
         //! Set the number of MSAA samples
         //! @param numMSAASamples the number of MSAA samples
@@ -121,6 +124,18 @@ namespace AtomSampleViewer
 
         //! Enables or disables the XR pipelines.
         virtual void EnableXrPipelines(bool value) = 0;
+
+        //! Starts loading, in the background, the assets the given sample preloaded the last time it ran, so opening it
+        //! later doesn't wait on cold loads. Does nothing when prefetching is turned off, see SampleAssetPrefetcher.
+        //! @return true if the sample's assets are being prefetched
+        virtual bool PrefetchSample(const AZStd::string& sampleName) = 0;
+
+        //! Records the assets the active sample preloads, so it can be prefetched next time
+        virtual void RecordSamplePreloadAssets(const AZStd::vector<AZ::AssetCollectionAsyncLoader::AssetToLoadInfo>& assetList) = 0;
+
+        //! Turns reuse of scenes and render pipelines between samples on or off. Turning it off releases the pooled scenes,
+        //! so the next sample gets a newly built scene, for comparing against the pooled path.
+        virtual void SetScenePoolingEnabled(bool enabled) = 0;
     };
     using SampleComponentManagerRequestBus = AZ::EBus<SampleComponentManagerRequests>;
 
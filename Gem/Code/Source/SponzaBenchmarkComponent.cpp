@@ -85,7 +85,7 @@ namespace AtomSampleViewer
         if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
         {
             serializeContext->Class<SponzaBenchmarkComponent::RunBenchmarkData>()
-                ->Version(0)
+                ->Version(1)
                 ->Field("Name", &SponzaBenchmarkComponent::RunBenchmarkData::m_name)
                 ->Field("FrameCount", &SponzaBenchmarkComponent::RunBenchmarkData::m_frameCount)
                 ->Field("TimeToFirstFrame", &SponzaBenchmarkComponent::RunBenchmarkData::m_timeToFirstFrame)
@@ -93,8 +93,12 @@ namespace AtomSampleViewer
                 ->Field("AverageFrameTime", &SponzaBenchmarkComponent::RunBenchmarkData::m_averageFrameTime)
                 ->Field("50% of FrameTimes Under", &SponzaBenchmarkComponent::RunBenchmarkData::m_50pFramesUnder)
                 ->Field("90% of FrameTimes Under", &SponzaBenchmarkComponent::RunBenchmarkData::m_90pFramesUnder)
+                ->Field("99% of FrameTimes Under", &SponzaBenchmarkComponent::RunBenchmarkData::m_99pFramesUnder)
+                ->Field("99.9% of FrameTimes Under", &SponzaBenchmarkComponent::RunBenchmarkData::m_999pFramesUnder)
                 ->Field("MinFrameTime", &SponzaBenchmarkComponent::RunBenchmarkData::m_minFrameTime)
                 ->Field("MaxFrameTime", &SponzaBenchmarkComponent::RunBenchmarkData::m_maxFrameTime)
+                ->Field("FrameTimeStandardDeviation", &SponzaBenchmarkComponent::RunBenchmarkData::m_frameTimeStandardDeviation)
+                ->Field("FrameTimeSpikeCount", &SponzaBenchmarkComponent::RunBenchmarkData::m_frameTimeSpikeCount)
                 ->Field("AverageFrameRate", &SponzaBenchmarkComponent::RunBenchmarkData::m_averageFrameRate)
                 ->Field("MinFrameRate", &SponzaBenchmarkComponent::RunBenchmarkData::m_minFrameRate)
                 ->Field("MaxFrameRate", &SponzaBenchmarkComponent::RunBenchmarkData::m_maxFrameRate)
@@ -402,7 +406,11 @@ namespace AtomSampleViewer
     {
         const float dtInMS = deltaTime * 1000.0f;
 
-        m_currentRunBenchmarkData.m_frameTimes.push_back(dtInMS);
+        m_currentRunBenchmarkData.m_frameTimeStatistics.PushValue(dtInMS);
+        if (dtInMS > 0.0f)
+        {
+            m_currentRunBenchmarkData.m_frameRateSum += 1000.0 / dtInMS;
+        }
         m_currentRunBenchmarkData.m_frameCount++;
         m_currentRunBenchmarkData.m_timeInSeconds = timePoint.GetSeconds() - m_benchmarkStartTimePoint;
         if (dtInMS < m_currentRunBenchmarkData.m_minFrameTime)
@@ -421,54 +429,33 @@ namespace AtomSampleViewer
 
     void SponzaBenchmarkComponent::FinalizeRunBenchmarkData()
     {
-        m_currentRunBenchmarkData.m_averageFrameTime =
-            (m_currentRunBenchmarkData.m_timeInSeconds / m_currentRunBenchmarkData.m_frameCount) * 1000.0f;
-
-        // Need to sort the frame times so we can find the 50th and 90th percentile
-        AZStd::vector<float> sortedFrameTimes = m_currentRunBenchmarkData.m_frameTimes;
-        AZStd::sort(sortedFrameTimes.begin(), sortedFrameTimes.end());
-
-        const size_t frameTimeCount = m_currentRunBenchmarkData.m_frameTimes.size();
-
-        const bool evenNumberOfFrames = frameTimeCount & 1;
-        if (!evenNumberOfFrames)
-        {
-            const size_t medianIndex = frameTimeCount / 2;
-
-            m_currentRunBenchmarkData.m_50pFramesUnder = sortedFrameTimes[medianIndex];
-        }
-        else
+        RunBenchmarkData& data = m_currentRunBenchmarkData;
+        const StreamingStatistics& frameTimes = data.m_frameTimeStatistics;
+
+        data.m_averageFrameTime = (data.m_timeInSeconds / data.m_frameCount) * 1000.0f;
+
+        // The percentiles come from the streaming histogram, so they are within its relative precision of the exact values
+        data.m_50pFramesUnder = frameTimes.GetQuantile(0.5);
+        data.m_90pFramesUnder = frameTimes.GetQuantile(0.9);
+        data.m_99pFramesUnder = frameTimes.GetQuantile(0.99);
+        data.m_999pFramesUnder = frameTimes.GetQuantile(0.999);
+        data.m_frameTimeStandardDeviation = frameTimes.GetStandardDeviation();
+        data.m_frameTimeSpikeCount = frameTimes.GetSpikeCount();
+        data.m_timeToFirstFrame = m_timeToFirstFrame;
+
+        // Individual frames aren't kept, so the results plot the frame time at each percentile instead
+        data.m_frameTimePercentiles.resize(RunBenchmarkData::FrameTimePercentileCount);
+        for (int i = 0; i < RunBenchmarkData::FrameTimePercentileCount; ++i)
         {
-            const size_t medianIndex1 = frameTimeCount / 2;
-            const size_t medianIndex2 = medianIndex1 + 1;
-
-            const float median = (sortedFrameTimes[medianIndex1] + sortedFrameTimes[medianIndex2]) / 2.0f;
-
-            m_currentRunBenchmarkData.m_50pFramesUnder = median;
+            data.m_frameTimePercentiles[i] = frameTimes.GetQuantile(static_cast<double>(i + 1) / RunBenchmarkData::FrameTimePercentileCount);
         }
 
-        const float p90Indexf = ceilf(static_cast<float>(frameTimeCount) * .9f);
-        const size_t p90Index = static_cast<size_t>(p90Indexf);
-
-        m_currentRunBenchmarkData.m_90pFramesUnder = sortedFrameTimes[p90Index];
-        m_currentRunBenchmarkData.m_timeToFirstFrame = m_timeToFirstFrame;
-
-        float averageFrameRate = 0.0f;
-        for (auto frame : m_currentRunBenchmarkData.m_frameTimes)
+        if (frameTimes.GetCount() > 0)
         {
-            float frameRate = 1.0f / (frame / 1000);
-            if (frameRate > m_currentRunBenchmarkData.m_maxFrameRate)
-            {
-                m_currentRunBenchmarkData.m_maxFrameRate = frameRate;
-            }
-            if (frameRate < m_currentRunBenchmarkData.m_minFrameRate)
-            {
-                m_currentRunBenchmarkData.m_minFrameRate = frameRate;
-            }
-            m_currentRunBenchmarkData.m_frameRates.push_back(frameRate);
-            averageFrameRate += frameRate;
+            data.m_maxFrameRate = 1000.0f / frameTimes.GetMinimum();
+            data.m_minFrameRate = 1000.0f / frameTimes.GetMaximum();
+            data.m_averageFrameRate = static_cast<float>(data.m_frameRateSum / frameTimes.GetCount());
         }
-        m_currentRunBenchmarkData.m_averageFrameRate = averageFrameRate / m_currentRunBenchmarkData.m_frameRates.size();
     }
 
     void SponzaBenchmarkComponent::BenchmarkRunEnd()
@@ -567,12 +554,13 @@ namespace AtomSampleViewer
 
         if (ImGui::Begin("Frame Times"))
         {
+            const AZStd::vector<float>& frameTimePercentiles = m_currentRunBenchmarkData.m_frameTimePercentiles;
             ImGui::PlotHistogram("##FrameTimes",
-                m_currentRunBenchmarkData.m_frameTimes.data(),
-                static_cast<int32_t>(m_currentRunBenchmarkData.m_frameTimes.size()),
-                0, nullptr,
+                frameTimePercentiles.data(),
+                static_cast<int>(frameTimePercentiles.size()),
+                0, "Frame time by percentile",
                 0,
-                m_currentRunBenchmarkData.m_90pFramesUnder * 2.0f,
+                m_currentRunBenchmarkData.m_99pFramesUnder * 1.5f,
                 ImGui::GetContentRegionAvail());
         }
         ImGui::End();
@@ -616,8 +604,12 @@ namespace AtomSampleViewer
             ImGui::Text("Average Frame Time: %f ms", m_currentRunBenchmarkData.m_averageFrameTime);
             ImGui::Text("50%% Frames Under: %f ms", m_currentRunBenchmarkData.m_50pFramesUnder);
             ImGui::Text("90%% Frames Under: %f ms", m_currentRunBenchmarkData.m_90pFramesUnder);
+            ImGui::Text("99%% Frames Under: %f ms", m_currentRunBenchmarkData.m_99pFramesUnder);
+            ImGui::Text("99.9%% Frames Under: %f ms", m_currentRunBenchmarkData.m_999pFramesUnder);
             ImGui::Text("Min Frame Time: %f ms", m_currentRunBenchmarkData.m_minFrameTime);
             ImGui::Text("Max Frame Time: %f ms", m_currentRunBenchmarkData.m_maxFrameTime);
+            ImGui::Text("Frame Time Std Dev: %f ms", m_currentRunBenchmarkData.m_frameTimeStandardDeviation);
+            ImGui::Text("Frame Time Spikes: %llu", m_currentRunBenchmarkData.m_frameTimeSpikeCount);
             ImGui::Text("Average Frame Rate: %f Hz", m_currentRunBenchmarkData.m_averageFrameRate);
             ImGui::Text("Min Frame Rate: %f Hz", m_currentRunBenchmarkData.m_minFrameRate);
             ImGui::Text("Max Frame Rate: %f Hz", m_currentRunBenchmarkData.m_maxFrameRate);
@@ -20,6 +20,7 @@
 #include <Atom/Feature/CoreLights/DirectionalLightFeatureProcessorInterface.h>
 #include <Atom/Feature/SkyBox/SkyBoxFeatureProcessorInterface.h>
 
+#include <Utils/StreamingStatistics.h>
 #include <Utils/Utils.h>
 
 struct ImGuiContext;
@@ -94,17 +95,24 @@ namespace AtomSampleViewer
 
             static void Reflect(AZ::ReflectContext* context);
 
+            static constexpr int FrameTimePercentileCount = 1000;
+
             AZStd::string m_name;
-            AZStd::vector<float> m_frameTimes; // not serialized
-            AZStd::vector<float> m_frameRates; // not serialized
-            AZ::u64 m_frameCount;
+            StreamingStatistics m_frameTimeStatistics; // not serialized, frame times in milliseconds
+            AZStd::vector<float> m_frameTimePercentiles; // not serialized, frame time at each of FrameTimePercentileCount percentiles, for the results plot
+            double m_frameRateSum = 0.0; // not serialized
+            AZ::u64 m_frameCount = 0;
             double m_timeInSeconds = 0.0;
             double m_timeToFirstFrame = 0.0;
             double m_averageFrameTime = 0.0;
             float m_50pFramesUnder = 0.0f;
             float m_90pFramesUnder = 0.0f;
+            float m_99pFramesUnder = 0.0f;
+            float m_999pFramesUnder = 0.0f;
             float m_minFrameTime = FLT_MAX;
             float m_maxFrameTime = FLT_MIN;
+            double m_frameTimeStandardDeviation = 0.0;
+            AZ::u64 m_frameTimeSpikeCount = 0;
 
             float m_averageFrameRate = 0.0;
             float m_minFrameRate = FLT_MAX;
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Utils/FrameTimeStabilityWindow.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/math.h>
+
+namespace AtomSampleViewer
+{
+    void FrameTimeStabilityWindow::Reset(size_t windowSize, float tolerance)
+    {
+        m_windowSize = AZStd::max<size_t>(windowSize, 1);
+        m_tolerance = AZStd::max(tolerance, 0.0f);
+        m_nextIndex = 0;
+        m_frameTimes.clear();
+        m_frameTimes.reserve(m_windowSize);
+    }
+
+    void FrameTimeStabilityWindow::PushFrameTime(float frameTime)
+    {
+        if (m_windowSize == 0)
+        {
+            return;
+        }
+
+        if (m_frameTimes.size() < m_windowSize)
+        {
+            m_frameTimes.push_back(frameTime);
+        }
+        else
+        {
+            m_frameTimes[m_nextIndex] = frameTime;
+        }
+        m_nextIndex = (m_nextIndex + 1) % m_windowSize;
+    }
+
+    bool FrameTimeStabilityWindow::IsStable() const
+    {
+        return m_windowSize > 0 && m_frameTimes.size() == m_windowSize && GetMaxDeviation() <= m_tolerance;
+    }
+
+    float FrameTimeStabilityWindow::GetMean() const
+    {
+        if (m_frameTimes.empty())
+        {
+            return 0.0f;
+        }
+
+        double sum = 0.0;
+        for (float frameTime : m_frameTimes)
+        {
+            sum += frameTime;
+        }
+        return aznumeric_cast<float>(sum / m_frameTimes.size());
+    }
+
+    float FrameTimeStabilityWindow::GetMaxDeviation() const
+    {
+        const float mean = GetMean();
+        if (mean <= 0.0f)
+        {
+            return 0.0f;
+        }
+
+        float maxDeviation = 0.0f;
+        for (float frameTime : m_frameTimes)
+        {
+            maxDeviation = AZStd::max(maxDeviation, AZStd::abs(frameTime - mean) / mean);
+        }
+        return maxDeviation;
+    }
+} // namespace AtomSampleViewer
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/vector.h>
+
+namespace AtomSampleViewer
+{
+    //! Decides whether frame times have settled, for scripts that need to wait out the startup hitches of a sample
+    //! (shader compiles, texture streaming, first-use allocations) before they measure it.
+    //! Keeps the last windowSize frame times in a ring buffer; the frame time is stable once the window is full and every
+    //! frame in it is within tolerance (a fraction, e.g. 0.05 for 5%) of the window's mean.
+    class FrameTimeStabilityWindow
+    {
+    public:
+        void Reset(size_t windowSize, float tolerance);
+
+        void PushFrameTime(float frameTime);
+
+        bool IsStable() const;
+
+        //! The mean frame time over the window, or over the frames seen so far if it isn't full yet
+        float GetMean() const;
+
+        //! The largest deviation of a frame in the window from the mean, as a fraction of the mean
+        float GetMaxDeviation() const;
+
+    private:
+        AZStd::vector<float> m_frameTimes;
+        size_t m_windowSize = 0;
+        size_t m_nextIndex = 0;
+        float m_tolerance = 0.0f;
+    };
+} // namespace AtomSampleViewer
@@ -7,12 +7,51 @@
  */
 
 #include <Utils/ImGuiHistogramQueue.h>
+#include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/std/string/string.h>
 #include <imgui/imgui.h>
 
 namespace AtomSampleViewer
 {
 
+    ImGuiHistogramQueue::MonotonicWindow::MonotonicWindow(AZStd::size_t windowSize, bool trackMaximum)
+        : m_windowSize(windowSize)
+        , m_trackMaximum(trackMaximum)
+    {
+        m_entries.resize(m_windowSize);
+    }
+
+    bool ImGuiHistogramQueue::MonotonicWindow::Dominates(float newValue, float oldValue) const
+    {
+        return m_trackMaximum ? newValue >= oldValue : newValue <= oldValue;
+    }
+
+    void ImGuiHistogramQueue::MonotonicWindow::Push(AZStd::size_t sequence, float value)
+    {
+        const AZStd::size_t capacity = m_entries.size();
+
+        // Drop entries that have slid out of the window
+        while (m_size > 0 && m_entries[m_front].m_sequence + m_windowSize <= sequence)
+        {
+            m_front = (m_front + 1) % capacity;
+            --m_size;
+        }
+
+        // Drop entries that can never be the min/max again because the new value is at least as good and lives longer
+        while (m_size > 0 && Dominates(value, m_entries[(m_front + m_size - 1) % capacity].m_value))
+        {
+            --m_size;
+        }
+
+        m_entries[(m_front + m_size) % capacity] = Entry{sequence, value};
+        ++m_size;
+    }
+
+    float ImGuiHistogramQueue::MonotonicWindow::GetFront() const
+    {
+        return m_size > 0 ? m_entries[m_front].m_value : 0.0f;
+    }
+
     ImGuiHistogramQueue::ImGuiHistogramQueue(
         AZStd::size_t maxSamples,
         AZStd::size_t runningAverageSamples,
@@ -20,56 +59,72 @@ namespace AtomSampleViewer
         : m_maxSamples(maxSamples)
         , m_runningAverageSamples(runningAverageSamples)
         , m_numericDisplayDelay(numericDisplayUpdateDelay)
+        , m_windowMinimum(maxSamples, false)
+        , m_windowMaximum(maxSamples, true)
     {
+        AZ_Assert(m_maxSamples > 0, "maxSamples must be greater than zero");
         AZ_Assert(m_maxSamples >= m_runningAverageSamples, "maxSamples must be larger");
 
-        m_valueLog.reserve(m_maxSamples);
-        m_averageLog.reserve(m_maxSamples);
+        m_valueLog.resize(m_maxSamples, 0.0f);
+        m_averageLog.resize(m_maxSamples, 0.0f);
     }
 
-    float ImGuiHistogramQueue::UpdateDisplayedValues(AZStd::size_t maxSampleCount, float& minValue, float& maxValue)
+    AZStd::size_t ImGuiHistogramQueue::GetRingIndex(AZStd::size_t age) const
     {
-        size_t sampleCount = AZStd::min<size_t>(maxSampleCount, m_valueLog.size());
-        float average = 0.f;
-        if (sampleCount > 0)
-        {
-            average = m_valueLog.at(0);
-            minValue = maxValue = average;
-            for (size_t i = 1; i < sampleCount; ++i)
-            {
-                float curValue = m_valueLog.at(i);
-                average += curValue;
-                minValue = minValue > curValue ? curValue : minValue;
-                maxValue = maxValue < curValue ? curValue : maxValue;
-            }
-            average /= sampleCount;
-        }
-        return average;
+        return (m_head + age) % m_maxSamples;
+    }
+
+    float ImGuiHistogramQueue::GetValue(AZStd::size_t age) const
+    {
+        AZ_Assert(age < m_sampleCount, "Sample age %zu is out of range", age);
+        return m_valueLog[GetRingIndex(age)];
     }
 
     void ImGuiHistogramQueue::PushValue(float value)
     {
         m_samplesSinceLastDisplayUpdate++;
 
+        // The value that leaves the running average window must be read before the ring slot gets overwritten,
+        // since when the window covers the whole queue it is the oldest value.
+        if (m_runningAverageSamples > 0 && m_sampleCount >= m_runningAverageSamples)
+        {
+            m_runningAverageSum -= GetValue(m_runningAverageSamples - 1);
+        }
+
         // Update the log of all values
-        if (m_valueLog.size() == m_maxSamples)
+        m_head = (m_head + m_maxSamples - 1) % m_maxSamples;
+        if (m_sampleCount == m_maxSamples)
         {
-            m_valueLog.pop_back();
+            m_totalSum -= m_valueLog[m_head];
         }
-        m_valueLog.insert(m_valueLog.begin(), value);
+        else
+        {
+            m_sampleCount++;
+        }
+        m_valueLog[m_head] = value;
+        m_totalSum += value;
+
+        m_windowMinimum.Push(m_totalPushed, value);
+        m_windowMaximum.Push(m_totalPushed, value);
+        m_totalPushed++;
+
+        m_statistics.PushValue(value);
 
         // Calculate running average for line graph
-        if (m_averageLog.size() == m_maxSamples)
+        float runningAverage = 0.0f;
+        if (m_runningAverageSamples > 0)
         {
-            m_averageLog.pop_back();
+            m_runningAverageSum += value;
+            runningAverage = aznumeric_cast<float>(m_runningAverageSum / AZStd::min(m_runningAverageSamples, m_sampleCount));
         }
-        [[maybe_unused]] float minValue, maxValue; // unused required call parameters
-        m_averageLog.insert(m_averageLog.begin(), UpdateDisplayedValues(m_runningAverageSamples, minValue, maxValue));
+        m_averageLog[m_head] = runningAverage;
 
         // Calculate average for numeric display
         if (m_timeSinceLastDisplayUpdate >= m_numericDisplayDelay || m_samplesSinceLastDisplayUpdate >= m_maxSamples)
         {
-            m_displayedAverage = UpdateDisplayedValues(m_maxSamples, m_displayedMinimum, m_displayedMaximum);
+            m_displayedAverage = aznumeric_cast<float>(m_totalSum / m_sampleCount);
+            m_displayedMinimum = m_windowMinimum.GetFront();
+            m_displayedMaximum = m_windowMaximum.GetFront();
 
             m_timeSinceLastDisplayUpdate = 0.0f;
             m_samplesSinceLastDisplayUpdate = 0;
@@ -78,7 +133,7 @@ namespace AtomSampleViewer
 
     void ImGuiHistogramQueue::Tick(float deltaTime, WidgetSettings settings)
     {
-        if (m_averageLog.empty() || m_valueLog.empty())
+        if (m_sampleCount == 0)
         {
             return;
         }
@@ -97,16 +152,35 @@ namespace AtomSampleViewer
             valueString = AZStd::string::format("avg:%4.2f %s | min:%4.2f %s | max:%4.2f %s ", m_displayedAverage, settings.m_units, m_displayedMinimum, settings.m_units, m_displayedMaximum, settings.m_units);
         }
 
+        // Until the ring wraps the valid values are contiguous from m_head to the end of the buffer. After that the
+        // whole buffer is valid and ImGui's values_offset is used to start drawing from the newest value.
+        const bool isFull = m_sampleCount == m_maxSamples;
+        const AZStd::size_t firstIndex = isFull ? 0 : m_head;
+        const int32_t valuesOffset = isFull ? aznumeric_cast<int32_t>(m_head) : 0;
+        const int32_t valuesCount = aznumeric_cast<int32_t>(m_sampleCount);
+
         // Draw moving average of values first
         ImGui::PushStyleColor(ImGuiCol_PlotLines, ImVec4(0.6, 0.8, 0.9, 1.0));
-        ImGui::PlotLines("##Average", &m_averageLog[0], int32_t(m_averageLog.size()), 0, nullptr, 0.0f, m_displayedAverage * 2.0f, ImVec2(400, 50));
+        ImGui::PlotLines("##Average", &m_averageLog[firstIndex], valuesCount, valuesOffset, nullptr, 0.0f, m_displayedAverage * 2.0f, ImVec2(400, 50));
         ImGui::PopStyleColor();
 
         // Draw individual value bars on top of it (with no background).
         ImGui::SetCursorPos(pos);
         ImGui::PushStyleColor(ImGuiCol_FrameBg, ImVec4(0, 0, 0, 0));
-        ImGui::PlotHistogram("##Value", &m_valueLog[0], int32_t(m_valueLog.size()), 0, valueString.c_str(), 0.0f, m_displayedAverage * 2.0f, ImVec2(400, 50));
+        ImGui::PlotHistogram("##Value", &m_valueLog[firstIndex], valuesCount, valuesOffset, valueString.c_str(), 0.0f, m_displayedAverage * 2.0f, ImVec2(400, 50));
         ImGui::PopStyleColor();
+
+        if (ImGui::IsItemHovered())
+        {
+            ImGui::SetTooltip("All %llu values\np50:%4.2f %s | p90:%4.2f %s | p99:%4.2f %s | p99.9:%4.2f %s\nstddev:%4.2f %s | spikes:%llu",
+                static_cast<unsigned long long>(m_statistics.GetCount()),
+                m_statistics.GetQuantile(0.5), settings.m_units,
+                m_statistics.GetQuantile(0.9), settings.m_units,
+                m_statistics.GetQuantile(0.99), settings.m_units,
+                m_statistics.GetQuantile(0.999), settings.m_units,
+                m_statistics.GetStandardDeviation(), settings.m_units,
+                static_cast<unsigned long long>(m_statistics.GetSpikeCount()));
+        }
     }
 
 } // namespace AtomSampleViewer
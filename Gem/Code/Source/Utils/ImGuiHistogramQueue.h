@@ -9,11 +9,14 @@
 #pragma once
 
 #include <AzCore/std/containers/vector.h>
+#include <Utils/StreamingStatistics.h>
 
 namespace AtomSampleViewer
 {
     //! Tracks time values over multiple frames, computes the average, and draws a historgram.
-    class ImGuiHistogramQueue 
+    //! Values are stored in fixed-capacity ring buffers and all statistics are maintained incrementally,
+    //! so PushValue() is O(1) (amortized) regardless of maxSamples.
+    class ImGuiHistogramQueue
     {
     public:
         //! @param maxSamples the max number of samples that can be recorded in the queue and displayed in the histogram
@@ -37,19 +40,68 @@ namespace AtomSampleViewer
         float GetDisplayedMinimum() const { return m_displayedMinimum; }
         float GetDisplayedMaximum() const { return m_displayedMaximum; }
 
+        //! Returns the number of values currently held in the queue (at most maxSamples).
+        AZStd::size_t GetSampleCount() const { return m_sampleCount; }
+
+        //! Returns a previously pushed value, where age 0 is the most recent value.
+        float GetValue(AZStd::size_t age) const;
+
+        //! Returns the distribution of every value pushed so far, not just the ones still in the queue.
+        const StreamingStatistics& GetStatistics() const { return m_statistics; }
+
     private:
 
-        float UpdateDisplayedValues(AZStd::size_t maxSampleCount, float& minValue, float& maxValue);
+        //! Sliding-window minimum or maximum over the last N pushed values, using a monotonic queue.
+        //! The queue storage is a fixed-capacity ring so it never allocates after construction.
+        class MonotonicWindow
+        {
+        public:
+            MonotonicWindow(AZStd::size_t windowSize, bool trackMaximum);
+
+            void Push(AZStd::size_t sequence, float value);
+            float GetFront() const;
+
+        private:
+            struct Entry
+            {
+                AZStd::size_t m_sequence;
+                float m_value;
+            };
 
+            bool Dominates(float newValue, float oldValue) const;
+
+            AZStd::vector<Entry> m_entries;
+            AZStd::size_t m_front = 0;
+            AZStd::size_t m_size = 0;
+            const AZStd::size_t m_windowSize;
+            const bool m_trackMaximum;
+        };
+
+        //! Returns the ring buffer index for a value of the given age
+        AZStd::size_t GetRingIndex(AZStd::size_t age) const;
+
+        // Both logs share the same ring layout. Values are written backwards so that, read forwards from m_head,
+        // they are ordered newest to oldest, which is the order the histogram has always been drawn in.
         AZStd::vector<float> m_valueLog;
         AZStd::vector<float> m_averageLog;
+        AZStd::size_t m_head = 0;
+        AZStd::size_t m_sampleCount = 0;
+        AZStd::size_t m_totalPushed = 0;
 
         const AZStd::size_t m_maxSamples;
         const AZStd::size_t m_runningAverageSamples;
         const float m_numericDisplayDelay;
 
+        // Sums are kept in double precision so that adding and removing values over long runs doesn't drift noticeably
+        double m_runningAverageSum = 0.0;
+        double m_totalSum = 0.0;
+        MonotonicWindow m_windowMinimum;
+        MonotonicWindow m_windowMaximum;
+
+        StreamingStatistics m_statistics;
+
         float m_timeSinceLastDisplayUpdate = 0.0f;
-        int m_samplesSinceLastDisplayUpdate = 0;
+        AZStd::size_t m_samplesSinceLastDisplayUpdate = 0;
 
         float m_displayedAverage = 0.0f;
         float m_displayedMinimum = 0.0f;
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Utils/RangeAllocator.h>
+
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+
+namespace AtomSampleViewer
+{
+    RangeAllocator::RangeAllocator(uint32_t capacity)
+    {
+        Init(capacity);
+    }
+
+    void RangeAllocator::Init(uint32_t capacity)
+    {
+        m_capacity = capacity;
+        m_allocatedCount = 0;
+        m_allocations.clear();
+        m_freeBlocks.clear();
+        m_pendingFrees.clear();
+        if (capacity > 0)
+        {
+            m_freeBlocks.push_back({ 0, capacity });
+        }
+    }
+
+    uint32_t RangeAllocator::Allocate(uint32_t count)
+    {
+        if (count == 0)
+        {
+            return InvalidOffset;
+        }
+
+        for (auto blockIter = m_freeBlocks.begin(); blockIter != m_freeBlocks.end(); ++blockIter)
+        {
+            if (blockIter->m_count < count)
+            {
+                continue;
+            }
+
+            const uint32_t offset = blockIter->m_offset;
+            if (blockIter->m_count == count)
+            {
+                m_freeBlocks.erase(blockIter);
+            }
+            else
+            {
+                blockIter->m_offset += count;
+                blockIter->m_count -= count;
+            }
+
+            m_allocations.emplace(offset, count);
+            m_allocatedCount += count;
+            return offset;
+        }
+
+        return InvalidOffset;
+    }
+
+    void RangeAllocator::Free(uint32_t offset)
+    {
+        auto allocationIter = m_allocations.find(offset);
+        if (allocationIter == m_allocations.end())
+        {
+            AZ_Assert(false, "No range was allocated at offset %u", offset);
+            return;
+        }
+
+        const uint32_t count = allocationIter->second;
+        m_allocations.erase(allocationIter);
+        m_allocatedCount -= count;
+
+        auto nextIter = AZStd::lower_bound(m_freeBlocks.begin(), m_freeBlocks.end(), offset,
+            [](const Block& block, uint32_t value) { return block.m_offset < value; });
+
+        const bool touchesPrevious = nextIter != m_freeBlocks.begin() && (nextIter - 1)->m_offset + (nextIter - 1)->m_count == offset;
+        const bool touchesNext = nextIter != m_freeBlocks.end() && offset + count == nextIter->m_offset;
+
+        if (touchesPrevious && touchesNext)
+        {
+            (nextIter - 1)->m_count += count + nextIter->m_count;
+            m_freeBlocks.erase(nextIter);
+        }
+        else if (touchesPrevious)
+        {
+            (nextIter - 1)->m_count += count;
+        }
+        else if (touchesNext)
+        {
+            nextIter->m_offset = offset;
+            nextIter->m_count += count;
+        }
+        else
+        {
+            m_freeBlocks.insert(nextIter, { offset, count });
+        }
+    }
+
+    void RangeAllocator::FreeAfterFrames(uint32_t offset, uint32_t frameCount)
+    {
+        AZ_Assert(m_allocations.find(offset) != m_allocations.end(), "No range was allocated at offset %u", offset);
+        if (frameCount == 0)
+        {
+            Free(offset);
+            return;
+        }
+
+        m_pendingFrees.push_back({ offset, frameCount });
+    }
+
+    void RangeAllocator::NextFrame()
+    {
+        size_t keptCount = 0;
+        for (PendingFree& pendingFree : m_pendingFrees)
+        {
+            if (--pendingFree.m_framesLeft == 0)
+            {
+                Free(pendingFree.m_offset);
+            }
+            else
+            {
+                m_pendingFrees[keptCount++] = pendingFree;
+            }
+        }
+        m_pendingFrees.resize(keptCount);
+    }
+
+    uint32_t RangeAllocator::GetAllocationSize(uint32_t offset) const
+    {
+        auto allocationIter = m_allocations.find(offset);
+        return allocationIter != m_allocations.end() ? allocationIter->second : 0;
+    }
+
+    uint32_t RangeAllocator::GetLargestFreeBlock() const
+    {
+        uint32_t largest = 0;
+        for (const Block& block : m_freeBlocks)
+        {
+            largest = AZStd::max(largest, block.m_count);
+        }
+        return largest;
+    }
+
+    void DirtyRangeList::Add(uint32_t offset, uint32_t count)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        // Consecutive writes, like filling an array of objects, extend the last range instead of adding a new one
+        if (!m_ranges.empty())
+        {
+            Range& last = m_ranges.back();
+            if (offset >= last.m_offset && offset <= last.m_offset + last.m_count)
+            {
+                last.m_count = AZStd::max(last.m_count, offset + count - last.m_offset);
+                return;
+            }
+        }
+
+        m_ranges.push_back({ offset, count });
+    }
+
+    const AZStd::vector<DirtyRangeList::Range>& DirtyRangeList::Coalesce(uint32_t mergeDistance)
+    {
+        if (m_ranges.size() < 2)
+        {
+            return m_ranges;
+        }
+
+        AZStd::sort(m_ranges.begin(), m_ranges.end(), [](const Range& lhs, const Range& rhs) { return lhs.m_offset < rhs.m_offset; });
+
+        size_t mergedCount = 0;
+        for (size_t i = 1; i < m_ranges.size(); ++i)
+        {
+            Range& merged = m_ranges[mergedCount];
+            const Range& range = m_ranges[i];
+            const uint32_t mergedEnd = merged.m_offset + merged.m_count;
+            if (range.m_offset <= mergedEnd || range.m_offset - mergedEnd <= mergeDistance)
+            {
+                merged.m_count = AZStd::max(mergedEnd, range.m_offset + range.m_count) - merged.m_offset;
+            }
+            else
+            {
+                m_ranges[++mergedCount] = range;
+            }
+        }
+        m_ranges.resize(mergedCount + 1);
+
+        return m_ranges;
+    }
+} // namespace AtomSampleViewer
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AtomSampleViewer
+{
+    //! Hands out ranges of elements from a fixed capacity, e.g. ranges of floats in a GPU buffer. Ranges can be freed and
+    //! reused in any order.
+    //!
+    //! Free space is kept as a list of blocks sorted by offset. Allocation takes the first block that fits, and freeing merges
+    //! the range with the free blocks on either side, so freeing everything always gives back one block of the full capacity.
+    class RangeAllocator
+    {
+    public:
+        static constexpr uint32_t InvalidOffset = static_cast<uint32_t>(-1);
+
+        explicit RangeAllocator(uint32_t capacity = 0);
+
+        //! Frees all the ranges and sets a new capacity
+        void Init(uint32_t capacity);
+
+        //! Returns the offset of a range of the given number of elements, or InvalidOffset if there is no free block that big
+        uint32_t Allocate(uint32_t count);
+
+        //! Frees a range returned by Allocate()
+        void Free(uint32_t offset);
+
+        //! Frees a range returned by Allocate() once NextFrame() was called frameCount times, e.g. when the GPU may still be
+        //! reading it from the frames in flight. The range stays allocated until then.
+        void FreeAfterFrames(uint32_t offset, uint32_t frameCount);
+
+        //! Frees the ranges whose frame delay passed
+        void NextFrame();
+
+        //! Returns the number of elements in the range at this offset, or 0 if no range was allocated there
+        uint32_t GetAllocationSize(uint32_t offset) const;
+
+        uint32_t GetCapacity() const { return m_capacity; }
+        uint32_t GetAllocatedCount() const { return m_allocatedCount; }
+        uint32_t GetAllocationCount() const { return static_cast<uint32_t>(m_allocations.size()); }
+        uint32_t GetFreeBlockCount() const { return static_cast<uint32_t>(m_freeBlocks.size()); }
+        uint32_t GetPendingFreeCount() const { return static_cast<uint32_t>(m_pendingFrees.size()); }
+        uint32_t GetLargestFreeBlock() const;
+
+    private:
+        struct Block
+        {
+            uint32_t m_offset = 0;
+            uint32_t m_count = 0;
+        };
+
+        struct PendingFree
+        {
+            uint32_t m_offset = 0;
+            uint32_t m_framesLeft = 0;
+        };
+
+        uint32_t m_capacity = 0;
+        uint32_t m_allocatedCount = 0;
+
+        //! Sorted by offset. Blocks never touch, they are merged when they do.
+        AZStd::vector<Block> m_freeBlocks;
+
+        //! Size of each allocated range by offset
+        AZStd::unordered_map<uint32_t, uint32_t> m_allocations;
+
+        //! Ranges passed to FreeAfterFrames() that are still allocated
+        AZStd::vector<PendingFree> m_pendingFrees;
+    };
+
+    //! Collects the ranges of elements that were written since the last upload, so they can be uploaded together.
+    class DirtyRangeList
+    {
+    public:
+        struct Range
+        {
+            uint32_t m_offset = 0;
+            uint32_t m_count = 0;
+        };
+
+        void Add(uint32_t offset, uint32_t count);
+
+        //! Sorts the ranges and merges the ones that overlap or are at most mergeDistance elements apart. Merging ranges with a
+        //! small gap between them uploads a little more data, but with fewer copies.
+        const AZStd::vector<Range>& Coalesce(uint32_t mergeDistance = 0);
+
+        const AZStd::vector<Range>& GetRanges() const { return m_ranges; }
+        bool IsEmpty() const { return m_ranges.empty(); }
+        void Clear() { m_ranges.clear(); }
+
+    private:
+        AZStd::vector<Range> m_ranges;
+    };
+} // namespace AtomSampleViewer
@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Utils/SampleAssetPrefetcher.h>
+#include <Utils/Utils.h>
+
+#include <AzCore/Asset/AssetManager.h>
+#include <AzCore/Asset/AssetManagerBus.h>
+#include <AzCore/Serialization/Json/JsonUtils.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzFramework/API/ApplicationAPI.h>
+#include <AzFramework/IO/LocalFileIO.h>
+#include <AzFramework/StringFunc/StringFunc.h>
+
+namespace AtomSampleViewer
+{
+    bool SampleAssetPrefetcher::IsLookAheadEnabled()
+    {
+        bool isLookAheadEnabled = false;
+        if (auto settingsRegistry = AZ::SettingsRegistry::Get())
+        {
+            settingsRegistry->Get(isLookAheadEnabled, LookAheadSetting);
+        }
+
+        const AzFramework::CommandLine* commandLine = nullptr;
+        AzFramework::ApplicationRequests::Bus::BroadcastResult(commandLine, &AzFramework::ApplicationRequests::GetCommandLine);
+        if (commandLine && commandLine->HasSwitch(LookAheadSwitch))
+        {
+            isLookAheadEnabled = true;
+        }
+
+        return isLookAheadEnabled;
+    }
+
+    SampleAssetPrefetcher::SampleAssetPrefetcher()
+        : m_loadAsset([](const AZ::AssetCollectionAsyncLoader::AssetToLoadInfo& assetInfo)
+            {
+                AZ::Data::AssetId assetId;
+                AZ::Data::AssetCatalogRequestBus::BroadcastResult(
+                    assetId, &AZ::Data::AssetCatalogRequestBus::Events::GetAssetIdByPath, assetInfo.m_assetPath.c_str(), assetInfo.m_assetType, false);
+
+                if (!assetId.IsValid())
+                {
+                    return AZ::Data::Asset<AZ::Data::AssetData>();
+                }
+
+                // Loads on the AssetManager's job threads; nothing waits for it here
+                return AZ::Data::AssetManager::Instance().GetAsset(assetId, assetInfo.m_assetType, AZ::Data::AssetLoadBehavior::PreLoad);
+            })
+    {
+    }
+
+    SampleAssetPrefetcher::SampleAssetPrefetcher(LoadAssetFunction loadAsset)
+        : m_loadAsset(AZStd::move(loadAsset))
+    {
+    }
+
+    void SampleAssetPrefetcher::Activate()
+    {
+        m_isEnabled = true;
+        if (auto settingsRegistry = AZ::SettingsRegistry::Get())
+        {
+            settingsRegistry->Get(m_isEnabled, EnabledSetting);
+        }
+
+        const AzFramework::CommandLine* commandLine = nullptr;
+        AzFramework::ApplicationRequests::Bus::BroadcastResult(commandLine, &AzFramework::ApplicationRequests::GetCommandLine);
+        if (commandLine && commandLine->HasSwitch(NoPrefetchSwitch))
+        {
+            m_isEnabled = false;
+        }
+
+        LoadManifest();
+    }
+
+    void SampleAssetPrefetcher::Deactivate()
+    {
+        m_prefetchedAssets.clear();
+        m_nextSampleName.clear();
+
+        if (m_isManifestDirty)
+        {
+            SaveManifest();
+            m_isManifestDirty = false;
+        }
+    }
+
+    void SampleAssetPrefetcher::RecordSampleAssets(const AZStd::string& sampleName, const AssetList& assetList)
+    {
+        if (sampleName.empty())
+        {
+            return;
+        }
+
+        AssetList& recordedList = m_manifest[sampleName];
+
+        const bool isUnchanged = recordedList.size() == assetList.size() && AZStd::equal(recordedList.begin(), recordedList.end(), assetList.begin(),
+            [](const AZ::AssetCollectionAsyncLoader::AssetToLoadInfo& a, const AZ::AssetCollectionAsyncLoader::AssetToLoadInfo& b)
+            {
+                return a.m_assetPath == b.m_assetPath && a.m_assetType == b.m_assetType;
+            });
+
+        if (!isUnchanged)
+        {
+            recordedList = assetList;
+            m_isManifestDirty = true;
+        }
+    }
+
+    bool SampleAssetPrefetcher::Prefetch(const AZStd::string& sampleName)
+    {
+        if (!m_isEnabled)
+        {
+            return false;
+        }
+
+        auto manifestIter = m_manifest.find(sampleName);
+        if (manifestIter == m_manifest.end())
+        {
+            return false;
+        }
+
+        m_nextSampleName = sampleName;
+
+        auto& prefetchedAssets = m_prefetchedAssets[sampleName];
+        if (!prefetchedAssets.empty())
+        {
+            // Already prefetched, and still held
+            return true;
+        }
+
+        for (const auto& assetInfo : manifestIter->second)
+        {
+            AZ::Data::Asset<AZ::Data::AssetData> asset = m_loadAsset(assetInfo);
+
+            // The sample will report missing assets when it opens
+            if (asset.GetId().IsValid())
+            {
+                prefetchedAssets.push_back(AZStd::move(asset));
+            }
+        }
+
+        AZ_TracePrintf("SampleAssetPrefetcher", "Prefetching %zu assets for '%s'\n", prefetchedAssets.size(), sampleName.c_str());
+        return true;
+    }
+
+    void SampleAssetPrefetcher::OnSampleActivated(const AZStd::string& sampleName)
+    {
+        // The sample's own AssetCollectionAsyncLoader may still be resolving its asset list, so its prefetched assets are held
+        // until the next sample opens.
+        AZStd::erase_if(m_prefetchedAssets, [&](const auto& entry)
+            {
+                return entry.first != sampleName && entry.first != m_nextSampleName;
+            });
+    }
+
+    const SampleAssetPrefetcher::AssetList* SampleAssetPrefetcher::GetSampleAssets(const AZStd::string& sampleName) const
+    {
+        auto manifestIter = m_manifest.find(sampleName);
+        return manifestIter != m_manifest.end() ? &manifestIter->second : nullptr;
+    }
+
+    size_t SampleAssetPrefetcher::GetPrefetchedAssetCount(const AZStd::string& sampleName) const
+    {
+        auto prefetchedIter = m_prefetchedAssets.find(sampleName);
+        return prefetchedIter != m_prefetchedAssets.end() ? prefetchedIter->second.size() : 0;
+    }
+
+    void SampleAssetPrefetcher::ReadManifestJson(const rapidjson::Value& value)
+    {
+        m_manifest.clear();
+        m_isManifestDirty = false;
+
+        if (!value.IsObject())
+        {
+            return;
+        }
+
+        for (const auto& sampleMember : value.GetObject())
+        {
+            if (!sampleMember.value.IsArray())
+            {
+                continue;
+            }
+
+            AssetList& assetList = m_manifest[sampleMember.name.GetString()];
+            for (const auto& assetValue : sampleMember.value.GetArray())
+            {
+                if (assetValue.IsObject() && assetValue.HasMember("path") && assetValue["path"].IsString() &&
+                    assetValue.HasMember("type") && assetValue["type"].IsString())
+                {
+                    AZ::AssetCollectionAsyncLoader::AssetToLoadInfo& assetInfo = assetList.emplace_back();
+                    assetInfo.m_assetPath = assetValue["path"].GetString();
+                    assetInfo.m_assetType = AZ::Uuid::CreateString(assetValue["type"].GetString());
+                }
+            }
+        }
+    }
+
+    void SampleAssetPrefetcher::WriteManifestJson(rapidjson::Document& document) const
+    {
+        document.SetObject();
+        auto& allocator = document.GetAllocator();
+
+        for (const auto& [sampleName, assetList] : m_manifest)
+        {
+            rapidjson::Value assets(rapidjson::kArrayType);
+            for (const auto& assetInfo : assetList)
+            {
+                rapidjson::Value asset(rapidjson::kObjectType);
+                asset.AddMember("path", rapidjson::Value(assetInfo.m_assetPath.c_str(), allocator), allocator);
+                asset.AddMember("type", rapidjson::Value(assetInfo.m_assetType.ToString<AZStd::string>().c_str(), allocator), allocator);
+                assets.PushBack(asset, allocator);
+            }
+            document.AddMember(rapidjson::Value(sampleName.c_str(), allocator), assets, allocator);
+        }
+    }
+
+    bool SampleAssetPrefetcher::LoadManifest()
+    {
+        m_manifest.clear();
+        m_isManifestDirty = false;
+
+        const AZStd::string filePath = Utils::ResolvePath(ManifestFilePath);
+        if (!AZ::IO::LocalFileIO::GetInstance()->Exists(filePath.c_str()))
+        {
+            return false;
+        }
+
+        auto readResult = AZ::JsonSerializationUtils::ReadJsonFile(filePath);
+        if (!readResult.IsSuccess() || !readResult.GetValue().IsObject())
+        {
+            AZ_Warning("SampleAssetPrefetcher", false, "Could not read the sample asset manifest '%s'. Samples will not be prefetched until they have run once.", filePath.c_str());
+            return false;
+        }
+
+        ReadManifestJson(readResult.GetValue());
+        return true;
+    }
+
+    bool SampleAssetPrefetcher::SaveManifest() const
+    {
+        rapidjson::Document document;
+        WriteManifestJson(document);
+
+        const AZStd::string filePath = Utils::ResolvePath(ManifestFilePath);
+        AZStd::string folderPath;
+        AzFramework::StringFunc::Path::GetFolderPath(filePath.c_str(), folderPath);
+        AZ::IO::LocalFileIO::GetInstance()->CreatePath(folderPath.c_str());
+
+        auto writeResult = AZ::JsonSerializationUtils::WriteJsonFile(document, filePath);
+        AZ_Warning("SampleAssetPrefetcher", writeResult.IsSuccess(), "Could not write the sample asset manifest '%s'.", filePath.c_str());
+        return writeResult.IsSuccess();
+    }
+} // namespace AtomSampleViewer
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/Utils/AssetCollectionAsyncLoader.h>
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/JSON/document.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+namespace AtomSampleViewer
+{
+    //! Warms the asset caches for a sample before it is opened, so a test suite switching samples doesn't pay the full load
+    //! latency of each one after the previous sample was torn down.
+    //!
+    //! Samples don't declare their assets up front; they build the list in Activate() and pass it to
+    //! CommonSampleComponentBase::PreloadAssets(). That list is recorded here per sample and kept in a manifest file, so the
+    //! next run knows what each sample will load. Prefetch() queues those assets on the AssetManager's job threads without
+    //! activating anything, and holds references to them until the sample has opened and taken its own.
+    //!
+    //! Scripts prefetch a sample with PrefetchSample(). Prefetching the next sample a script opens automatically is opt-in
+    //! (LookAheadSetting), since the extra loads run alongside the current sample and skew its captures.
+    class SampleAssetPrefetcher
+    {
+    public:
+        using AssetList = AZStd::vector<AZ::AssetCollectionAsyncLoader::AssetToLoadInfo>;
+
+        //! Starts loading an asset and returns a reference to it, or an empty asset if it doesn't exist
+        using LoadAssetFunction = AZStd::function<AZ::Data::Asset<AZ::Data::AssetData>(const AZ::AssetCollectionAsyncLoader::AssetToLoadInfo& assetInfo)>;
+
+        //! Settings registry key, true by default. Turn it off for benchmarks that measure cold loads.
+        static constexpr const char* EnabledSetting = "/O3DE/AtomSampleViewer/PrefetchSampleAssets";
+        //! Command line switch that disables prefetching, same as setting EnabledSetting to false
+        static constexpr const char* NoPrefetchSwitch = "noprefetch";
+        static constexpr const char* ManifestFilePath = "@user@/SampleAssetManifest.json";
+
+        //! Settings registry key, false by default. Turn it on to have scripts prefetch the next sample they open while the
+        //! current one runs. Leave it off for benchmark and profiling captures.
+        static constexpr const char* LookAheadSetting = "/O3DE/AtomSampleViewer/PrefetchNextSample";
+        //! Command line switch that turns on LookAheadSetting
+        static constexpr const char* LookAheadSwitch = "prefetchnextsample";
+
+        //! Returns whether LookAheadSetting or LookAheadSwitch is on
+        static bool IsLookAheadEnabled();
+
+        //! Loads the assets with the AssetManager
+        SampleAssetPrefetcher();
+        explicit SampleAssetPrefetcher(LoadAssetFunction loadAsset);
+
+        //! Reads the settings and the manifest from the previous run
+        void Activate();
+
+        //! Releases any prefetched assets and saves the manifest if it changed
+        void Deactivate();
+
+        bool IsEnabled() const { return m_isEnabled; }
+
+        //! Remembers the assets the sample preloads, for the next time it is prefetched
+        void RecordSampleAssets(const AZStd::string& sampleName, const AssetList& assetList);
+
+        //! Starts loading the assets the sample preloaded the last time it ran.
+        //! @return false if prefetching is disabled or nothing is known about the sample
+        bool Prefetch(const AZStd::string& sampleName);
+
+        //! Called once a sample has been activated. Prefetched assets of samples other than this one and the one being
+        //! prefetched next are no longer needed and are released.
+        void OnSampleActivated(const AZStd::string& sampleName);
+
+        //! Returns the assets recorded for a sample, or null if nothing is known about it
+        const AssetList* GetSampleAssets(const AZStd::string& sampleName) const;
+
+        //! Returns the number of prefetched assets held for a sample
+        size_t GetPrefetchedAssetCount(const AZStd::string& sampleName) const;
+
+        //! Whether the manifest changed since it was loaded
+        bool IsManifestDirty() const { return m_isManifestDirty; }
+
+        //! Replaces the manifest with what's in the JSON value
+        void ReadManifestJson(const rapidjson::Value& value);
+        void WriteManifestJson(rapidjson::Document& document) const;
+
+    private:
+        bool LoadManifest();
+        bool SaveManifest() const;
+
+        LoadAssetFunction m_loadAsset;
+
+        bool m_isEnabled = true;
+        bool m_isManifestDirty = false;
+        AZStd::unordered_map<AZStd::string, AssetList> m_manifest;
+
+        AZStd::string m_nextSampleName; //!< The sample most recently passed to Prefetch()
+        AZStd::unordered_map<AZStd::string, AZStd::vector<AZ::Data::Asset<AZ::Data::AssetData>>> m_prefetchedAssets;
+    };
+} // namespace AtomSampleViewer
@@ -0,0 +1,328 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Utils/SphericalHarmonicsProjection.h>
+#include <Utils/Utils.h>
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/Simd.h>
+
+namespace AtomSampleViewer
+{
+    namespace SphericalHarmonicsProjection
+    {
+        namespace
+        {
+            // Samples are generated and projected in blocks of this size. A block is the unit of work of a job, and the
+            // order in which the partial sums of the blocks are added.
+            constexpr uint32_t SamplesPerBlock = 4096;
+            constexpr size_t CubemapRowsPerJob = 16;
+
+            // Normalization constants of the basis functions
+            constexpr float K0 = 0.282095f;   // 1/2 sqrt(1/pi)
+            constexpr float K1 = 0.488603f;   // sqrt(3/(4pi))
+            constexpr float K2a = 1.092548f;  // 1/2 sqrt(15/pi)
+            constexpr float K2b = 0.315392f;  // 1/4 sqrt(5/pi)
+            constexpr float K2c = 0.546274f;  // 1/4 sqrt(15/pi)
+            constexpr float K3a = 0.590044f;  // 1/4 sqrt(35/(2pi))
+            constexpr float K3b = 2.890611f;  // 1/2 sqrt(105/pi)
+            constexpr float K3c = 0.457046f;  // 1/4 sqrt(21/(2pi))
+            constexpr float K3d = 0.373176f;  // 1/4 sqrt(7/pi)
+            constexpr float K3e = 1.445306f;  // 1/4 sqrt(105/pi)
+
+            // The same polynomials as EvaluateBasis(), for four directions
+            void EvaluateBasis4(
+                AZ::Simd::Vec4::FloatArgType x,
+                AZ::Simd::Vec4::FloatArgType y,
+                AZ::Simd::Vec4::FloatArgType z,
+                AZ::Simd::Vec4::FloatType basis[CoefficientCount])
+            {
+                using namespace AZ::Simd;
+
+                const Vec4::FloatType xx = Vec4::Mul(x, x);
+                const Vec4::FloatType yy = Vec4::Mul(y, y);
+                const Vec4::FloatType zz = Vec4::Mul(z, z);
+                const Vec4::FloatType xy = Vec4::Mul(x, y);
+                const Vec4::FloatType xxMinusYy = Vec4::Sub(xx, yy);
+                const Vec4::FloatType xxPlusYy = Vec4::Add(xx, yy);
+                const Vec4::FloatType fourZzMinusXxYy = Vec4::Sub(Vec4::Mul(Vec4::Splat(4.0f), zz), xxPlusYy);
+
+                basis[0] = Vec4::Splat(K0);
+
+                basis[1] = Vec4::Mul(Vec4::Splat(K1), y);
+                basis[2] = Vec4::Mul(Vec4::Splat(K1), z);
+                basis[3] = Vec4::Mul(Vec4::Splat(K1), x);
+
+                basis[4] = Vec4::Mul(Vec4::Splat(K2a), xy);
+                basis[5] = Vec4::Mul(Vec4::Splat(K2a), Vec4::Mul(y, z));
+                basis[6] = Vec4::Mul(Vec4::Splat(K2b), Vec4::Madd(Vec4::Splat(3.0f), zz, Vec4::Splat(-1.0f)));
+                basis[7] = Vec4::Mul(Vec4::Splat(K2a), Vec4::Mul(x, z));
+                basis[8] = Vec4::Mul(Vec4::Splat(K2c), xxMinusYy);
+
+                basis[9] = Vec4::Mul(Vec4::Mul(Vec4::Splat(K3a), y), Vec4::Sub(Vec4::Mul(Vec4::Splat(3.0f), xx), yy));
+                basis[10] = Vec4::Mul(Vec4::Splat(K3b), Vec4::Mul(xy, z));
+                basis[11] = Vec4::Mul(Vec4::Mul(Vec4::Splat(K3c), y), fourZzMinusXxYy);
+                basis[12] = Vec4::Mul(Vec4::Mul(Vec4::Splat(K3d), z), Vec4::Sub(Vec4::Mul(Vec4::Splat(2.0f), zz), Vec4::Mul(Vec4::Splat(3.0f), xxPlusYy)));
+                basis[13] = Vec4::Mul(Vec4::Mul(Vec4::Splat(K3c), x), fourZzMinusXxYy);
+                basis[14] = Vec4::Mul(Vec4::Mul(Vec4::Splat(K3e), z), xxMinusYy);
+                basis[15] = Vec4::Mul(Vec4::Mul(Vec4::Splat(K3a), x), Vec4::Sub(xx, Vec4::Mul(Vec4::Splat(3.0f), yy)));
+            }
+
+            // Van der Corput sequence in base 2
+            double RadicalInverse(uint32_t bits)
+            {
+                bits = (bits << 16u) | (bits >> 16u);
+                bits = ((bits & 0x55555555u) << 1u) | ((bits & 0xAAAAAAAAu) >> 1u);
+                bits = ((bits & 0x33333333u) << 2u) | ((bits & 0xCCCCCCCCu) >> 2u);
+                bits = ((bits & 0x0F0F0F0Fu) << 4u) | ((bits & 0xF0F0F0F0u) >> 4u);
+                bits = ((bits & 0x00FF00FFu) << 8u) | ((bits & 0xFF00FF00u) >> 8u);
+                return bits * 2.3283064365386963e-10; // 1 / 2^32
+            }
+
+            double GetCubemapAreaElement(double x, double y)
+            {
+                return atan2(x * y, sqrt(x * x + y * y + 1.0));
+            }
+
+            Coefficients Reduce(const AZStd::vector<Coefficients>& partials, size_t first, size_t stride, double scale)
+            {
+                AZStd::array<double, CoefficientCount> sums = {};
+                for (size_t i = first; i < partials.size(); i += stride)
+                {
+                    for (uint32_t k = 0; k < CoefficientCount; ++k)
+                    {
+                        sums[k] += partials[i][k];
+                    }
+                }
+
+                Coefficients result;
+                for (uint32_t k = 0; k < CoefficientCount; ++k)
+                {
+                    result[k] = static_cast<float>(sums[k] * scale);
+                }
+                return result;
+            }
+        } // namespace
+
+        void EvaluateBasis(const float direction[3], float basis[CoefficientCount])
+        {
+            const float x = direction[0];
+            const float y = direction[1];
+            const float z = direction[2];
+
+            basis[0] = K0;
+
+            basis[1] = K1 * y;
+            basis[2] = K1 * z;
+            basis[3] = K1 * x;
+
+            basis[4] = K2a * x * y;
+            basis[5] = K2a * y * z;
+            basis[6] = K2b * (3.0f * z * z - 1.0f);
+            basis[7] = K2a * x * z;
+            basis[8] = K2c * (x * x - y * y);
+
+            basis[9] = K3a * y * (3.0f * x * x - y * y);
+            basis[10] = K3b * x * y * z;
+            basis[11] = K3c * y * (4.0f * z * z - x * x - y * y);
+            basis[12] = K3d * z * (2.0f * z * z - 3.0f * x * x - 3.0f * y * y);
+            basis[13] = K3c * x * (4.0f * z * z - x * x - y * y);
+            basis[14] = K3e * z * (x * x - y * y);
+            basis[15] = K3a * x * (x * x - 3.0f * y * y);
+        }
+
+        void GetHammersleyDirection(uint32_t index, uint32_t count, float direction[3])
+        {
+            // Equal area mapping: cos(theta) is uniform in [-1, 1] and phi is uniform in [0, 2pi)
+            const double cosTheta = 1.0 - 2.0 * (index + 0.5) / count;
+            const double sinTheta = sqrt(AZStd::max(0.0, 1.0 - cosTheta * cosTheta));
+            const double phi = 2.0 * AZ::Constants::Pi * RadicalInverse(index);
+
+            direction[0] = static_cast<float>(sinTheta * cos(phi));
+            direction[1] = static_cast<float>(sinTheta * sin(phi));
+            direction[2] = static_cast<float>(cosTheta);
+        }
+
+        Coefficients ProjectSamples(const float* x, const float* y, const float* z, const float* weights, size_t count)
+        {
+            using namespace AZ::Simd;
+
+            Vec4::FloatType sums[CoefficientCount];
+            for (Vec4::FloatType& sum : sums)
+            {
+                sum = Vec4::ZeroFloat();
+            }
+
+            size_t i = 0;
+            for (; i + 4 <= count; i += 4)
+            {
+                Vec4::FloatType basis[CoefficientCount];
+                EvaluateBasis4(Vec4::LoadUnaligned(x + i), Vec4::LoadUnaligned(y + i), Vec4::LoadUnaligned(z + i), basis);
+
+                const Vec4::FloatType weight = Vec4::LoadUnaligned(weights + i);
+                for (uint32_t k = 0; k < CoefficientCount; ++k)
+                {
+                    sums[k] = Vec4::Madd(basis[k], weight, sums[k]);
+                }
+            }
+
+            Coefficients result;
+            for (uint32_t k = 0; k < CoefficientCount; ++k)
+            {
+                float lanes[4];
+                Vec4::StoreUnaligned(lanes, sums[k]);
+                result[k] = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+            }
+
+            for (; i < count; ++i)
+            {
+                const float direction[3] = { x[i], y[i], z[i] };
+                float basis[CoefficientCount];
+                EvaluateBasis(direction, basis);
+                for (uint32_t k = 0; k < CoefficientCount; ++k)
+                {
+                    result[k] += basis[k] * weights[i];
+                }
+            }
+
+            return result;
+        }
+
+        Coefficients ProjectFunction(const BatchFunction& function, uint32_t sampleCount)
+        {
+            if (sampleCount == 0)
+            {
+                return {};
+            }
+
+            const size_t blockCount = (sampleCount + SamplesPerBlock - 1) / SamplesPerBlock;
+            AZStd::vector<Coefficients> partials(blockCount);
+
+            Utils::ParallelForChunks(blockCount, 1, [&](size_t beginBlock, size_t endBlock)
+                {
+                    AZStd::vector<float> x(SamplesPerBlock);
+                    AZStd::vector<float> y(SamplesPerBlock);
+                    AZStd::vector<float> z(SamplesPerBlock);
+                    AZStd::vector<float> radiance(SamplesPerBlock);
+
+                    for (size_t block = beginBlock; block < endBlock; ++block)
+                    {
+                        const uint32_t first = static_cast<uint32_t>(block * SamplesPerBlock);
+                        const uint32_t count = AZStd::min(SamplesPerBlock, sampleCount - first);
+                        for (uint32_t i = 0; i < count; ++i)
+                        {
+                            float direction[3];
+                            GetHammersleyDirection(first + i, sampleCount, direction);
+                            x[i] = direction[0];
+                            y[i] = direction[1];
+                            z[i] = direction[2];
+                        }
+
+                        function(x.data(), y.data(), z.data(), radiance.data(), count);
+                        partials[block] = ProjectSamples(x.data(), y.data(), z.data(), radiance.data(), count);
+                    }
+                });
+
+            // Every sample covers the same share of the sphere
+            return Reduce(partials, 0, 1, 4.0 * AZ::Constants::Pi / sampleCount);
+        }
+
+        AZStd::vector<Coefficients> ProjectCubemap(const AZStd::array<const float*, 6>& faces, uint32_t faceSize, uint32_t channelCount)
+        {
+            if (faceSize == 0 || channelCount == 0)
+            {
+                return AZStd::vector<Coefficients>(channelCount, Coefficients{});
+            }
+
+            // One partial sum per row of texels and channel
+            const size_t rowCount = 6 * size_t(faceSize);
+            AZStd::vector<Coefficients> partials(rowCount * channelCount);
+
+            Utils::ParallelForChunks(rowCount, CubemapRowsPerJob, [&](size_t beginRow, size_t endRow)
+                {
+                    AZStd::vector<float> x(faceSize);
+                    AZStd::vector<float> y(faceSize);
+                    AZStd::vector<float> z(faceSize);
+                    AZStd::vector<float> solidAngles(faceSize);
+                    AZStd::vector<float> weights(faceSize);
+
+                    for (size_t row = beginRow; row < endRow; ++row)
+                    {
+                        const uint32_t face = static_cast<uint32_t>(row / faceSize);
+                        const uint32_t texelY = static_cast<uint32_t>(row % faceSize);
+                        for (uint32_t texelX = 0; texelX < faceSize; ++texelX)
+                        {
+                            float direction[3];
+                            GetCubemapTexelDirection(face, texelX, texelY, faceSize, direction);
+                            x[texelX] = direction[0];
+                            y[texelX] = direction[1];
+                            z[texelX] = direction[2];
+                            solidAngles[texelX] = GetCubemapTexelSolidAngle(texelX, texelY, faceSize);
+                        }
+
+                        const float* texels = faces[face] + size_t(texelY) * faceSize * channelCount;
+                        for (uint32_t channel = 0; channel < channelCount; ++channel)
+                        {
+                            for (uint32_t texelX = 0; texelX < faceSize; ++texelX)
+                            {
+                                weights[texelX] = texels[size_t(texelX) * channelCount + channel] * solidAngles[texelX];
+                            }
+                            partials[row * channelCount + channel] = ProjectSamples(x.data(), y.data(), z.data(), weights.data(), faceSize);
+                        }
+                    }
+                });
+
+            AZStd::vector<Coefficients> result(channelCount);
+            for (uint32_t channel = 0; channel < channelCount; ++channel)
+            {
+                result[channel] = Reduce(partials, channel, channelCount, 1.0);
+            }
+            return result;
+        }
+
+        void GetCubemapTexelDirection(uint32_t face, uint32_t texelX, uint32_t texelY, uint32_t faceSize, float direction[3])
+        {
+            // Texel centers in [-1, 1], with v going down the face like the rows do
+            const float u = 2.0f * (texelX + 0.5f) / faceSize - 1.0f;
+            const float v = 2.0f * (texelY + 0.5f) / faceSize - 1.0f;
+
+            float x = 0.0f;
+            float y = 0.0f;
+            float z = 0.0f;
+            switch (face)
+            {
+            case 0: x = 1.0f;  y = -v;    z = -u;    break; // +X
+            case 1: x = -1.0f; y = -v;    z = u;     break; // -X
+            case 2: x = u;     y = 1.0f;  z = v;     break; // +Y
+            case 3: x = u;     y = -1.0f; z = -v;    break; // -Y
+            case 4: x = u;     y = -v;    z = 1.0f;  break; // +Z
+            case 5: x = -u;    y = -v;    z = -1.0f; break; // -Z
+            default: AZ_Assert(false, "Cubemap face %u is out of range", face); break;
+            }
+
+            const float inverseLength = 1.0f / sqrtf(x * x + y * y + z * z);
+            direction[0] = x * inverseLength;
+            direction[1] = y * inverseLength;
+            direction[2] = z * inverseLength;
+        }
+
+        float GetCubemapTexelSolidAngle(uint32_t texelX, uint32_t texelY, uint32_t faceSize)
+        {
+            // The solid angle of the rectangle from the face center to (x, y) has a closed form, and a texel is the
+            // difference of four of those rectangles
+            const double texelSize = 2.0 / faceSize;
+            const double x0 = texelX * texelSize - 1.0;
+            const double y0 = texelY * texelSize - 1.0;
+            const double x1 = x0 + texelSize;
+            const double y1 = y0 + texelSize;
+
+            return static_cast<float>(
+                GetCubemapAreaElement(x0, y0) - GetCubemapAreaElement(x0, y1) - GetCubemapAreaElement(x1, y0) + GetCubemapAreaElement(x1, y1));
+        }
+    } // namespace SphericalHarmonicsProjection
+} // namespace AtomSampleViewer
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+
+namespace AtomSampleViewer
+{
+    //! Projects functions on the sphere and cubemaps onto the real spherical harmonics basis of bands 0 to 3.
+    //!
+    //! Directions are processed in batches of structure-of-arrays, and the kernel evaluates all 16 basis functions for four
+    //! directions at once with AZ::Simd. Functions are sampled at the points of a Hammersley set, which converges much
+    //! faster than independent random samples. The work is split in fixed blocks across the job system, and the partial
+    //! sums of the blocks are added in order, so the result doesn't depend on the number of threads.
+    namespace SphericalHarmonicsProjection
+    {
+        static constexpr uint32_t BandCount = 4;
+        static constexpr uint32_t CoefficientCount = BandCount * BandCount;
+
+        //! Coefficient l * (l + 1) + m is for band l, order m
+        using Coefficients = AZStd::array<float, CoefficientCount>;
+
+        //! Fills radiance[i] with the value of the function in direction (x[i], y[i], z[i]), for i in [0, count)
+        using BatchFunction = AZStd::function<void(const float* x, const float* y, const float* z, float* radiance, size_t count)>;
+
+        //! Evaluates the 16 basis functions in a unit direction, one at a time. This is the reference for the batched kernel.
+        void EvaluateBasis(const float direction[3], float basis[CoefficientCount]);
+
+        //! Returns point index of a Hammersley set of count points, mapped uniformly onto the unit sphere
+        void GetHammersleyDirection(uint32_t index, uint32_t count, float direction[3]);
+
+        //! Returns the sum of weights[i] * basis(x[i], y[i], z[i]) over the count unit directions
+        Coefficients ProjectSamples(const float* x, const float* y, const float* z, const float* weights, size_t count);
+
+        //! Returns the projection of a function on the sphere, integrated with sampleCount Hammersley points
+        Coefficients ProjectFunction(const BatchFunction& function, uint32_t sampleCount);
+
+        //! Returns the projection of each channel of a cubemap, weighting each texel by its solid angle.
+        //! @param faces the +X, -X, +Y, -Y, +Z and -Z faces, each with faceSize * faceSize texels in rows from the top
+        //! @param channelCount the number of floats per texel
+        AZStd::vector<Coefficients> ProjectCubemap(const AZStd::array<const float*, 6>& faces, uint32_t faceSize, uint32_t channelCount);
+
+        //! Returns the unit direction through the center of a cubemap texel
+        void GetCubemapTexelDirection(uint32_t face, uint32_t texelX, uint32_t texelY, uint32_t faceSize, float direction[3]);
+
+        //! Returns the solid angle that a cubemap texel covers. The texels of the six faces add up to 4 pi.
+        float GetCubemapTexelSolidAngle(uint32_t texelX, uint32_t texelY, uint32_t faceSize);
+    } // namespace SphericalHarmonicsProjection
+} // namespace AtomSampleViewer
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Utils/StreamingStatistics.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Math/MathUtils.h>
+
+namespace AtomSampleViewer
+{
+    StreamingStatistics::StreamingStatistics(float minValue, float maxValue, float relativePrecision, float spikeFactor)
+        : m_spikeFactor(spikeFactor)
+    {
+        AZ_Assert(minValue > 0.0f && maxValue > minValue, "StreamingStatistics needs a positive value range");
+        AZ_Assert(relativePrecision > 0.0f && relativePrecision < 1.0f, "relativePrecision must be in (0, 1)");
+
+        // Each bucket spans [lower, lower * (1 + 2 * precision)). Reporting the geometric middle of the bucket keeps the
+        // error to about the requested precision in either direction.
+        m_logMinValue = log(minValue);
+        m_logBucketWidth = log(1.0 + 2.0 * relativePrecision);
+
+        const size_t bucketCount = aznumeric_cast<size_t>(ceil((log(maxValue) - m_logMinValue) / m_logBucketWidth)) + 1;
+        m_buckets.resize(bucketCount, 0);
+    }
+
+    void StreamingStatistics::Reset()
+    {
+        AZStd::fill(m_buckets.begin(), m_buckets.end(), AZ::u64(0));
+        m_count = 0;
+        m_mean = 0.0;
+        m_sumSquaredDeviations = 0.0;
+        m_minimum = 0.0f;
+        m_maximum = 0.0f;
+        m_recentAverage = 0.0;
+        m_spikeCount = 0;
+    }
+
+    size_t StreamingStatistics::GetBucketIndex(float value) const
+    {
+        if (value <= 0.0f)
+        {
+            return 0;
+        }
+
+        const double index = floor((log(value) - m_logMinValue) / m_logBucketWidth);
+        return aznumeric_cast<size_t>(AZ::GetClamp(index, 0.0, aznumeric_cast<double>(m_buckets.size() - 1)));
+    }
+
+    float StreamingStatistics::GetBucketValue(size_t bucketIndex) const
+    {
+        return aznumeric_cast<float>(exp(m_logMinValue + (bucketIndex + 0.5) * m_logBucketWidth));
+    }
+
+    void StreamingStatistics::PushValue(float value)
+    {
+        if (m_count == 0)
+        {
+            m_minimum = value;
+            m_maximum = value;
+            m_recentAverage = value;
+        }
+        else
+        {
+            m_minimum = AZStd::min(m_minimum, value);
+            m_maximum = AZStd::max(m_maximum, value);
+
+            if (m_count >= SpikeAverageWindow && value > m_spikeFactor * m_recentAverage)
+            {
+                ++m_spikeCount;
+            }
+
+            m_recentAverage += (value - m_recentAverage) / SpikeAverageWindow;
+        }
+
+        ++m_count;
+        const double delta = value - m_mean;
+        m_mean += delta / m_count;
+        m_sumSquaredDeviations += delta * (value - m_mean);
+
+        ++m_buckets[GetBucketIndex(value)];
+    }
+
+    double StreamingStatistics::GetStandardDeviation() const
+    {
+        return m_count > 1 ? sqrt(m_sumSquaredDeviations / m_count) : 0.0;
+    }
+
+    float StreamingStatistics::GetQuantile(double fraction) const
+    {
+        if (m_count == 0)
+        {
+            return 0.0f;
+        }
+        if (fraction <= 0.0)
+        {
+            return m_minimum;
+        }
+        if (fraction >= 1.0)
+        {
+            return m_maximum;
+        }
+
+        const AZ::u64 targetRank = AZStd::max(AZ::u64(1), aznumeric_cast<AZ::u64>(ceil(fraction * m_count)));
+
+        AZ::u64 rank = 0;
+        for (size_t bucketIndex = 0; bucketIndex < m_buckets.size(); ++bucketIndex)
+        {
+            rank += m_buckets[bucketIndex];
+            if (rank >= targetRank)
+            {
+                // The exact extremes are known, so never report a value outside them
+                return AZ::GetClamp(GetBucketValue(bucketIndex), m_minimum, m_maximum);
+            }
+        }
+
+        return m_maximum;
+    }
+} // namespace AtomSampleViewer
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AtomSampleViewer
+{
+    //! Collects the distribution of a stream of positive values, such as frame times, in constant memory.
+    //! Values are counted in a log-scale histogram (like an HDR histogram), so any quantile can be read back with a bounded
+    //! relative error no matter how many values were pushed. Count, mean, standard deviation, minimum and maximum are exact.
+    //!
+    //! A value is counted as a spike when it is more than spikeFactor times the recent average, which is an exponential
+    //! moving average over roughly the last SpikeAverageWindow values.
+    class StreamingStatistics
+    {
+    public:
+        static constexpr float DefaultMinValue = 1.0e-6f;
+        static constexpr float DefaultMaxValue = 1.0e7f;
+        static constexpr float DefaultRelativePrecision = 0.01f;
+        static constexpr float DefaultSpikeFactor = 2.0f;
+        static constexpr AZ::u64 SpikeAverageWindow = 30;
+
+        //! @param minValue values at or below this land in the first bucket
+        //! @param maxValue values at or above this land in the last bucket
+        //! @param relativePrecision the maximum relative error of GetQuantile() for values in [minValue, maxValue]
+        //! @param spikeFactor how many times the recent average a value has to be to count as a spike
+        StreamingStatistics(
+            float minValue = DefaultMinValue,
+            float maxValue = DefaultMaxValue,
+            float relativePrecision = DefaultRelativePrecision,
+            float spikeFactor = DefaultSpikeFactor);
+
+        void PushValue(float value);
+        void Reset();
+
+        AZ::u64 GetCount() const { return m_count; }
+        double GetMean() const { return m_mean; }
+        double GetStandardDeviation() const;
+        float GetMinimum() const { return m_count > 0 ? m_minimum : 0.0f; }
+        float GetMaximum() const { return m_count > 0 ? m_maximum : 0.0f; }
+        AZ::u64 GetSpikeCount() const { return m_spikeCount; }
+
+        //! Returns the smallest value that at least the given fraction of pushed values are at or below, e.g. 0.99 for p99.
+        //! 0 and 1 return the exact minimum and maximum.
+        float GetQuantile(double fraction) const;
+
+    private:
+        size_t GetBucketIndex(float value) const;
+        float GetBucketValue(size_t bucketIndex) const;
+
+        AZStd::vector<AZ::u64> m_buckets;
+        double m_logMinValue = 0.0;
+        double m_logBucketWidth = 0.0;
+        float m_spikeFactor = DefaultSpikeFactor;
+
+        AZ::u64 m_count = 0;
+        double m_mean = 0.0;
+        double m_sumSquaredDeviations = 0.0; //!< Welford's running M2, for a variance that stays accurate over long runs
+        float m_minimum = 0.0f;
+        float m_maximum = 0.0f;
+
+        double m_recentAverage = 0.0;
+        AZ::u64 m_spikeCount = 0;
+    };
+} // namespace AtomSampleViewer
@@ -32,6 +32,10 @@
 #include <AzCore/PlatformIncl.h>
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/IO/Path/Path.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
 
 #include <Automation/ScriptRepeaterBus.h>
 
@@ -246,6 +250,25 @@ namespace AtomSampleViewer
             return resolvedPath;
         }
 
+        bool IsHeadless()
+        {
+            // Neither the command line nor the RHI changes after startup
+            static const bool isHeadless = []()
+            {
+                const AzFramework::CommandLine* commandLine = nullptr;
+                AzFramework::ApplicationRequests::Bus::BroadcastResult(commandLine, &AzFramework::ApplicationRequests::GetCommandLine);
+                if (commandLine && commandLine->HasSwitch(HeadlessSwitch))
+                {
+                    return true;
+                }
+
+                auto rpiSystem = AZ::RPI::RPISystemInterface::Get();
+                return rpiSystem && rpiSystem->GetRenderApiName() == AZ::Name("null");
+            }();
+
+            return isHeadless;
+        }
+
         bool IsFileUnderFolder(AZStd::string filePath, AZStd::string folder)
         {
             AzFramework::StringFunc::Path::Normalize(filePath);
@@ -316,5 +339,36 @@ namespace AtomSampleViewer
             return false;
         }
 
+        void ParallelForChunks(size_t count, size_t minChunkSize, const AZStd::function<void(size_t begin, size_t end)>& chunkFunction)
+        {
+            AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+            const size_t workerCount = jobContext ? jobContext->GetJobManager().GetNumWorkerThreads() : 0;
+            minChunkSize = AZStd::max<size_t>(minChunkSize, 1);
+
+            if (workerCount <= 1 || count < minChunkSize * 2)
+            {
+                if (count > 0)
+                {
+                    chunkFunction(0, count);
+                }
+                return;
+            }
+
+            const size_t chunkSize = AZStd::max(minChunkSize, (count + workerCount - 1) / workerCount);
+
+            AZ::JobCompletion jobCompletion;
+            for (size_t begin = 0; begin < count; begin += chunkSize)
+            {
+                const size_t end = AZStd::min(begin + chunkSize, count);
+                AZ::Job* job = AZ::CreateJobFunction([&chunkFunction, begin, end]()
+                    {
+                        chunkFunction(begin, end);
+                    }, true, jobContext);
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
+            jobCompletion.StartAndWaitForCompletion();
+        }
+
     } // namespace Utils
 } // namespace AtomSampleViewer
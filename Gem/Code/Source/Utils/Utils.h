@@ -7,6 +7,7 @@
  */
 #pragma once
 
+#include <AzCore/std/functional.h>
 #include <AzFramework/Windowing/WindowBus.h>
 
 #include <Atom/RHI/Device.h>
@@ -58,6 +59,13 @@ namespace AtomSampleViewer
             AZ::Data::Asset<AZ::RPI::StreamingImageAsset> m_specularImageAsset;
         };
 
+        //! Command line switch that runs AtomSampleViewer on the null RHI, for CPU-side test runs on machines without a GPU
+        static constexpr const char* HeadlessSwitch = "headless";
+
+        //! Returns true when nothing is rendered, either because of --headless or because the null RHI was selected directly.
+        //! Samples, scripted ImGui and CPU profiling still run, but screenshots and GPU captures are skipped.
+        bool IsHeadless();
+
         bool SupportsResizeClientArea();
         void ResizeClientArea(uint32_t width, uint32_t height, const AzFramework::WindowPosOptions& options);
 
@@ -82,5 +90,10 @@ namespace AtomSampleViewer
         //! Returns true if the file resides within a folder
         bool IsFileUnderFolder(AZStd::string filePath, AZStd::string folder);
 
+        //! Splits [0, count) into contiguous chunks and calls chunkFunction(begin, end) for each one across the global job context,
+        //! returning once all chunks are done. Chunks are never smaller than minChunkSize, and everything runs on the calling thread
+        //! when there are no worker threads or only one chunk would be made.
+        void ParallelForChunks(size_t count, size_t minChunkSize, const AZStd::function<void(size_t begin, size_t end)>& chunkFunction);
+
     } // namespace Utils
 } // namespace AtomSampleViewer
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <Automation/BaselineImageCache.h>
+
+namespace UnitTest
+{
+    using namespace AtomSampleViewer;
+
+    namespace
+    {
+        static constexpr uint64_t ModificationTime = 1700000000;
+        static constexpr uint64_t FileSize = 12345;
+
+        BaselineImageCache::Image BuildImage()
+        {
+            BaselineImageCache::Image image;
+            image.m_width = 3;
+            image.m_height = 2;
+            image.m_buffer.resize(image.m_width * image.m_height * 4, 0x7f);
+            return image;
+        }
+
+        // Sends the header through a byte buffer, the same way it is written to and read back from the sidecar file
+        BaselineImageCache::SidecarHeader RoundTrip(const BaselineImageCache::SidecarHeader& header)
+        {
+            uint8_t bytes[sizeof(BaselineImageCache::SidecarHeader)];
+            memcpy(bytes, &header, sizeof(bytes));
+
+            BaselineImageCache::SidecarHeader loaded;
+            memcpy(&loaded, bytes, sizeof(bytes));
+            return loaded;
+        }
+
+        BaselineImageCache::SidecarFileInfo MakeSidecar(const char* filePath, uint64_t modificationTime, uint64_t fileSize)
+        {
+            BaselineImageCache::SidecarFileInfo sidecar;
+            sidecar.m_filePath = filePath;
+            sidecar.m_modificationTime = modificationTime;
+            sidecar.m_fileSize = fileSize;
+            return sidecar;
+        }
+    } // namespace
+
+    TEST(BaselineImageCacheTest, SidecarHeaderRoundTrip)
+    {
+        const BaselineImageCache::SidecarHeader loaded = RoundTrip(BaselineImageCache::MakeSidecarHeader(BuildImage(), ModificationTime, FileSize));
+
+        EXPECT_EQ(0, memcmp(loaded.m_magic, BaselineImageCache::SidecarMagic, sizeof(BaselineImageCache::SidecarMagic)));
+        EXPECT_EQ(BaselineImageCache::SidecarVersion, loaded.m_version);
+        EXPECT_EQ(3u, loaded.m_width);
+        EXPECT_EQ(2u, loaded.m_height);
+        EXPECT_EQ(0u, loaded.m_reserved);
+        EXPECT_EQ(ModificationTime, loaded.m_modificationTime);
+        EXPECT_EQ(FileSize, loaded.m_fileSize);
+        EXPECT_TRUE(BaselineImageCache::IsSidecarHeaderValid(loaded, ModificationTime, FileSize));
+    }
+
+    TEST(BaselineImageCacheTest, SidecarIsInvalidatedWhenBaselineChanges)
+    {
+        const BaselineImageCache::SidecarHeader header = RoundTrip(BaselineImageCache::MakeSidecarHeader(BuildImage(), ModificationTime, FileSize));
+
+        EXPECT_FALSE(BaselineImageCache::IsSidecarHeaderValid(header, ModificationTime + 1, FileSize));
+        EXPECT_FALSE(BaselineImageCache::IsSidecarHeaderValid(header, ModificationTime, FileSize + 1));
+    }
+
+    TEST(BaselineImageCacheTest, SidecarFromOtherVersionIsInvalid)
+    {
+        BaselineImageCache::SidecarHeader header = BaselineImageCache::MakeSidecarHeader(BuildImage(), ModificationTime, FileSize);
+        header.m_version = BaselineImageCache::SidecarVersion + 1;
+        EXPECT_FALSE(BaselineImageCache::IsSidecarHeaderValid(header, ModificationTime, FileSize));
+
+        header = BaselineImageCache::MakeSidecarHeader(BuildImage(), ModificationTime, FileSize);
+        header.m_magic[0] = 'X';
+        EXPECT_FALSE(BaselineImageCache::IsSidecarHeaderValid(header, ModificationTime, FileSize));
+    }
+
+    TEST(BaselineImageCacheTest, EvictsOldestSidecarsOverBudget)
+    {
+        AZStd::vector<BaselineImageCache::SidecarFileInfo> sidecars;
+        sidecars.push_back(MakeSidecar("c.raw", 30, 100));
+        sidecars.push_back(MakeSidecar("a.raw", 10, 100));
+        sidecars.push_back(MakeSidecar("d.raw", 40, 100));
+        sidecars.push_back(MakeSidecar("b.raw", 10, 100));
+
+        EXPECT_TRUE(BaselineImageCache::GetSidecarsToEvict(sidecars, 400).empty());
+
+        const AZStd::vector<AZStd::string> evicted = BaselineImageCache::GetSidecarsToEvict(sidecars, 250);
+        ASSERT_EQ(2u, evicted.size());
+        EXPECT_EQ("a.raw", evicted[0]);
+        EXPECT_EQ("b.raw", evicted[1]);
+
+        EXPECT_EQ(4u, BaselineImageCache::GetSidecarsToEvict(sidecars, 0).size());
+    }
+} // namespace UnitTest
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <Utils/FrameTimeStabilityWindow.h>
+
+namespace UnitTest
+{
+    using namespace AtomSampleViewer;
+
+    TEST(FrameTimeStabilityWindowTest, NotStableUntilTheWindowIsFull)
+    {
+        FrameTimeStabilityWindow window;
+        window.Reset(4, 0.05f);
+        EXPECT_FALSE(window.IsStable());
+
+        for (int i = 0; i < 3; ++i)
+        {
+            window.PushFrameTime(0.016f);
+            EXPECT_FALSE(window.IsStable());
+        }
+
+        window.PushFrameTime(0.016f);
+        EXPECT_TRUE(window.IsStable());
+        EXPECT_FLOAT_EQ(0.016f, window.GetMean());
+    }
+
+    TEST(FrameTimeStabilityWindowTest, HitchesFallOutOfTheWindow)
+    {
+        FrameTimeStabilityWindow window;
+        window.Reset(3, 0.1f);
+
+        window.PushFrameTime(0.2f);
+        window.PushFrameTime(0.016f);
+        window.PushFrameTime(0.017f);
+        EXPECT_FALSE(window.IsStable());
+        EXPECT_GT(window.GetMaxDeviation(), 0.1f);
+
+        window.PushFrameTime(0.016f);
+        EXPECT_TRUE(window.IsStable());
+        EXPECT_LE(window.GetMaxDeviation(), 0.1f);
+    }
+
+    TEST(FrameTimeStabilityWindowTest, ResetClearsHistory)
+    {
+        FrameTimeStabilityWindow window;
+        window.Reset(2, 0.0f);
+        window.PushFrameTime(0.016f);
+        window.PushFrameTime(0.016f);
+        EXPECT_TRUE(window.IsStable());
+
+        window.Reset(2, 0.0f);
+        EXPECT_FALSE(window.IsStable());
+        EXPECT_EQ(0.0f, window.GetMean());
+    }
+} // namespace UnitTest
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/deque.h>
+#include <Utils/ImGuiHistogramQueue.h>
+
+namespace UnitTest
+{
+    using namespace AtomSampleViewer;
+
+    TEST(ImGuiHistogramQueueTest, MatchesBruteForceStatistics)
+    {
+        const AZStd::size_t maxSamples = 37;
+        ImGuiHistogramQueue queue(maxSamples, maxSamples / 2, 0.0f);
+
+        AZ::SimpleLcgRandom random(1234);
+        AZStd::deque<float> expected; // newest first
+
+        for (int i = 0; i < 500; ++i)
+        {
+            const float value = random.GetRandomFloat() * 100.0f;
+            queue.PushValue(value);
+
+            expected.push_front(value);
+            if (expected.size() > maxSamples)
+            {
+                expected.pop_back();
+            }
+
+            ASSERT_EQ(expected.size(), queue.GetSampleCount());
+
+            double sum = 0.0;
+            float minValue = expected.front();
+            float maxValue = expected.front();
+            for (AZStd::size_t age = 0; age < expected.size(); ++age)
+            {
+                EXPECT_EQ(expected[age], queue.GetValue(age));
+                sum += expected[age];
+                minValue = AZStd::min(minValue, expected[age]);
+                maxValue = AZStd::max(maxValue, expected[age]);
+            }
+
+            EXPECT_NEAR(sum / expected.size(), queue.GetDisplayedAverage(), 1.0e-3);
+            EXPECT_EQ(minValue, queue.GetDisplayedMinimum());
+            EXPECT_EQ(maxValue, queue.GetDisplayedMaximum());
+        }
+    }
+
+    // Pushes 1M values into a 1M sample queue, like SampleComponentManager does with the largest -timingSamples,
+    // and checks the cost of a push doesn't grow as the queue fills up.
+    TEST(ImGuiHistogramQueueTest, Benchmark_PushCostStaysFlat)
+    {
+        const AZStd::size_t sampleCount = 1000000;
+        const AZStd::size_t blockSize = sampleCount / 10;
+        ImGuiHistogramQueue queue(sampleCount, sampleCount, 250.0f);
+
+        AZStd::vector<double> nanosecondsPerPush;
+        for (AZStd::size_t block = 0; block < sampleCount / blockSize; ++block)
+        {
+            const auto start = AZStd::chrono::steady_clock::now();
+            for (AZStd::size_t i = 0; i < blockSize; ++i)
+            {
+                queue.PushValue(static_cast<float>(i % 97));
+            }
+            const auto end = AZStd::chrono::steady_clock::now();
+
+            const double elapsed = static_cast<double>(AZStd::chrono::duration_cast<AZStd::chrono::nanoseconds>(end - start).count());
+            nanosecondsPerPush.push_back(elapsed / blockSize);
+        }
+
+        EXPECT_EQ(sampleCount, queue.GetSampleCount());
+
+        // The old implementation shifted the whole vector on every push, so the last block cost thousands of times the
+        // first one. A generous margin keeps this stable on noisy build machines.
+        const double firstBlock = nanosecondsPerPush.front();
+        const double lastBlock = nanosecondsPerPush.back();
+        EXPECT_LT(lastBlock, firstBlock * 4.0 + 50.0)
+            << "first block " << firstBlock << " ns/push, last block " << lastBlock << " ns/push";
+    }
+} // namespace UnitTest
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/containers/vector.h>
+#include <Automation/ImageDiff.h>
+
+namespace UnitTest
+{
+    using namespace AtomSampleViewer;
+
+    namespace
+    {
+        //! Builds an image pair where roughly half the pixels are identical, and the rest differ by small and large amounts,
+        //! so every branch of the threshold is exercised including the values right at MinHighlightedDifference.
+        void BuildImagePair(size_t pixelCount, AZStd::vector<uint8_t>& imageA, AZStd::vector<uint8_t>& imageB)
+        {
+            AZ::SimpleLcgRandom random(pixelCount);
+            imageA.resize(pixelCount * ImageDiff::BytesPerPixel);
+            imageB.resize(pixelCount * ImageDiff::BytesPerPixel);
+
+            for (size_t i = 0; i < imageA.size(); ++i)
+            {
+                const uint8_t value = static_cast<uint8_t>(random.GetRandom());
+                imageA[i] = value;
+
+                switch (random.GetRandom() % 6)
+                {
+                case 0:
+                    imageB[i] = static_cast<uint8_t>(random.GetRandom());
+                    break;
+                case 1:
+                    imageB[i] = static_cast<uint8_t>(value + ImageDiff::MinHighlightedDifference - 1);
+                    break;
+                case 2:
+                    imageB[i] = static_cast<uint8_t>(value - ImageDiff::MinHighlightedDifference);
+                    break;
+                default:
+                    imageB[i] = value;
+                    break;
+                }
+            }
+        }
+    }
+
+    TEST(ImageDiffTest, VectorizedMatchesScalar)
+    {
+        // Odd sizes make sure the scalar tail after the last full SIMD block is covered
+        for (size_t pixelCount : { 0, 1, 3, 4, 5, 17, 63, 64, 1031 })
+        {
+            AZStd::vector<uint8_t> imageA;
+            AZStd::vector<uint8_t> imageB;
+            BuildImagePair(pixelCount, imageA, imageB);
+
+            AZStd::vector<uint8_t> expected(imageA.size());
+            AZStd::vector<uint8_t> actual(imageA.size());
+            ImageDiff::GenerateImageDiffScalar(imageA, imageB, expected);
+            ImageDiff::GenerateImageDiffVectorized(imageA, imageB, actual);
+
+            EXPECT_EQ(expected, actual) << "pixelCount=" << pixelCount;
+        }
+    }
+
+    TEST(ImageDiffTest, RowBandsMatchInline)
+    {
+        // Tall enough to be split across four workers, with trailing bytes that don't make a whole row
+        const size_t width = 257;
+        const size_t height = ImageDiff::MinRowsPerJob * 4 + 3;
+        const size_t bytesPerRow = width * ImageDiff::BytesPerPixel;
+        const size_t trailingPixels = 5;
+
+        AZStd::vector<uint8_t> imageA;
+        AZStd::vector<uint8_t> imageB;
+        BuildImagePair(width * height + trailingPixels, imageA, imageB);
+
+        const AZStd::vector<ImageDiff::RowBand> bands = ImageDiff::GetRowBands(imageA.size(), bytesPerRow, 4);
+        ASSERT_EQ(4u, bands.size());
+
+        size_t nextOffset = 0;
+        for (size_t i = 0; i < bands.size(); ++i)
+        {
+            EXPECT_EQ(nextOffset, bands[i].m_offset) << "band=" << i;
+            EXPECT_EQ(0u, bands[i].m_offset % bytesPerRow) << "band=" << i;
+            EXPECT_GE(bands[i].m_size / bytesPerRow, ImageDiff::MinRowsPerJob) << "band=" << i;
+            nextOffset += bands[i].m_size;
+        }
+        EXPECT_EQ(imageA.size(), nextOffset);
+
+        AZStd::vector<uint8_t> expected(imageA.size());
+        AZStd::vector<uint8_t> banded(imageA.size());
+        AZStd::vector<uint8_t> actual(imageA.size());
+        ImageDiff::GenerateImageDiffVectorized(imageA, imageB, expected);
+        for (const ImageDiff::RowBand& band : bands)
+        {
+            ImageDiff::GenerateImageDiffVectorized(
+                AZStd::span<const uint8_t>(imageA).subspan(band.m_offset, band.m_size),
+                AZStd::span<const uint8_t>(imageB).subspan(band.m_offset, band.m_size),
+                AZStd::span<uint8_t>(banded).subspan(band.m_offset, band.m_size));
+        }
+        ImageDiff::GenerateImageDiff(imageA, imageB, actual, bytesPerRow);
+
+        EXPECT_EQ(expected, banded);
+        EXPECT_EQ(expected, actual);
+    }
+
+    TEST(ImageDiffTest, SmallImagesAreNotBanded)
+    {
+        const size_t bytesPerRow = 64 * ImageDiff::BytesPerPixel;
+        const size_t imageSize = (ImageDiff::MinRowsPerJob * 2 - 1) * bytesPerRow;
+
+        EXPECT_EQ(1u, ImageDiff::GetRowBands(imageSize, bytesPerRow, 8).size());
+        EXPECT_EQ(1u, ImageDiff::GetRowBands(imageSize * 4, bytesPerRow, 1).size());
+        EXPECT_EQ(imageSize, ImageDiff::GetRowBands(imageSize, bytesPerRow, 8)[0].m_size);
+    }
+
+    TEST(ImageDiffTest, ThresholdMatchesLegacyFilter)
+    {
+        // ScriptReporter used to highlight a pixel when maxChannelDiff / 255.0f > 0.01f
+        for (uint32_t diff = 0; diff < 256; ++diff)
+        {
+            const uint8_t imageA[ImageDiff::BytesPerPixel] = { 0, 0, 0, 255 };
+            const uint8_t imageB[ImageDiff::BytesPerPixel] = { 0, static_cast<uint8_t>(diff), 0, 255 };
+            uint8_t output[ImageDiff::BytesPerPixel] = {};
+
+            ImageDiff::GenerateImageDiffScalar(imageA, imageB, output);
+
+            const bool highlighted = diff / 255.0f > 0.01f;
+            EXPECT_EQ(highlighted ? diff : ImageDiff::DefaultPixelValue, output[0]) << "diff=" << diff;
+        }
+    }
+} // namespace UnitTest
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/containers/vector.h>
+#include <Atom/Utils/ImageComparison.h>
+#include <Automation/ImageSignature.h>
+
+namespace UnitTest
+{
+    using namespace AtomSampleViewer;
+
+    namespace
+    {
+        // Not a multiple of TileSize in either direction, so the partial tiles on the right and bottom edges are covered
+        static constexpr uint32_t Width = ImageSignature::TileSize * 3 + 17;
+        static constexpr uint32_t Height = ImageSignature::TileSize * 2 + 5;
+
+        AZStd::vector<uint8_t> BuildImage(uint32_t seed)
+        {
+            AZ::SimpleLcgRandom random(seed);
+            AZStd::vector<uint8_t> image(size_t(Width) * Height * ImageSignature::BytesPerPixel);
+            for (uint8_t& value : image)
+            {
+                value = static_cast<uint8_t>(random.GetRandom());
+            }
+            return image;
+        }
+
+        void SetPixel(AZStd::vector<uint8_t>& image, uint32_t x, uint32_t y, uint8_t value)
+        {
+            image[(size_t(y) * Width + x) * ImageSignature::BytesPerPixel] = value;
+        }
+    }
+
+    TEST(ImageSignatureTest, IdenticalImagesHaveIdenticalSignatures)
+    {
+        const AZStd::vector<uint8_t> image = BuildImage(1);
+        const ImageSignature signatureA = ImageSignature::Compute(image, Width, Height);
+        const ImageSignature signatureB = ImageSignature::Compute(image, Width, Height);
+
+        EXPECT_EQ(size_t(4 * 3), signatureA.m_tileHashes.size());
+        EXPECT_TRUE(signatureA.IsComparableTo(signatureB));
+        EXPECT_EQ(signatureA.m_contentHash, signatureB.m_contentHash);
+        EXPECT_EQ(signatureA.m_tileHashes, signatureB.m_tileHashes);
+        EXPECT_EQ(0.0f, ImageSignature::CalcDiffRmsOfMismatchedTiles(signatureA, image, signatureB, image));
+    }
+
+    TEST(ImageSignatureTest, ChangedPixelOnlyChangesItsTile)
+    {
+        const AZStd::vector<uint8_t> image = BuildImage(2);
+        const ImageSignature original = ImageSignature::Compute(image, Width, Height);
+
+        // The last pixel lands in the partial bottom right tile
+        const AZStd::pair<uint32_t, uint32_t> changedPixels[] = { { 0, 0 }, { 70, 10 }, { Width - 1, Height - 1 } };
+        for (const auto& [x, y] : changedPixels)
+        {
+            AZStd::vector<uint8_t> changed = image;
+            SetPixel(changed, x, y, static_cast<uint8_t>(changed[(size_t(y) * Width + x) * ImageSignature::BytesPerPixel] + 1));
+            const ImageSignature signature = ImageSignature::Compute(changed, Width, Height);
+
+            EXPECT_NE(original.m_contentHash, signature.m_contentHash);
+
+            const size_t changedTile = size_t(y / ImageSignature::TileSize) * original.GetTileCountX() + x / ImageSignature::TileSize;
+            for (size_t i = 0; i < original.m_tileHashes.size(); ++i)
+            {
+                EXPECT_EQ(i != changedTile, original.m_tileHashes[i] == signature.m_tileHashes[i]) << "tile=" << i << " x=" << x << " y=" << y;
+            }
+        }
+    }
+
+    TEST(ImageSignatureTest, MismatchedTileRmsMatchesFullRms)
+    {
+        const AZStd::vector<uint8_t> imageA = BuildImage(3);
+        AZStd::vector<uint8_t> imageB = imageA;
+
+        // Change a handful of pixels spread over a few tiles
+        AZ::SimpleLcgRandom random(4);
+        for (int i = 0; i < 50; ++i)
+        {
+            SetPixel(imageB, random.GetRandom() % Width, random.GetRandom() % (ImageSignature::TileSize + 1), static_cast<uint8_t>(random.GetRandom()));
+        }
+
+        const ImageSignature signatureA = ImageSignature::Compute(imageA, Width, Height);
+        const ImageSignature signatureB = ImageSignature::Compute(imageB, Width, Height);
+
+        const AZ::RHI::Size size(Width, Height, 1);
+        const AZ::Utils::ImageDiffResult expected = AZ::Utils::CalcImageDiffRms(
+            imageA, size, AZ::RHI::Format::R8G8B8A8_UNORM, imageB, size, AZ::RHI::Format::R8G8B8A8_UNORM);
+
+        EXPECT_GT(expected.m_diffScore, 0.0f);
+        EXPECT_NEAR(expected.m_diffScore, ImageSignature::CalcDiffRmsOfMismatchedTiles(signatureA, imageA, signatureB, imageB), 1e-5f);
+    }
+} // namespace UnitTest
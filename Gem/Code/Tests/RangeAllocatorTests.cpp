@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/containers/vector.h>
+#include <Utils/RangeAllocator.h>
+
+namespace UnitTest
+{
+    using namespace AtomSampleViewer;
+
+    TEST(RangeAllocatorTest, AllocatesConsecutiveRanges)
+    {
+        RangeAllocator allocator(100);
+
+        EXPECT_EQ(0u, allocator.Allocate(16));
+        EXPECT_EQ(16u, allocator.Allocate(3));
+        EXPECT_EQ(19u, allocator.Allocate(81));
+        EXPECT_EQ(RangeAllocator::InvalidOffset, allocator.Allocate(1));
+
+        EXPECT_EQ(100u, allocator.GetAllocatedCount());
+        EXPECT_EQ(3u, allocator.GetAllocationCount());
+        EXPECT_EQ(0u, allocator.GetFreeBlockCount());
+        EXPECT_EQ(3u, allocator.GetAllocationSize(16));
+        EXPECT_EQ(0u, allocator.GetAllocationSize(17));
+    }
+
+    TEST(RangeAllocatorTest, ZeroSizeAllocationFails)
+    {
+        RangeAllocator allocator(100);
+        EXPECT_EQ(RangeAllocator::InvalidOffset, allocator.Allocate(0));
+        EXPECT_EQ(0u, allocator.GetAllocationCount());
+    }
+
+    TEST(RangeAllocatorTest, FreedRangeIsReused)
+    {
+        RangeAllocator allocator(64);
+
+        const uint32_t first = allocator.Allocate(16);
+        const uint32_t second = allocator.Allocate(16);
+        allocator.Allocate(16);
+
+        allocator.Free(second);
+        EXPECT_EQ(2u, allocator.GetFreeBlockCount());
+        EXPECT_EQ(16u, allocator.GetLargestFreeBlock());
+
+        // First fit takes the hole left by the freed range before the space at the end
+        EXPECT_EQ(second, allocator.Allocate(8));
+        EXPECT_EQ(second + 8, allocator.Allocate(8));
+        EXPECT_EQ(48u, allocator.Allocate(16));
+        EXPECT_EQ(RangeAllocator::InvalidOffset, allocator.Allocate(1));
+
+        allocator.Free(first);
+        EXPECT_EQ(first, allocator.Allocate(16));
+    }
+
+    TEST(RangeAllocatorTest, DeferredFreeIsReusedAfterFrameDelay)
+    {
+        RangeAllocator allocator(32);
+
+        const uint32_t first = allocator.Allocate(16);
+        allocator.Allocate(16);
+
+        allocator.FreeAfterFrames(first, 3);
+        EXPECT_EQ(1u, allocator.GetPendingFreeCount());
+
+        // The range stays allocated until the last frame that may use it is done
+        allocator.NextFrame();
+        allocator.NextFrame();
+        EXPECT_EQ(32u, allocator.GetAllocatedCount());
+        EXPECT_EQ(RangeAllocator::InvalidOffset, allocator.Allocate(16));
+
+        allocator.NextFrame();
+        EXPECT_EQ(0u, allocator.GetPendingFreeCount());
+        EXPECT_EQ(16u, allocator.GetAllocatedCount());
+        EXPECT_EQ(first, allocator.Allocate(16));
+    }
+
+    TEST(RangeAllocatorTest, DeferredFreesWithDifferentDelays)
+    {
+        RangeAllocator allocator(30);
+
+        const uint32_t a = allocator.Allocate(10);
+        const uint32_t b = allocator.Allocate(10);
+        const uint32_t c = allocator.Allocate(10);
+
+        allocator.FreeAfterFrames(a, 2);
+        allocator.FreeAfterFrames(b, 1);
+        allocator.FreeAfterFrames(c, 0);
+        EXPECT_EQ(20u, allocator.GetAllocatedCount());
+
+        allocator.NextFrame();
+        EXPECT_EQ(10u, allocator.GetAllocatedCount());
+        EXPECT_EQ(1u, allocator.GetPendingFreeCount());
+
+        allocator.NextFrame();
+        EXPECT_EQ(0u, allocator.GetAllocatedCount());
+        EXPECT_EQ(30u, allocator.GetLargestFreeBlock());
+    }
+
+    TEST(RangeAllocatorTest, FreeMergesWithNeighbours)
+    {
+        RangeAllocator allocator(40);
+
+        const uint32_t a = allocator.Allocate(10);
+        const uint32_t b = allocator.Allocate(10);
+        const uint32_t c = allocator.Allocate(10);
+        const uint32_t d = allocator.Allocate(10);
+
+        allocator.Free(a);
+        allocator.Free(c);
+        EXPECT_EQ(2u, allocator.GetFreeBlockCount());
+
+        // b touches the free blocks on both sides
+        allocator.Free(b);
+        EXPECT_EQ(1u, allocator.GetFreeBlockCount());
+        EXPECT_EQ(30u, allocator.GetLargestFreeBlock());
+
+        allocator.Free(d);
+        EXPECT_EQ(1u, allocator.GetFreeBlockCount());
+        EXPECT_EQ(40u, allocator.GetLargestFreeBlock());
+        EXPECT_EQ(0u, allocator.GetAllocatedCount());
+    }
+
+    TEST(RangeAllocatorTest, RandomAllocationsNeverOverlapAndFreeingAllRestoresCapacity)
+    {
+        constexpr uint32_t Capacity = 4096;
+        RangeAllocator allocator(Capacity);
+
+        AZ::SimpleLcgRandom random(1234);
+        AZStd::vector<uint32_t> offsets;
+        AZStd::vector<int> owner(Capacity, -1);
+
+        for (int step = 0; step < 5000; ++step)
+        {
+            if (offsets.empty() || random.GetRandom() % 3 != 0)
+            {
+                const uint32_t count = 1 + random.GetRandom() % 32;
+                const uint32_t offset = allocator.Allocate(count);
+                if (offset == RangeAllocator::InvalidOffset)
+                {
+                    EXPECT_LT(allocator.GetLargestFreeBlock(), count);
+                    continue;
+                }
+
+                ASSERT_LE(offset + count, Capacity);
+                for (uint32_t i = offset; i < offset + count; ++i)
+                {
+                    ASSERT_EQ(-1, owner[i]);
+                    owner[i] = step;
+                }
+                offsets.push_back(offset);
+            }
+            else
+            {
+                const size_t index = random.GetRandom() % offsets.size();
+                const uint32_t offset = offsets[index];
+                const uint32_t count = allocator.GetAllocationSize(offset);
+                for (uint32_t i = offset; i < offset + count; ++i)
+                {
+                    owner[i] = -1;
+                }
+                allocator.Free(offset);
+                offsets[index] = offsets.back();
+                offsets.pop_back();
+            }
+        }
+
+        for (uint32_t offset : offsets)
+        {
+            allocator.Free(offset);
+        }
+
+        EXPECT_EQ(0u, allocator.GetAllocatedCount());
+        EXPECT_EQ(1u, allocator.GetFreeBlockCount());
+        EXPECT_EQ(Capacity, allocator.GetLargestFreeBlock());
+    }
+
+    TEST(DirtyRangeListTest, ConsecutiveWritesBecomeOneRange)
+    {
+        DirtyRangeList ranges;
+        for (uint32_t i = 0; i < 1000; ++i)
+        {
+            ranges.Add(i * 16, 16);
+        }
+
+        ASSERT_EQ(1u, ranges.GetRanges().size());
+        EXPECT_EQ(0u, ranges.GetRanges()[0].m_offset);
+        EXPECT_EQ(16000u, ranges.GetRanges()[0].m_count);
+    }
+
+    TEST(DirtyRangeListTest, CoalesceSortsAndMergesOverlappingRanges)
+    {
+        DirtyRangeList ranges;
+        ranges.Add(100, 10);
+        ranges.Add(0, 10);
+        ranges.Add(105, 10);
+        ranges.Add(10, 5);
+        ranges.Add(50, 1);
+
+        const auto& coalesced = ranges.Coalesce();
+        ASSERT_EQ(3u, coalesced.size());
+        EXPECT_EQ(0u, coalesced[0].m_offset);
+        EXPECT_EQ(15u, coalesced[0].m_count);
+        EXPECT_EQ(50u, coalesced[1].m_offset);
+        EXPECT_EQ(1u, coalesced[1].m_count);
+        EXPECT_EQ(100u, coalesced[2].m_offset);
+        EXPECT_EQ(15u, coalesced[2].m_count);
+    }
+
+    TEST(DirtyRangeListTest, CoalesceMergesRangesWithinMergeDistance)
+    {
+        DirtyRangeList ranges;
+        ranges.Add(0, 4);
+        ranges.Add(8, 4);
+        ranges.Add(40, 4);
+
+        const auto& coalesced = ranges.Coalesce(4);
+        ASSERT_EQ(2u, coalesced.size());
+        EXPECT_EQ(0u, coalesced[0].m_offset);
+        EXPECT_EQ(12u, coalesced[0].m_count);
+        EXPECT_EQ(40u, coalesced[1].m_offset);
+
+        ranges.Clear();
+        EXPECT_TRUE(ranges.IsEmpty());
+    }
+} // namespace UnitTest
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <Utils/SampleAssetPrefetcher.h>
+
+namespace UnitTest
+{
+    using namespace AtomSampleViewer;
+
+    class SampleAssetPrefetcherTest
+        : public ::testing::Test
+    {
+    protected:
+        SampleAssetPrefetcher CreatePrefetcher()
+        {
+            // Assets get an id made from their path, without loading anything. Paths starting with "missing" don't exist.
+            return SampleAssetPrefetcher([](const AZ::AssetCollectionAsyncLoader::AssetToLoadInfo& assetInfo)
+                {
+                    if (assetInfo.m_assetPath.starts_with("missing"))
+                    {
+                        return AZ::Data::Asset<AZ::Data::AssetData>();
+                    }
+                    return AZ::Data::Asset<AZ::Data::AssetData>(AZ::Data::AssetId(AZ::Uuid::CreateName(assetInfo.m_assetPath.c_str())), assetInfo.m_assetType);
+                });
+        }
+
+        static SampleAssetPrefetcher::AssetList CreateAssetList(AZStd::initializer_list<const char*> assetPaths)
+        {
+            SampleAssetPrefetcher::AssetList assetList;
+            for (const char* assetPath : assetPaths)
+            {
+                AZ::AssetCollectionAsyncLoader::AssetToLoadInfo& assetInfo = assetList.emplace_back();
+                assetInfo.m_assetPath = assetPath;
+                assetInfo.m_assetType = AZ::Uuid::CreateName("TestAssetType");
+            }
+            return assetList;
+        }
+    };
+
+    TEST_F(SampleAssetPrefetcherTest, ManifestJsonRoundTrip)
+    {
+        SampleAssetPrefetcher prefetcher = CreatePrefetcher();
+        prefetcher.RecordSampleAssets("RPI/Decals", CreateAssetList({ "materials/decal/a.azmaterial", "textures/decal.png.streamingimage" }));
+        prefetcher.RecordSampleAssets("RPI/Shadow", CreateAssetList({ "objects/shaderball.azmodel" }));
+        EXPECT_TRUE(prefetcher.IsManifestDirty());
+
+        rapidjson::Document document;
+        prefetcher.WriteManifestJson(document);
+
+        SampleAssetPrefetcher loaded = CreatePrefetcher();
+        loaded.ReadManifestJson(document);
+        EXPECT_FALSE(loaded.IsManifestDirty());
+        EXPECT_EQ(nullptr, loaded.GetSampleAssets("RPI/Unknown"));
+
+        const SampleAssetPrefetcher::AssetList* decalsAssets = loaded.GetSampleAssets("RPI/Decals");
+        ASSERT_NE(nullptr, decalsAssets);
+        ASSERT_EQ(2u, decalsAssets->size());
+        EXPECT_EQ("materials/decal/a.azmaterial", (*decalsAssets)[0].m_assetPath);
+        EXPECT_EQ("textures/decal.png.streamingimage", (*decalsAssets)[1].m_assetPath);
+        EXPECT_EQ(AZ::Uuid::CreateName("TestAssetType"), (*decalsAssets)[1].m_assetType);
+
+        const SampleAssetPrefetcher::AssetList* shadowAssets = loaded.GetSampleAssets("RPI/Shadow");
+        ASSERT_NE(nullptr, shadowAssets);
+        EXPECT_EQ(1u, shadowAssets->size());
+
+        // Recording the same list again doesn't need a save
+        loaded.RecordSampleAssets("RPI/Shadow", CreateAssetList({ "objects/shaderball.azmodel" }));
+        EXPECT_FALSE(loaded.IsManifestDirty());
+        loaded.RecordSampleAssets("RPI/Shadow", CreateAssetList({ "objects/cube.azmodel" }));
+        EXPECT_TRUE(loaded.IsManifestDirty());
+    }
+
+    TEST_F(SampleAssetPrefetcherTest, MalformedManifestEntriesAreSkipped)
+    {
+        rapidjson::Document document;
+        document.Parse(R"({
+            "RPI/Decals": [ { "path": "materials/decal/a.azmaterial", "type": "{6E7D9B2C-6A5B-4A3F-9C6B-0E1B2F3A4D5C}" }, { "path": 3 }, "b" ],
+            "RPI/Shadow": { "path": "objects/shaderball.azmodel" } })");
+        ASSERT_FALSE(document.HasParseError());
+
+        SampleAssetPrefetcher prefetcher = CreatePrefetcher();
+        prefetcher.ReadManifestJson(document);
+
+        const SampleAssetPrefetcher::AssetList* decalsAssets = prefetcher.GetSampleAssets("RPI/Decals");
+        ASSERT_NE(nullptr, decalsAssets);
+        EXPECT_EQ(1u, decalsAssets->size());
+        EXPECT_EQ(nullptr, prefetcher.GetSampleAssets("RPI/Shadow"));
+    }
+
+    TEST_F(SampleAssetPrefetcherTest, PrefetchNeedsRecordedAssets)
+    {
+        SampleAssetPrefetcher prefetcher = CreatePrefetcher();
+        EXPECT_FALSE(prefetcher.Prefetch("RPI/Decals"));
+
+        prefetcher.RecordSampleAssets("RPI/Decals", CreateAssetList({ "materials/decal/a.azmaterial", "missing/decal.azmaterial" }));
+        EXPECT_TRUE(prefetcher.Prefetch("RPI/Decals"));
+        EXPECT_EQ(1u, prefetcher.GetPrefetchedAssetCount("RPI/Decals"));
+    }
+
+    TEST_F(SampleAssetPrefetcherTest, ActivatedSampleEvictsOtherPrefetches)
+    {
+        SampleAssetPrefetcher prefetcher = CreatePrefetcher();
+        prefetcher.RecordSampleAssets("A", CreateAssetList({ "a.azmodel" }));
+        prefetcher.RecordSampleAssets("B", CreateAssetList({ "b.azmodel" }));
+        prefetcher.RecordSampleAssets("C", CreateAssetList({ "c.azmodel" }));
+
+        prefetcher.Prefetch("A");
+        prefetcher.OnSampleActivated("A");
+        EXPECT_EQ(1u, prefetcher.GetPrefetchedAssetCount("A"));
+
+        // While A runs, B is prefetched; both are held
+        prefetcher.Prefetch("B");
+        prefetcher.OnSampleActivated("A");
+        EXPECT_EQ(1u, prefetcher.GetPrefetchedAssetCount("A"));
+        EXPECT_EQ(1u, prefetcher.GetPrefetchedAssetCount("B"));
+
+        // Once B opens, A is released, and so is a prefetch of C that was superseded by one of B
+        prefetcher.Prefetch("C");
+        prefetcher.Prefetch("B");
+        prefetcher.OnSampleActivated("B");
+        EXPECT_EQ(0u, prefetcher.GetPrefetchedAssetCount("A"));
+        EXPECT_EQ(1u, prefetcher.GetPrefetchedAssetCount("B"));
+        EXPECT_EQ(0u, prefetcher.GetPrefetchedAssetCount("C"));
+    }
+
+    TEST_F(SampleAssetPrefetcherTest, DeactivateReleasesPrefetchedAssets)
+    {
+        SampleAssetPrefetcher prefetcher = CreatePrefetcher();
+        prefetcher.RecordSampleAssets("A", CreateAssetList({ "a.azmodel" }));
+        prefetcher.Prefetch("A");
+        EXPECT_EQ(1u, prefetcher.GetPrefetchedAssetCount("A"));
+
+        // Clear the manifest so Deactivate() has nothing to save
+        prefetcher.ReadManifestJson(rapidjson::Value());
+        prefetcher.Deactivate();
+        EXPECT_EQ(0u, prefetcher.GetPrefetchedAssetCount("A"));
+    }
+} // namespace UnitTest
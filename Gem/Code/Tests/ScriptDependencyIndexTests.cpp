@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <Automation/ScriptDependencyIndex.h>
+
+namespace UnitTest
+{
+    using namespace AtomSampleViewer;
+
+    class ScriptDependencyIndexTest
+        : public ::testing::Test
+    {
+    protected:
+        ScriptDependencyIndex CreateIndex()
+        {
+            return ScriptDependencyIndex(
+                [this](const AZStd::string& productPath) -> AZ::u64
+                {
+                    auto iter = m_modificationTimes.find(productPath);
+                    return iter != m_modificationTimes.end() ? iter->second : 0;
+                },
+                [this]()
+                {
+                    return m_sharedProducts;
+                });
+        }
+
+        void RecordDecalsRun(ScriptDependencyIndex& index)
+        {
+            index.BeginScript("scripts/decals.bv.luac");
+            index.RecordScriptSample("scripts/decals.bv.luac", "Features/Decals");
+            index.RecordSampleAssets("Features/Decals", { "materials/decal/a.azmaterial", "materials/decal/b.azmaterial" });
+        }
+
+        AZStd::unordered_map<AZStd::string, AZ::u64> m_modificationTimes =
+        {
+            { "scripts/decals.bv.luac", 100 },
+            { "materials/decal/a.azmaterial", 200 },
+            { "materials/decal/b.azmaterial", 300 },
+            { "shaders/decal.azshader", 400 },
+            { "passes/forward.pass", 500 },
+        };
+
+        AZStd::vector<AZStd::string> m_sharedProducts = { "shaders/decal.azshader", "passes/forward.pass" };
+    };
+
+    TEST_F(ScriptDependencyIndexTest, UnknownScriptsAndSamplesAreAffected)
+    {
+        ScriptDependencyIndex index = CreateIndex();
+        EXPECT_TRUE(index.IsScriptAffected("scripts/decals.bv.luac"));
+        EXPECT_TRUE(index.IsSampleAffected("Features/Decals"));
+        EXPECT_FALSE(index.HasRecordedChanges());
+    }
+
+    TEST_F(ScriptDependencyIndexTest, UnchangedProductsAreNotAffected)
+    {
+        ScriptDependencyIndex index = CreateIndex();
+        RecordDecalsRun(index);
+
+        EXPECT_TRUE(index.HasRecordedChanges());
+        EXPECT_FALSE(index.IsScriptAffected("scripts/decals.bv.luac"));
+        EXPECT_FALSE(index.IsSampleAffected("Features/Decals"));
+    }
+
+    TEST_F(ScriptDependencyIndexTest, ChangedOrMissingProductsAffectTheirScripts)
+    {
+        ScriptDependencyIndex index = CreateIndex();
+        RecordDecalsRun(index);
+
+        m_modificationTimes["materials/decal/b.azmaterial"] = 301;
+        EXPECT_TRUE(index.IsSampleAffected("Features/Decals"));
+        EXPECT_TRUE(index.IsScriptAffected("scripts/decals.bv.luac"));
+
+        m_modificationTimes["materials/decal/b.azmaterial"] = 300;
+        m_modificationTimes.erase("materials/decal/a.azmaterial");
+        EXPECT_TRUE(index.IsScriptAffected("scripts/decals.bv.luac"));
+
+        m_modificationTimes["materials/decal/a.azmaterial"] = 200;
+        m_modificationTimes["scripts/decals.bv.luac"] = 101;
+        EXPECT_TRUE(index.IsScriptAffected("scripts/decals.bv.luac"));
+        EXPECT_FALSE(index.IsSampleAffected("Features/Decals"));
+    }
+
+    TEST_F(ScriptDependencyIndexTest, ScriptWithUnreportedSampleIsAffected)
+    {
+        ScriptDependencyIndex index = CreateIndex();
+        index.BeginScript("scripts/decals.bv.luac");
+        index.RecordScriptSample("scripts/decals.bv.luac", "Features/Decals");
+
+        EXPECT_TRUE(index.IsScriptAffected("scripts/decals.bv.luac"));
+    }
+
+    TEST_F(ScriptDependencyIndexTest, BeginScriptReplacesPreviousSamples)
+    {
+        ScriptDependencyIndex index = CreateIndex();
+        RecordDecalsRun(index);
+
+        // The script no longer opens a sample that was never reported, so it's no longer affected by it
+        index.BeginScript("scripts/decals.bv.luac");
+        index.RecordScriptSample("scripts/decals.bv.luac", "Features/Unreported");
+        EXPECT_TRUE(index.IsScriptAffected("scripts/decals.bv.luac"));
+
+        index.BeginScript("scripts/decals.bv.luac");
+        index.RecordScriptSample("scripts/decals.bv.luac", "Features/Decals");
+        EXPECT_FALSE(index.IsScriptAffected("scripts/decals.bv.luac"));
+    }
+
+    TEST_F(ScriptDependencyIndexTest, ForgottenScriptIsAffected)
+    {
+        ScriptDependencyIndex index = CreateIndex();
+        RecordDecalsRun(index);
+        index.ForgetScript("scripts/decals.bv.luac");
+
+        EXPECT_TRUE(index.IsScriptAffected("scripts/decals.bv.luac"));
+        EXPECT_FALSE(index.IsSampleAffected("Features/Decals"));
+
+        rapidjson::Document document;
+        index.WriteJson(document);
+        EXPECT_FALSE(document["scripts"].HasMember("scripts/decals.bv.luac"));
+    }
+
+    TEST_F(ScriptDependencyIndexTest, JsonRoundTrip)
+    {
+        ScriptDependencyIndex index = CreateIndex();
+        RecordDecalsRun(index);
+
+        rapidjson::Document document;
+        index.WriteJson(document);
+
+        ScriptDependencyIndex loaded = CreateIndex();
+        loaded.ReadJson(document);
+        EXPECT_FALSE(loaded.HasRecordedChanges());
+        EXPECT_FALSE(loaded.IsScriptAffected("scripts/decals.bv.luac"));
+        EXPECT_FALSE(loaded.IsSampleAffected("Features/Decals"));
+
+        m_modificationTimes["materials/decal/a.azmaterial"] = 201;
+        EXPECT_TRUE(loaded.IsScriptAffected("scripts/decals.bv.luac"));
+    }
+
+    TEST_F(ScriptDependencyIndexTest, MalformedJsonIsIgnored)
+    {
+        rapidjson::Document document;
+        document.Parse(R"({ "scripts": { "scripts/decals.bv.luac": { "samples": [] } }, "samples": [ 1, 2 ] })");
+        ASSERT_FALSE(document.HasParseError());
+
+        ScriptDependencyIndex index = CreateIndex();
+        index.ReadJson(document);
+        EXPECT_TRUE(index.IsScriptAffected("scripts/decals.bv.luac"));
+        EXPECT_TRUE(index.IsSampleAffected("Features/Decals"));
+    }
+
+    TEST_F(ScriptDependencyIndexTest, ChangedSharedProductsAffectEveryScript)
+    {
+        ScriptDependencyIndex index = CreateIndex();
+        RecordDecalsRun(index);
+
+        rapidjson::Document document;
+        index.WriteJson(document);
+
+        // The shared products are only checked once per index, so each change is checked by a new run loading the index
+        auto isAffectedInNextRun = [this, &document]()
+        {
+            ScriptDependencyIndex nextRun = CreateIndex();
+            nextRun.ReadJson(document);
+            const bool isScriptAffected = nextRun.IsScriptAffected("scripts/decals.bv.luac");
+            EXPECT_EQ(isScriptAffected, nextRun.IsSampleAffected("Features/Decals"));
+            return isScriptAffected;
+        };
+
+        EXPECT_FALSE(isAffectedInNextRun());
+
+        m_modificationTimes["shaders/decal.azshader"] = 401;
+        EXPECT_TRUE(isAffectedInNextRun());
+        m_modificationTimes["shaders/decal.azshader"] = 400;
+
+        m_sharedProducts.push_back("shaders/new.azshader");
+        m_modificationTimes["shaders/new.azshader"] = 600;
+        EXPECT_TRUE(isAffectedInNextRun());
+        m_sharedProducts.pop_back();
+
+        // The catalog order doesn't matter
+        AZStd::swap(m_sharedProducts[0], m_sharedProducts[1]);
+        EXPECT_FALSE(isAffectedInNextRun());
+    }
+
+    TEST_F(ScriptDependencyIndexTest, EntriesWithoutSharedProductsAreAffected)
+    {
+        // An index written before shared products were recorded
+        rapidjson::Document document;
+        document.Parse(R"({
+            "scripts": { "scripts/decals.bv.luac": { "modificationTime": 100, "samples": [ "Features/Decals" ] } },
+            "samples": { "Features/Decals": { "materials/decal/a.azmaterial": 200 } } })");
+        ASSERT_FALSE(document.HasParseError());
+
+        ScriptDependencyIndex index = CreateIndex();
+        index.ReadJson(document);
+        EXPECT_TRUE(index.IsScriptAffected("scripts/decals.bv.luac"));
+        EXPECT_TRUE(index.IsSampleAffected("Features/Decals"));
+    }
+
+    TEST_F(ScriptDependencyIndexTest, ShadersAndPassesAreSharedProducts)
+    {
+        EXPECT_TRUE(ScriptDependencyIndex::IsSharedProduct("shaders/decal.azshader"));
+        EXPECT_TRUE(ScriptDependencyIndex::IsSharedProduct("passes/forward.pass"));
+        EXPECT_FALSE(ScriptDependencyIndex::IsSharedProduct("shaders/decal.azshadervariant"));
+        EXPECT_FALSE(ScriptDependencyIndex::IsSharedProduct("materials/decal/a.azmaterial"));
+    }
+} // namespace UnitTest
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <Automation/ScriptOperationTrace.h>
+
+namespace UnitTest
+{
+    using namespace AtomSampleViewer;
+
+    TEST(ScriptOperationTraceTest, NothingIsRecordedOutsideBeginEnd)
+    {
+        ScriptOperationTrace trace;
+        EXPECT_EQ(ScriptOperationTrace::InvalidIndex, trace.RecordEnqueue(nullptr));
+
+        trace.Begin();
+        EXPECT_EQ(0u, trace.RecordEnqueue(nullptr));
+        trace.End();
+
+        EXPECT_EQ(ScriptOperationTrace::InvalidIndex, trace.RecordEnqueue(nullptr));
+        EXPECT_EQ(1u, trace.GetOperations().size());
+    }
+
+    TEST(ScriptOperationTraceTest, WaitsAreAttributedToTheLastCompletedOperation)
+    {
+        using WaitReason = ScriptOperationTrace::WaitReason;
+
+        ScriptOperationTrace trace;
+        trace.Begin();
+
+        const uint32_t first = trace.RecordEnqueue(nullptr);
+        const uint32_t second = trace.RecordEnqueue(nullptr);
+
+        // Waiting before anything ran has nothing to blame
+        trace.RecordWait(WaitReason::ScriptBoundary);
+
+        trace.RecordDispatch(first);
+        trace.RecordComplete(first);
+        trace.RecordWait(WaitReason::IdleFrames);
+        trace.RecordWait(WaitReason::IdleFrames);
+        trace.RecordWait(WaitReason::Capture);
+
+        trace.RecordDispatch(second);
+        trace.RecordComplete(second);
+        trace.End();
+
+        const auto& operations = trace.GetOperations();
+        ASSERT_EQ(2u, operations.size());
+
+        EXPECT_EQ(2u, operations[first].m_waitFrames[static_cast<size_t>(WaitReason::IdleFrames)]);
+        EXPECT_EQ(1u, operations[first].m_waitFrames[static_cast<size_t>(WaitReason::Capture)]);
+        EXPECT_EQ(0u, operations[first].m_waitFrames[static_cast<size_t>(WaitReason::ScriptBoundary)]);
+        for (uint32_t frames : operations[second].m_waitFrames)
+        {
+            EXPECT_EQ(0u, frames);
+        }
+
+        // Each operation holds up the queue until the next one is dispatched, and the last one until the trace ends
+        EXPECT_EQ(operations[second].m_dispatchTime, operations[first].m_endTime);
+        EXPECT_LE(operations[first].m_enqueueTime, operations[first].m_dispatchTime);
+        EXPECT_LE(operations[first].m_dispatchTime, operations[first].m_completeTime);
+        EXPECT_LE(operations[second].m_completeTime, operations[second].m_endTime);
+
+        // Operations queued from C++ have no Lua caller
+        EXPECT_EQ(-1, operations[first].m_line);
+        EXPECT_EQ("Native", trace.GetStrings()[operations[first].m_kindIndex]);
+    }
+
+    TEST(ScriptOperationTraceTest, ScriptSpansNestAndCloseAtEnd)
+    {
+        ScriptOperationTrace trace;
+        trace.Begin();
+        trace.BeginScript("scripts/suite.bv.luac");
+        trace.BeginScript("scripts/child.bv.luac");
+        trace.EndScript();
+        trace.BeginScript("scripts/aborted.bv.luac");
+        trace.End();
+
+        const auto& spans = trace.GetScriptSpans();
+        ASSERT_EQ(3u, spans.size());
+        EXPECT_EQ("scripts/suite.bv.luac", trace.GetStrings()[spans[0].m_nameIndex]);
+        EXPECT_EQ(0u, spans[0].m_depth);
+        EXPECT_EQ(1u, spans[1].m_depth);
+        EXPECT_EQ(1u, spans[2].m_depth);
+
+        for (const auto& span : spans)
+        {
+            EXPECT_LE(span.m_beginTime, span.m_endTime);
+        }
+        EXPECT_LE(spans[2].m_endTime, spans[0].m_endTime);
+    }
+} // namespace UnitTest
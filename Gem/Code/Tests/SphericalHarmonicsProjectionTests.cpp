@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/containers/vector.h>
+#include <Utils/SphericalHarmonicsProjection.h>
+
+namespace UnitTest
+{
+    using namespace AtomSampleViewer;
+    using namespace AtomSampleViewer::SphericalHarmonicsProjection;
+
+    namespace
+    {
+        // A function with known coefficients: a combination of the basis functions themselves
+        Coefficients GetTestCoefficients()
+        {
+            Coefficients coefficients;
+            for (uint32_t k = 0; k < CoefficientCount; ++k)
+            {
+                coefficients[k] = 1.0f - 0.125f * k;
+            }
+            return coefficients;
+        }
+
+        float EvaluateCombination(const Coefficients& coefficients, const float direction[3])
+        {
+            float basis[CoefficientCount];
+            EvaluateBasis(direction, basis);
+
+            float value = 0.0f;
+            for (uint32_t k = 0; k < CoefficientCount; ++k)
+            {
+                value += coefficients[k] * basis[k];
+            }
+            return value;
+        }
+
+        float GetMaxError(const Coefficients& actual, const Coefficients& expected)
+        {
+            float maxError = 0.0f;
+            for (uint32_t k = 0; k < CoefficientCount; ++k)
+            {
+                maxError = AZStd::max(maxError, fabsf(actual[k] - expected[k]));
+            }
+            return maxError;
+        }
+
+        Coefficients ProjectCombination(const Coefficients& coefficients, uint32_t sampleCount)
+        {
+            return ProjectFunction(
+                [&coefficients](const float* x, const float* y, const float* z, float* radiance, size_t count)
+                {
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        const float direction[3] = { x[i], y[i], z[i] };
+                        radiance[i] = EvaluateCombination(coefficients, direction);
+                    }
+                },
+                sampleCount);
+        }
+    } // namespace
+
+    TEST(SphericalHarmonicsProjectionTest, BatchedKernelMatchesScalarBasis)
+    {
+        // 11 samples, so both the 4-wide loop and the scalar tail are covered
+        constexpr size_t Count = 11;
+        float x[Count], y[Count], z[Count], weights[Count];
+        Coefficients expected = {};
+        for (size_t i = 0; i < Count; ++i)
+        {
+            float direction[3];
+            GetHammersleyDirection(static_cast<uint32_t>(i), Count, direction);
+            x[i] = direction[0];
+            y[i] = direction[1];
+            z[i] = direction[2];
+            weights[i] = 0.5f + i;
+
+            float basis[CoefficientCount];
+            EvaluateBasis(direction, basis);
+            for (uint32_t k = 0; k < CoefficientCount; ++k)
+            {
+                expected[k] += basis[k] * weights[i];
+            }
+        }
+
+        const Coefficients actual = ProjectSamples(x, y, z, weights, Count);
+        EXPECT_LT(GetMaxError(actual, expected), 1.0e-4f);
+    }
+
+    TEST(SphericalHarmonicsProjectionTest, ConstantFunctionProjectsOntoBandZero)
+    {
+        const Coefficients actual = ProjectFunction(
+            [](const float*, const float*, const float*, float* radiance, size_t count)
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    radiance[i] = 1.0f;
+                }
+            },
+            10000);
+
+        // The integral of the constant band 0 basis function over the sphere is 4 pi * 1/2 sqrt(1/pi) = 2 sqrt(pi)
+        Coefficients expected = {};
+        expected[0] = 2.0f * sqrtf(AZ::Constants::Pi);
+        EXPECT_LT(GetMaxError(actual, expected), 1.0e-3f);
+    }
+
+    TEST(SphericalHarmonicsProjectionTest, LinearFunctionProjectsOntoBandOne)
+    {
+        const Coefficients actual = ProjectFunction(
+            [](const float*, const float*, const float* z, float* radiance, size_t count)
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    radiance[i] = z[i];
+                }
+            },
+            10000);
+
+        // z = sqrt(4pi/3) * Y(1, 0)
+        Coefficients expected = {};
+        expected[2] = sqrtf(4.0f * AZ::Constants::Pi / 3.0f);
+        EXPECT_LT(GetMaxError(actual, expected), 1.0e-3f);
+    }
+
+    TEST(SphericalHarmonicsProjectionTest, ProjectionConvergesToKnownCoefficients)
+    {
+        const Coefficients expected = GetTestCoefficients();
+
+        const float coarseError = GetMaxError(ProjectCombination(expected, 1000), expected);
+        const float fineError = GetMaxError(ProjectCombination(expected, 100000), expected);
+
+        // The basis is orthonormal, so projecting a combination of it gives back its coefficients. Sample counts that
+        // aren't a multiple of the block size cover partial blocks.
+        EXPECT_LT(fineError, 1.0e-3f);
+        EXPECT_LT(fineError, coarseError);
+    }
+
+    TEST(SphericalHarmonicsProjectionTest, CubemapSolidAnglesCoverTheSphere)
+    {
+        constexpr uint32_t FaceSize = 16;
+        double totalSolidAngle = 0.0;
+        for (uint32_t texelY = 0; texelY < FaceSize; ++texelY)
+        {
+            for (uint32_t texelX = 0; texelX < FaceSize; ++texelX)
+            {
+                totalSolidAngle += 6.0 * GetCubemapTexelSolidAngle(texelX, texelY, FaceSize);
+            }
+        }
+        EXPECT_NEAR(4.0 * AZ::Constants::Pi, totalSolidAngle, 1.0e-4);
+    }
+
+    TEST(SphericalHarmonicsProjectionTest, CubemapProjectionConvergesToKnownCoefficients)
+    {
+        constexpr uint32_t FaceSize = 64;
+        constexpr uint32_t ChannelCount = 2;
+
+        // Channel 0 is the test combination, channel 1 a constant
+        const Coefficients expected = GetTestCoefficients();
+        AZStd::vector<float> faceData[6];
+        AZStd::array<const float*, 6> faces;
+        for (uint32_t face = 0; face < 6; ++face)
+        {
+            faceData[face].resize(FaceSize * FaceSize * ChannelCount);
+            for (uint32_t texelY = 0; texelY < FaceSize; ++texelY)
+            {
+                for (uint32_t texelX = 0; texelX < FaceSize; ++texelX)
+                {
+                    float direction[3];
+                    GetCubemapTexelDirection(face, texelX, texelY, FaceSize, direction);
+
+                    const size_t texel = (texelY * FaceSize + texelX) * ChannelCount;
+                    faceData[face][texel] = EvaluateCombination(expected, direction);
+                    faceData[face][texel + 1] = 1.0f;
+                }
+            }
+            faces[face] = faceData[face].data();
+        }
+
+        const AZStd::vector<Coefficients> actual = ProjectCubemap(faces, FaceSize, ChannelCount);
+        ASSERT_EQ(ChannelCount, actual.size());
+
+        EXPECT_LT(GetMaxError(actual[0], expected), 1.0e-2f);
+
+        Coefficients expectedConstant = {};
+        expectedConstant[0] = 2.0f * sqrtf(AZ::Constants::Pi);
+        EXPECT_LT(GetMaxError(actual[1], expectedConstant), 1.0e-3f);
+    }
+
+    TEST(SphericalHarmonicsProjectionTest, CubemapFacesPointAlongTheirAxes)
+    {
+        const float expected[6][3] = { { 1, 0, 0 }, { -1, 0, 0 }, { 0, 1, 0 }, { 0, -1, 0 }, { 0, 0, 1 }, { 0, 0, -1 } };
+        for (uint32_t face = 0; face < 6; ++face)
+        {
+            // The center of a face with an odd size is the center of its middle texel
+            float direction[3];
+            GetCubemapTexelDirection(face, 1, 1, 3, direction);
+            EXPECT_NEAR(expected[face][0], direction[0], 1.0e-6f);
+            EXPECT_NEAR(expected[face][1], direction[1], 1.0e-6f);
+            EXPECT_NEAR(expected[face][2], direction[2], 1.0e-6f);
+        }
+    }
+} // namespace UnitTest
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/sort.h>
+#include <Utils/StreamingStatistics.h>
+
+namespace UnitTest
+{
+    using namespace AtomSampleViewer;
+
+    TEST(StreamingStatisticsTest, EmptyStatisticsReportZero)
+    {
+        StreamingStatistics statistics;
+        EXPECT_EQ(0u, statistics.GetCount());
+        EXPECT_EQ(0.0f, statistics.GetQuantile(0.5));
+        EXPECT_EQ(0.0, statistics.GetStandardDeviation());
+        EXPECT_EQ(0u, statistics.GetSpikeCount());
+    }
+
+    TEST(StreamingStatisticsTest, QuantilesMatchSortedValuesWithinPrecision)
+    {
+        StreamingStatistics statistics;
+
+        AZ::SimpleLcgRandom random(1234);
+        AZStd::vector<float> values;
+        double sum = 0.0;
+        for (int i = 0; i < 10000; ++i)
+        {
+            // Mostly 16ms frames with a long tail
+            const float value = 12.0f + random.GetRandomFloat() * 8.0f + (i % 97 == 0 ? 50.0f * random.GetRandomFloat() : 0.0f);
+            values.push_back(value);
+            statistics.PushValue(value);
+            sum += value;
+        }
+
+        AZStd::sort(values.begin(), values.end());
+
+        EXPECT_EQ(values.size(), statistics.GetCount());
+        EXPECT_EQ(values.front(), statistics.GetMinimum());
+        EXPECT_EQ(values.back(), statistics.GetMaximum());
+        EXPECT_EQ(values.front(), statistics.GetQuantile(0.0));
+        EXPECT_EQ(values.back(), statistics.GetQuantile(1.0));
+        EXPECT_NEAR(sum / values.size(), statistics.GetMean(), 1e-6);
+
+        double sumSquaredDeviations = 0.0;
+        for (float value : values)
+        {
+            sumSquaredDeviations += (value - statistics.GetMean()) * (value - statistics.GetMean());
+        }
+        EXPECT_NEAR(sqrt(sumSquaredDeviations / values.size()), statistics.GetStandardDeviation(), 1e-6);
+
+        for (double fraction : { 0.5, 0.9, 0.99, 0.999 })
+        {
+            const size_t rank = static_cast<size_t>(ceil(fraction * values.size()));
+            const float expected = values[rank - 1];
+            EXPECT_NEAR(expected, statistics.GetQuantile(fraction), expected * StreamingStatistics::DefaultRelativePrecision * 1.01f)
+                << "fraction=" << fraction;
+        }
+    }
+
+    TEST(StreamingStatisticsTest, CountsSpikesAgainstRecentAverage)
+    {
+        StreamingStatistics statistics;
+
+        for (AZ::u64 i = 0; i < StreamingStatistics::SpikeAverageWindow; ++i)
+        {
+            statistics.PushValue(16.0f);
+        }
+        EXPECT_EQ(0u, statistics.GetSpikeCount());
+
+        statistics.PushValue(40.0f);
+        EXPECT_EQ(1u, statistics.GetSpikeCount());
+
+        statistics.PushValue(20.0f);
+        EXPECT_EQ(1u, statistics.GetSpikeCount());
+
+        statistics.Reset();
+        EXPECT_EQ(0u, statistics.GetCount());
+        EXPECT_EQ(0u, statistics.GetSpikeCount());
+    }
+} // namespace UnitTest
@@ -8,4 +8,15 @@
 
 set(FILES
     Tests/AtomSampleViewerGemTests.cpp
+    Tests/BaselineImageCacheTests.cpp
+    Tests/FrameTimeStabilityWindowTests.cpp
+    Tests/ImGuiHistogramQueueTests.cpp
+    Tests/ImageDiffTests.cpp
+    Tests/ImageSignatureTests.cpp
+    Tests/RangeAllocatorTests.cpp
+    Tests/SampleAssetPrefetcherTests.cpp
+    Tests/ScriptDependencyIndexTests.cpp
+    Tests/ScriptOperationTraceTests.cpp
+    Tests/SphericalHarmonicsProjectionTests.cpp
+    Tests/StreamingStatisticsTests.cpp
 )
@@ -20,17 +20,31 @@ set(FILES
     Source/SampleComponentConfig.h
     Source/Automation/AssetStatusTracker.cpp
     Source/Automation/AssetStatusTracker.h
+    Source/Automation/BaselineImageCache.cpp
+    Source/Automation/BaselineImageCache.h
     Source/Automation/ImageComparisonConfig.h
     Source/Automation/ImageComparisonConfig.cpp
+    Source/Automation/ImageDiff.cpp
+    Source/Automation/ImageDiff.h
+    Source/Automation/ImageSignature.cpp
+    Source/Automation/ImageSignature.h
     Source/Automation/PrecommitWizardSettings.h
+    Source/Automation/ProfilingCaptureRecorder.cpp
+    Source/Automation/ProfilingCaptureRecorder.h
+    Source/Automation/ScriptDependencyIndex.cpp
+    Source/Automation/ScriptDependencyIndex.h
     Source/Automation/ScriptableImGui.cpp
     Source/Automation/ScriptableImGui.h
     Source/Automation/ScriptManager.cpp
     Source/Automation/ScriptManager.h
+    Source/Automation/ScriptOperationTrace.cpp
+    Source/Automation/ScriptOperationTrace.h
     Source/Automation/ScriptRepeaterBus.h
     Source/Automation/ScriptRunnerBus.h
     Source/Automation/ScriptReporter.cpp
     Source/Automation/ScriptReporter.h
+    Source/Automation/TestResultsStream.cpp
+    Source/Automation/TestResultsStream.h
     Source/RHI/AlphaToCoverageExampleComponent.cpp
     Source/RHI/AlphaToCoverageExampleComponent.h
     Source/RHI/AsyncComputeExampleComponent.h
@@ -184,6 +198,8 @@ set(FILES
     Source/TransparencyExampleComponent.h
     Source/ShaderReloadTestComponent.cpp
     Source/ShaderReloadTestComponent.h
+    Source/Utils/FrameTimeStabilityWindow.cpp
+    Source/Utils/FrameTimeStabilityWindow.h
     Source/Utils/ImGuiAssetBrowser.cpp
     Source/Utils/ImGuiAssetBrowser.h
     Source/Utils/ImGuiHistogramQueue.cpp
@@ -194,6 +210,14 @@ set(FILES
     Source/Utils/ImGuiSaveFilePath.h
     Source/Utils/ImGuiSidebar.cpp
     Source/Utils/ImGuiSidebar.h
+    Source/Utils/RangeAllocator.cpp
+    Source/Utils/RangeAllocator.h
+    Source/Utils/SampleAssetPrefetcher.cpp
+    Source/Utils/SampleAssetPrefetcher.h
+    Source/Utils/SphericalHarmonicsProjection.cpp
+    Source/Utils/SphericalHarmonicsProjection.h
+    Source/Utils/StreamingStatistics.cpp
+    Source/Utils/StreamingStatistics.h
     Source/Utils/Utils.cpp
     Source/Utils/Utils.h
     Source/Utils/ImGuiProgressList.cpp
@@ -0,0 +1,14 @@
+{
+    "Source": "IndirectInstanceUpdate.azsl",
+
+    "ProgramSettings":
+    {
+      "EntryPoints":
+      [
+        {
+          "name": "MainCS",
+          "type": "Compute"
+        }
+      ]
+    }
+}
@@ -9,6 +9,7 @@
 #include <AtomSampleViewerApplication.h>
 #include <SampleComponentManagerBus.h>
 
+#include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Component/ComponentApplicationLifecycle.h>
 #include <AzCore/PlatformIncl.h>
 #include <AzCore/Component/ComponentApplication.h>
@@ -41,6 +42,48 @@ namespace AtomSampleViewer
         return AZStd::string_view{ LY_CMAKE_TARGET };
     }
 
+    namespace
+    {
+        // Matches Utils::HeadlessSwitch in the gem
+        constexpr const char* HeadlessSwitch = "headless";
+
+        bool HasArgument(int argc, char** argv, AZStd::string_view name)
+        {
+            for (int i = 1; i < argc; ++i)
+            {
+                AZStd::string_view argument = argv[i];
+                const size_t nameStart = argument.find_first_not_of('-');
+                if (nameStart == 0 || nameStart == AZStd::string_view::npos)
+                {
+                    continue;
+                }
+
+                argument.remove_prefix(nameStart);
+                if (argument.starts_with(name) && (argument.size() == name.size() || argument[name.size()] == '='))
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        //! --headless runs on the null RHI, unless an RHI was chosen explicitly with --rhi.
+        //! The RHI is selected while the application starts, before the gem can read the command line, so the switch is expanded here.
+        AZStd::vector<char*> ExpandHeadlessArguments(int argc, char** argv)
+        {
+            static char nullRhiArgument[] = "--rhi=null";
+
+            AZStd::vector<char*> arguments(argv, argv + argc);
+            if (HasArgument(argc, argv, HeadlessSwitch) && !HasArgument(argc, argv, "rhi"))
+            {
+                arguments.push_back(nullRhiArgument);
+            }
+            arguments.push_back(nullptr);
+            return arguments;
+        }
+    }
+
     AtomSampleViewerApplication::AtomSampleViewerApplication()
     {
         AZ::Debug::Trace::Instance().Init();
@@ -105,8 +148,8 @@ namespace AtomSampleViewer
     {
         ReadAutomatedTestOptions();
 
-        // enable native UI for some error messages if it's not test mode
-        if (!m_isTestMode)
+        // enable native UI for some error messages if it's not test mode. Headless runs have nobody to click through them.
+        if (!m_isTestMode && !m_commandLine.HasSwitch(HeadlessSwitch))
         {
             if (auto nativeUI = AZ::Interface<AZ::NativeUI::NativeUIRequests>::Get(); nativeUI != nullptr)
             {
@@ -167,6 +210,7 @@ namespace AtomSampleViewer
             constexpr const char* testSuiteSwitch = "runtestsuite";
             constexpr const char* testExitSwitch = "exitontestend";
             constexpr const char* testRandomSeed = "randomtestseed";
+            constexpr const char* testShard = "shard";
 
             bool exitOnTestEnd = commandLine.HasSwitch(testExitSwitch);
 
@@ -180,7 +224,21 @@ namespace AtomSampleViewer
                     randomSeed = atoi(commandLine.GetSwitchValue(testRandomSeed, 0).c_str());
                 }
 
-                SampleComponentManagerRequestBus::Broadcast(&SampleComponentManagerRequestBus::Events::RunMainTestSuite, testSuitePath, exitOnTestEnd, randomSeed);
+                // --shard=i/N runs the i-th of N parts of the suite, counting from 0
+                int shardIndex = 0;
+                int shardCount = 1;
+                if (commandLine.HasSwitch(testShard))
+                {
+                    const AZStd::string& shardValue = commandLine.GetSwitchValue(testShard, 0);
+                    if (sscanf(shardValue.c_str(), "%d/%d", &shardIndex, &shardCount) != 2 || shardCount < 1 || shardIndex < 0 || shardIndex >= shardCount)
+                    {
+                        AZ_Error("AtomSampleViewer", false, "Invalid --%s value '%s', expected i/N with 0 <= i < N. Running the whole suite.", testShard, shardValue.c_str());
+                        shardIndex = 0;
+                        shardCount = 1;
+                    }
+                }
+
+                SampleComponentManagerRequestBus::Broadcast(&SampleComponentManagerRequestBus::Events::RunMainTestSuite, testSuitePath, exitOnTestEnd, randomSeed, shardIndex, shardCount);
 
                 m_isTestMode = true;
             }
@@ -351,6 +409,11 @@ namespace AtomSampleViewer
     int RunGameCommon(int argc, char** argv, AZStd::function<void()> customRunCode)
     {
         const AZ::Debug::Trace tracer;
+
+        AZStd::vector<char*> arguments = ExpandHeadlessArguments(argc, argv);
+        argc = aznumeric_cast<int>(arguments.size() - 1);
+        argv = arguments.data();
+
         AtomSampleViewer::AtomSampleViewerApplication app(&argc, &argv);
 
         const AzGameFramework::GameApplication::StartupParameters gameAppParams;
@@ -4,6 +4,7 @@ For complete copyright and license terms please see the LICENSE at the root of t
 
 SPDX-License-Identifier: Apache-2.0 OR MIT
 """
+import glob
 import logging
 import os
 import subprocess
@@ -14,6 +15,8 @@ import ly_test_tools.environment.process_utils as process_utils
 import ly_test_tools.launchers.platforms.base
 from ly_test_tools.benchmark.data_aggregator import BenchmarkDataAggregator
 
+from Automated.profiling_capture_reader import ProfilingCaptureReader, write_legacy_json_files
+
 logger = logging.getLogger(__name__)
 
 
@@ -50,7 +53,23 @@ class TestPerformanceBenchmarksPeriodicSuite:
             expected_lines = ["Script: Capturing complete."]
             atomsampleviewer_log_monitor.monitor_log_for_lines(expected_lines, timeout=210)
 
-            aggregator = BenchmarkDataAggregator(workspace, logger, 'periodic')
-            aggregator.upload_metrics(rhi)
+            # The suite writes one profiling capture file per sample. BenchmarkDataAggregator still expects the
+            # per-frame json layout, so expand the captures now that the measured frames are done, and remove the
+            # expanded files again after upload so they don't end up in the test artifacts.
+            benchmarks_folder = os.path.join(workspace.paths.project(), 'user', 'scripts', 'PerformanceBenchmarks')
+            expanded_files = []
+            for capture_path in glob.glob(os.path.join(benchmarks_folder, '*', '*.asvprof')):
+                with ProfilingCaptureReader(capture_path) as reader:
+                    summary = reader.summarize()
+                logger.info(f'{capture_path}: {summary["frameCount"]} frames, '
+                            f'mean CPU frame time {summary["cpuFrameTimeMs"]["mean"]:.3f} ms')
+                expanded_files.extend(write_legacy_json_files(capture_path, os.path.dirname(capture_path)))
+
+            try:
+                aggregator = BenchmarkDataAggregator(workspace, logger, 'periodic')
+                aggregator.upload_metrics(rhi)
+            finally:
+                for expanded_file in expanded_files:
+                    os.remove(expanded_file)
         except ly_test_tools.log.log_monitor.LogMonitorException as e:
             raise AtomSampleViewerException(f'Data capturing did not complete in time for RHI {rhi}, got error: {e}')
@@ -0,0 +1,156 @@
+"""
+Copyright (c) Contributors to the Open 3D Engine Project.
+For complete copyright and license terms please see the LICENSE at the root of this distribution.
+
+SPDX-License-Identifier: Apache-2.0 OR MIT
+
+Streaming reader for the columnar profiling capture files written by the BeginProfilingCapture() script function
+(see Gem/Code/Source/Automation/ProfilingCaptureRecorder.h for the file layout).
+"""
+import json
+import os
+import struct
+
+FILE_MAGIC = b'ASVPROF\x00'
+SUPPORTED_VERSION = 1
+MISSING_TIMESTAMP = 0xFFFFFFFFFFFFFFFF
+
+_HEADER = struct.Struct('<8sIIII')
+_NAME_LENGTH = struct.Struct('<H')
+_READ_CHUNK_FRAMES = 4096
+
+
+class ProfilingCaptureFormatError(Exception):
+    """Raised when a file is not a valid profiling capture."""
+    pass
+
+
+class ProfilingCaptureReader:
+    """
+    Reads a profiling capture one column at a time, so memory use is bounded by the read chunk size rather than the
+    number of frames or passes in the capture.
+    """
+
+    def __init__(self, file_path):
+        self.file_path = file_path
+        self._file = open(file_path, 'rb')
+        try:
+            self._read_header()
+        except Exception:
+            self._file.close()
+            raise
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, exc_type, exc_value, traceback):
+        self.close()
+
+    def close(self):
+        self._file.close()
+
+    def _read_exact(self, size):
+        data = self._file.read(size)
+        if len(data) != size:
+            raise ProfilingCaptureFormatError(f'Unexpected end of file in {self.file_path}')
+        return data
+
+    def _read_header(self):
+        magic, version, self.frame_count, pass_count, _ = _HEADER.unpack(self._read_exact(_HEADER.size))
+        if magic != FILE_MAGIC:
+            raise ProfilingCaptureFormatError(f'{self.file_path} is not a profiling capture file')
+        if version != SUPPORTED_VERSION:
+            raise ProfilingCaptureFormatError(f'{self.file_path} has unsupported version {version}')
+
+        self.pass_names = []
+        for _ in range(pass_count):
+            (length,) = _NAME_LENGTH.unpack(self._read_exact(_NAME_LENGTH.size))
+            self.pass_names.append(self._read_exact(length).decode('utf-8'))
+
+        self._cpu_column_offset = self._file.tell()
+        self._pass_columns_offset = self._cpu_column_offset + self.frame_count * 8
+
+    def _iter_column(self, offset, value_format):
+        # Seek before every chunk so several column iterators can be consumed in lock step
+        remaining = self.frame_count
+        while remaining > 0:
+            count = min(remaining, _READ_CHUNK_FRAMES)
+            self._file.seek(offset)
+            values = struct.unpack(f'<{count}{value_format}', self._read_exact(count * 8))
+            offset += count * 8
+            remaining -= count
+            yield from values
+
+    def iter_cpu_frame_times_ms(self):
+        """Yields the CPU frame-to-frame time of each frame, in milliseconds."""
+        yield from self._iter_column(self._cpu_column_offset, 'd')
+
+    def iter_pass_timestamps_ns(self, pass_index):
+        """Yields the GPU duration of one pass for each frame in nanoseconds, or None for frames where it didn't run."""
+        offset = self._pass_columns_offset + pass_index * self.frame_count * 8
+        for value in self._iter_column(offset, 'Q'):
+            yield None if value == MISSING_TIMESTAMP else value
+
+    def iter_pass_columns(self):
+        """Yields (pass path name, timestamp column iterator) for every pass, in file order."""
+        for pass_index, pass_name in enumerate(self.pass_names):
+            yield pass_name, self.iter_pass_timestamps_ns(pass_index)
+
+    def summarize(self):
+        """Returns per-column statistics without holding more than one value per pass in memory."""
+        def stats(values):
+            count = 0
+            total = 0.0
+            minimum = None
+            maximum = None
+            for value in values:
+                if value is None:
+                    continue
+                count += 1
+                total += value
+                minimum = value if minimum is None else min(minimum, value)
+                maximum = value if maximum is None else max(maximum, value)
+            return {'count': count, 'mean': total / count if count else 0.0, 'min': minimum, 'max': maximum}
+
+        return {
+            'frameCount': self.frame_count,
+            'cpuFrameTimeMs': stats(self.iter_cpu_frame_times_ms()),
+            'passTimestampsNs': {name: stats(column) for name, column in self.iter_pass_columns()},
+        }
+
+
+def short_pass_name(pass_path_name):
+    """Converts a pass path name such as 'Root.MainPipeline.ForwardPass' into the pass name 'ForwardPass'."""
+    return pass_path_name.rsplit('.', 1)[-1]
+
+
+def write_legacy_json_files(capture_path, output_dir):
+    """
+    Expands a capture into the per-frame 'frameN_timestamps.json' and 'cpu_frameN_time.json' files that the old
+    per-frame CapturePassTimestamp/CaptureCpuFrameTime calls produced, for tools that still consume that layout.
+    Returns the list of written files so the caller can clean them up.
+    """
+    written_files = []
+    with ProfilingCaptureReader(capture_path) as reader:
+        for frame_number, frame_time in enumerate(reader.iter_cpu_frame_times_ms(), start=1):
+            file_path = os.path.join(output_dir, f'cpu_frame{frame_number}_time.json')
+            _write_json(file_path, 'CpuFrameTimeSerializer', {'frameTime': frame_time})
+            written_files.append(file_path)
+
+        # Walk every column in lock step so only one frame of pass timestamps is held at a time
+        pass_names = [short_pass_name(name) for name in reader.pass_names]
+        columns = [column for _, column in reader.iter_pass_columns()]
+        for frame_number, frame_values in enumerate(zip(*columns), start=1):
+            entries = [{'passName': name, 'timestampResultInNanoseconds': value}
+                       for name, value in zip(pass_names, frame_values) if value is not None]
+            file_path = os.path.join(output_dir, f'frame{frame_number}_timestamps.json')
+            _write_json(file_path, 'TimestampSerializer', {'timestampEntries': entries})
+            written_files.append(file_path)
+
+    return written_files
+
+
+def _write_json(file_path, class_name, class_data):
+    with open(file_path, 'w') as json_file:
+        json.dump({'Type': 'JsonSerialization', 'Version': 1, 'ClassName': class_name, 'ClassData': class_data},
+                  json_file, indent=4)
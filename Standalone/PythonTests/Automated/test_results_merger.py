@@ -0,0 +1,112 @@
+"""
+Copyright (c) Contributors to the Open 3D Engine Project.
+For complete copyright and license terms please see the LICENSE at the root of this distribution.
+
+SPDX-License-Identifier: Apache-2.0 OR MIT
+
+Merges the results of a test suite that was split across processes with --shard=i/N. Each shard writes
+TestResults/shard_<i>_of_<N>.json when it exits (see ScriptReporter::ExportTestResultsJson), and deletes the one of an earlier
+run when it starts, so a shard that didn't finish shows up as missing. The merge combines them into one report and refreshes
+TestResults/ScriptDurations.json, which the next sharded run uses to balance the shards.
+
+Usage: python test_results_merger.py <TestResults folder> <shard count>
+"""
+import json
+import os
+import sys
+
+MERGED_RESULTS_FILE_NAME = 'merged_test_results.json'
+SCRIPT_DURATIONS_FILE_NAME = 'ScriptDurations.json'
+
+
+class TestResultsMergeError(Exception):
+    """Raised when the shard results can't be merged."""
+    pass
+
+
+def shard_results_path(test_results_folder, shard_index, shard_count):
+    return os.path.join(test_results_folder, f'shard_{shard_index}_of_{shard_count}.json')
+
+
+def script_failed(script):
+    return script['asserts'] > 0 or script['errors'] > 0 or script['screenshotErrors'] > 0
+
+
+def merge_shard_results(test_results_folder, shard_count):
+    """
+    Reads the results of every shard and returns a dict with the combined 'scripts' list, the 'testDurations' of the tests
+    that aren't scripts of their own, and the 'missingShards' indices. A missing shard usually means that process crashed
+    before it could export its results.
+    """
+    scripts = []
+    test_durations = {}
+    missing_shards = []
+    for shard_index in range(shard_count):
+        file_path = shard_results_path(test_results_folder, shard_index, shard_count)
+        if not os.path.exists(file_path):
+            missing_shards.append(shard_index)
+            continue
+
+        with open(file_path, 'r') as results_file:
+            try:
+                results = json.load(results_file)
+            except json.JSONDecodeError as e:
+                raise TestResultsMergeError(f'Could not parse {file_path}: {e}')
+
+        for script in results.get('scripts', []):
+            script['shard'] = shard_index
+            scripts.append(script)
+
+        test_durations.update(results.get('testDurations', {}))
+
+    return {'shardCount': shard_count, 'missingShards': missing_shards, 'scripts': scripts, 'testDurations': test_durations}
+
+
+def update_script_durations(test_results_folder, merged_results):
+    """Updates the recorded duration of every script that ran, keeping the durations of scripts that didn't."""
+    file_path = os.path.join(test_results_folder, SCRIPT_DURATIONS_FILE_NAME)
+    durations = {}
+    if os.path.exists(file_path):
+        with open(file_path, 'r') as durations_file:
+            try:
+                durations = json.load(durations_file)
+            except json.JSONDecodeError:
+                durations = {}
+
+    for script in merged_results['scripts']:
+        durations[script['path']] = script['durationSeconds']
+    durations.update(merged_results['testDurations'])
+
+    with open(file_path, 'w') as durations_file:
+        json.dump(durations, durations_file, indent=4, sort_keys=True)
+
+
+def main(argv):
+    if len(argv) != 3:
+        print(__doc__)
+        return 2
+
+    test_results_folder = argv[1]
+    shard_count = int(argv[2])
+    if shard_count < 1:
+        raise TestResultsMergeError(f'Invalid shard count {shard_count}')
+
+    merged_results = merge_shard_results(test_results_folder, shard_count)
+    with open(os.path.join(test_results_folder, MERGED_RESULTS_FILE_NAME), 'w') as merged_file:
+        json.dump(merged_results, merged_file, indent=4)
+
+    update_script_durations(test_results_folder, merged_results)
+
+    failed_scripts = [script for script in merged_results['scripts'] if script_failed(script)]
+    for script in failed_scripts:
+        print(f"FAILED {script['path']} (shard {script['shard']})")
+    for shard_index in merged_results['missingShards']:
+        print(f'MISSING results for shard {shard_index} of {shard_count}')
+
+    print(f"{len(merged_results['scripts'])} scripts, {len(failed_scripts)} failed, "
+          f"{len(merged_results['missingShards'])} of {shard_count} shards missing")
+    return 1 if failed_scripts or merged_results['missingShards'] else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
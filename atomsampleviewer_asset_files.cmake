@@ -104,6 +104,8 @@ set(FILES
     Shaders/RHI/IndirectDispatch.shader
     Shaders/RHI/IndirectDraw.azsl
     Shaders/RHI/IndirectDraw.shader
+    Shaders/RHI/IndirectInstanceUpdate.azsl
+    Shaders/RHI/IndirectInstanceUpdate.shader
     Shaders/RHI/IndirectRendering.azsli
     Shaders/RHI/InputAssemblyCompute.azsl
     Shaders/RHI/InputAssemblyCompute.shader
@@ -0,0 +1,50 @@
+----------------------------------------------------------------------------------------------------
+--
+-- Copyright (c) Contributors to the Open 3D Engine Project.
+-- For complete copyright and license terms please see the LICENSE at the root of this distribution.
+--
+-- SPDX-License-Identifier: Apache-2.0 OR MIT
+--
+--
+--
+----------------------------------------------------------------------------------------------------
+
+-- Measures the upload path of the copy queue with the benchmark of RHI/CopyQueue. Each combination of upload type,
+-- payload size and uploads in flight runs for RUN_SECONDS, then its throughput, latency percentiles and overlap with
+-- rendering are written to <g_baseFolder>/<type>_<size>_<in flight>.json.
+
+g_baseFolder = ResolvePath('@user@/scripts/PerformanceBenchmarks/CopyQueueUpload/')
+UPLOAD_TYPES = { 'Buffers', 'Images', 'Mixed' }
+PAYLOAD_SIZES = { '4 KB', '64 KB', '1 MB', '16 MB', '64 MB', '256 MB' }
+UPLOADS_IN_FLIGHT = { 1, 4, 16 }
+-- Changing a setting restarts the statistics once the previous uploads have drained, so each run starts clean
+RUN_SECONDS = 5
+
+OpenSample('RHI/CopyQueue')
+ResizeViewport(1280, 720)
+
+-- The frame time without uploads, to compare against
+IdleSeconds(RUN_SECONDS)
+CaptureSampleStatistics(g_baseFolder .. 'idle.json')
+
+SetImguiValue('Run Benchmark', true)
+
+for _, uploadType in ipairs(UPLOAD_TYPES) do
+    SetImguiValue('Upload Type', uploadType)
+
+    for _, payloadSize in ipairs(PAYLOAD_SIZES) do
+        SetImguiValue('Payload Size', payloadSize)
+
+        for _, inFlight in ipairs(UPLOADS_IN_FLIGHT) do
+            SetImguiValue('Uploads In Flight', inFlight)
+            IdleSeconds(RUN_SECONDS)
+
+            local runName = uploadType .. '_' .. string.gsub(payloadSize, ' ', '') .. '_' .. tostring(inFlight)
+            Print('Capturing ' .. runName)
+            CaptureSampleStatistics(g_baseFolder .. runName .. '.json')
+        end
+    end
+end
+
+SetImguiValue('Run Benchmark', false)
+OpenSample(nil)
@@ -0,0 +1,41 @@
+----------------------------------------------------------------------------------------------------
+--
+-- Copyright (c) Contributors to the Open 3D Engine Project.
+-- For complete copyright and license terms please see the LICENSE at the root of this distribution.
+--
+-- SPDX-License-Identifier: Apache-2.0 OR MIT
+--
+--
+--
+----------------------------------------------------------------------------------------------------
+
+-- Measures how the CPU side of RHI/MultiThread scales with the number of draws. For each cube count the SRG compile
+-- runs once on a single thread and once split across the job system. The per-phase timings of each run are written to
+-- <g_baseFolder>/<cubes per line>_<serial|parallel>.json.
+
+g_baseFolder = ResolvePath('@user@/scripts/PerformanceBenchmarks/MultiThreadScaling/')
+CUBES_PER_LINE = { 40, 100, 200, 320 }
+STABLE_FRAME_TIME_TOLERANCE_PERCENT = 10
+STABLE_FRAME_TIME_WINDOW = 30
+STABLE_FRAME_TIME_TIMEOUT_SECONDS = 20
+-- The sample smooths its timings over recent frames, so let them converge before capturing
+SMOOTHING_FRAMES = 120
+
+OpenSample('RHI/MultiThread')
+ResizeViewport(1280, 720)
+
+for _, cubesPerLine in ipairs(CUBES_PER_LINE) do
+    SetImguiValue('Cubes Per Line', cubesPerLine)
+
+    for _, parallel in ipairs({ false, true }) do
+        SetImguiValue('Parallel SRG Compile', parallel)
+        IdleUntilFrameTimeStable(STABLE_FRAME_TIME_TOLERANCE_PERCENT, STABLE_FRAME_TIME_WINDOW, STABLE_FRAME_TIME_TIMEOUT_SECONDS)
+        IdleFrames(SMOOTHING_FRAMES)
+
+        local mode = parallel and 'parallel' or 'serial'
+        Print('Capturing ' .. tostring(cubesPerLine * cubesPerLine) .. ' draws, ' .. mode .. ' compile')
+        CaptureSampleStatistics(g_baseFolder .. tostring(cubesPerLine) .. '_' .. mode .. '.json')
+    end
+end
+
+OpenSample(nil)
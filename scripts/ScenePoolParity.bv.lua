@@ -0,0 +1,101 @@
+----------------------------------------------------------------------------------------------------
+--
+-- Copyright (c) Contributors to the Open 3D Engine Project.
+-- For complete copyright and license terms please see the LICENSE at the root of this distribution.
+--
+-- SPDX-License-Identifier: Apache-2.0 OR MIT
+--
+--
+--
+----------------------------------------------------------------------------------------------------
+
+-- Checks that samples render the same in a scene reused from the scene pool as in a newly built one, whatever sample
+-- used the scene before. Every capture is compared against the baselines of the sample's own script, and each path
+-- saves its screenshots to its own folder so they don't overwrite each other.
+
+RunScript("scripts/TestEnvironment.luac")
+
+g_scenePoolOutputFolder = g_screenshotOutputFolder .. 'ScenePoolParity/'
+Print('Saving screenshots to ' .. NormalizePath(g_scenePoolOutputFolder))
+
+-- Same setup and capture as Decals.bv.lua
+function CaptureDecals()
+    OpenSample('RPI/Decals')
+    ResizeViewport(1600, 900)
+    SelectImageComparisonToleranceLevel("Level G")
+    ArcBallCameraController_SetDistance(4.0)
+    -- Wait until decals are loaded in
+    IdleFrames(5)
+    SetImguiValue('Clone decals', true)
+    CaptureScreenshot('Decals/screenshot_decals.png')
+    OpenSample(nil)
+end
+
+-- Same setup and capture as SkinnedMesh.bv.lua
+function CaptureSkinnedMesh()
+    OpenSample('Features/SkinnedMesh')
+    ResizeViewport(1600, 900)
+    SelectImageComparisonToleranceLevel("Level B")
+    SetImguiValue('Sub-mesh count', 3)
+    SetImguiValue('Bones Per-Mesh', 78)
+    SetImguiValue('Vertices Per-Segment', 693)
+    SetImguiValue('Segments Per-Mesh', 65.000000)
+    SetImguiValue('Use Fixed Animation Time', true)
+    SetImguiValue('Fixed Animation Time', 4.751000)
+    SetImguiValue('Draw bones', false)
+    NoClipCameraController_SetPosition(Vector3(-0.125466, -2.129441, 1.728536))
+    NoClipCameraController_SetHeading(DegToRad(-8.116900))
+    NoClipCameraController_SetPitch(DegToRad(-31.035244))
+    CaptureScreenshot('SkinnedMesh/screenshot_skinnedmesh.png')
+    OpenSample(nil)
+end
+
+-- Same setup and capture as ExposureTest.bv.lua
+function CaptureExposure()
+    OpenSample('Features/Exposure')
+    ResizeViewport(800, 600)
+    SelectImageComparisonToleranceLevel("Level E")
+    -- eye adaptation has a default speed. we are waiting 9 seconds for the sample to reach stable state
+    IdleSeconds(9)
+    CaptureScreenshot('ExposureTest/screenshot_exposure.png')
+    OpenSample(nil)
+end
+
+-- Opens a sample and releases its scene back to the pool, without capturing anything
+function UseScene(sampleName)
+    OpenSample(sampleName)
+    IdleFrames(5)
+    OpenSample(nil)
+end
+
+-- Cold path: every sample gets a newly built scene
+SetScenePoolingEnabled(false)
+SetScreenshotFolder(g_scenePoolOutputFolder .. 'Cold/')
+CaptureDecals()
+CaptureSkinnedMesh()
+CaptureExposure()
+
+-- Pooled paths: the scene was last used by another sample, which leaves meshes, lights, decals and post-process settings
+-- of its own behind if the feature processors aren't reset
+SetScenePoolingEnabled(true)
+
+SetScreenshotFolder(g_scenePoolOutputFolder .. 'AfterDynamicDraw/')
+UseScene('RPI/DynamicDraw')
+CaptureDecals()
+
+SetScreenshotFolder(g_scenePoolOutputFolder .. 'AfterExposure/')
+UseScene('Features/Exposure')
+CaptureDecals()
+
+SetScreenshotFolder(g_scenePoolOutputFolder .. 'AfterDecals/')
+CaptureSkinnedMesh()
+
+SetScreenshotFolder(g_scenePoolOutputFolder .. 'AfterSkinnedMesh/')
+CaptureExposure()
+
+SetScreenshotFolder(g_scenePoolOutputFolder .. 'AfterSelf/')
+UseScene('RPI/Decals')
+CaptureDecals()
+
+SetScenePoolingEnabled(false)
+SetScreenshotFolder(g_screenshotOutputFolder)
@@ -9,8 +9,14 @@
 --
 ----------------------------------------------------------------------------------------------------
 g_baseFolder = ResolvePath('@user@/scripts/PerformanceBenchmarks/')
-IDLE_COUNT = 100
 FRAME_COUNT = 100
+-- Rather than idling for a fixed number of frames, wait for the sample to finish loading and for frame times to settle.
+-- The timeouts only matter on a machine that never settles; they report an error and capture anyway.
+LOAD_TIMEOUT_SECONDS = 60
+STREAMING_TIMEOUT_SECONDS = 30
+STABLE_FRAME_TIME_TOLERANCE_PERCENT = 10
+STABLE_FRAME_TIME_WINDOW = 30
+STABLE_FRAME_TIME_TIMEOUT_SECONDS = 20
 SAMPLES_TO_RUN = {
     {prefix = 'RPI', name = 'CullingAndLod', width = 1400, height = 800},
     {prefix = 'RPI', name = 'SponzaBenchmark', width = 1400, height = 800},
@@ -27,15 +33,15 @@ for index, sample in ipairs(SAMPLES_TO_RUN) do
 
     output_path = g_baseFolder .. sample['name']
     CaptureBenchmarkMetadata(sample['name'], output_path .. '/benchmark_metadata.json')
-    Print('Idling for ' .. tostring(IDLE_COUNT) .. ' frames..')
-    IdleFrames(IDLE_COUNT)
+    Print('Waiting for assets to load and frame times to stabilize...')
+    IdleUntilSampleAssetsLoaded(LOAD_TIMEOUT_SECONDS)
+    IdleUntilAssetLoadsFinish(LOAD_TIMEOUT_SECONDS)
+    IdleUntilImageStreamingSettles(STREAMING_TIMEOUT_SECONDS)
+    IdleUntilFrameTimeStable(STABLE_FRAME_TIME_TOLERANCE_PERCENT, STABLE_FRAME_TIME_WINDOW, STABLE_FRAME_TIME_TIMEOUT_SECONDS)
     Print('Capturing timestamps for ' .. tostring(FRAME_COUNT) .. ' frames...')
-    for i = 1,FRAME_COUNT do
-        frame_timestamps = output_path .. '/frame' .. tostring(i) .. '_timestamps.json'
-        cpu_timings = output_path .. '/cpu_frame' .. tostring(i) .. '_time.json'
-        CapturePassTimestamp(frame_timestamps)
-        CaptureCpuFrameTime(cpu_timings)
-    end
+    -- All frames are kept in memory and written to one file at the end, so file writes don't disturb the measured frames.
+    -- Use Standalone/PythonTests/Automated/profiling_capture_reader.py to read it.
+    BeginProfilingCapture(output_path .. '/profiling_capture.asvprof', FRAME_COUNT)
 end
 
 Print('Capturing complete.')
@@ -16,16 +16,36 @@
 -- NOTE: If the random seed is zero, then the order is not shuffled at all.
 -- The seed can be provided either in imGui or via commandline switch --randomtestseed
 
+-- The suite can also be split across several processes with the commandline switch --shard=i/N. Each shard runs a subset of
+-- the tests, balanced by how long each test took in the last full run (TestResults/ScriptDurations.json). Every shard computes
+-- the same split, so together they run each test exactly once.
 
--- Fast check for a sample which doesn't have a dedicated test script
+-- With the commandline switch --onlychanged, only the tests whose dependencies changed since they last ran are run: the test
+-- script itself, the samples it opened and the assets those samples preload. Tests that never ran are always run.
+
+-- Rough run times used to balance shards when a test has no recorded duration yet
+DefaultScriptSeconds = 60
+DefaultFastCheckSeconds = 3
+
+
+-- Fast check for a sample which doesn't have a dedicated test script. It isn't a script of its own, so it records its
+-- duration with a test timer for the shards to be balanced with.
 function FastCheckSample(sampleName)
-    return function()
-        Print("========= Begin Fast-check " .. sampleName .. " =========")
-        OpenSample(sampleName)
-        IdleSeconds(2) 
-        OpenSample(nil)
-        Print("========= End Fast-check " .. sampleName .. " =========")
-    end
+    local testName = 'FastCheck:' .. sampleName
+    return {
+        name = testName,
+        sample = sampleName,
+        defaultSeconds = DefaultFastCheckSeconds,
+        run = function()
+            Print("========= Begin Fast-check " .. sampleName .. " =========")
+            BeginTestTimer(testName)
+            OpenSample(sampleName)
+            IdleSeconds(2) 
+            OpenSample(nil)
+            EndTestTimer(testName)
+            Print("========= End Fast-check " .. sampleName .. " =========")
+        end
+    }
 end
 
 -- Test helper functions
@@ -36,14 +56,89 @@ function random_shuffle(list)
     end
 end
 
+-- Picks the tests this process runs when the suite is split into shards. Tests are handed out longest first, each to the shard
+-- with the least total time so far, which keeps the shards close to the same length. Tests keep their suite order within a shard.
+function select_shard(list, shardIndex, shardCount)
+    local weighted = {}
+    for i, test in ipairs(list) do
+        local seconds = GetRecordedScriptDuration(test.name)
+        if (seconds <= 0) then
+            seconds = test.defaultSeconds
+        end
+        table.insert(weighted, { index = i, name = test.name, seconds = seconds })
+    end
+
+    -- Ties are broken by name so every shard sorts the same way
+    table.sort(weighted, function(a, b)
+        if (a.seconds ~= b.seconds) then
+            return a.seconds > b.seconds
+        end
+        return a.name < b.name
+    end)
+
+    local shardSeconds = {}
+    for shard = 0, shardCount - 1 do
+        shardSeconds[shard] = 0
+    end
+
+    local selected = {}
+    for _, entry in ipairs(weighted) do
+        local lightestShard = 0
+        for shard = 1, shardCount - 1 do
+            if (shardSeconds[shard] < shardSeconds[lightestShard]) then
+                lightestShard = shard
+            end
+        end
+        shardSeconds[lightestShard] = shardSeconds[lightestShard] + entry.seconds
+        if (lightestShard == shardIndex) then
+            selected[entry.index] = true
+        end
+    end
+
+    local shardTests = {}
+    for i, test in ipairs(list) do
+        if (selected[i]) then
+            table.insert(shardTests, test)
+        end
+    end
+
+    Print("========= Shard " .. shardIndex .. " of " .. shardCount .. " runs " .. #shardTests .. " of " .. #list
+        .. " tests, estimated " .. shardSeconds[shardIndex] .. " seconds =========")
+    return shardTests
+end
+
+-- Drops the tests that aren't affected by any change since they last ran (see ScriptDependencyIndex)
+function select_affected(list)
+    local affectedTests = {}
+    for _, test in ipairs(list) do
+        local affected
+        if (test.sample ~= nil) then
+            affected = IsSampleAffected(test.sample)
+        else
+            affected = IsScriptAffected(test.name)
+        end
+        if (affected) then
+            table.insert(affectedTests, test)
+        end
+    end
+
+    Print("========= Running " .. #affectedTests .. " of " .. #list .. " tests affected by changes =========")
+    return affectedTests
+end
+
 -- A helper wrapper to create a lambda-like behavior in Lua, this allows us to create a table of functions that call various tests
 function RunScriptWrapper(name)
-    return function() RunScript(name) end
+    return {
+        name = name,
+        defaultSeconds = DefaultScriptSeconds,
+        run = function() RunScript(name) end
+    }
 end
 
--- A table of lambda-like functions that invoke various tests. This table is shuffled if a random seed is provided below.
+-- A table of tests, each with a lambda-like function that invokes it. This table is split into shards and shuffled below if requested.
 tests= {
     RunScriptWrapper('scripts/decals.bv.luac'),
+    RunScriptWrapper('scripts/scenepoolparity.bv.luac'),
     RunScriptWrapper('scripts/dynamicdraw.bv.luac'),
     RunScriptWrapper('scripts/dynamicmaterialtest.bv.luac'),
     RunScriptWrapper('scripts/EyeMaterialTest.bv.luac'),
@@ -120,6 +215,16 @@ if (GetRenderApiName() ~= "dx12") then
     table.insert(tests, FastCheckSample('RHI/Subpass'))
 end
 
+shardCount = GetTestShardCount()
+if (shardCount > 1) then
+    tests = select_shard(tests, GetTestShardIndex(), shardCount)
+end
+
+-- Filtering after sharding keeps the split the same in every shard, even if one shard updates the index before another reads it
+if (ShouldRunOnlyAffectedTests()) then
+    tests = select_affected(tests)
+end
+
 seed = GetRandomTestSeed()
 if (seed == 0) then
     Print("========= A random seed was not provided, running the tests in the original order =========")
@@ -129,6 +234,6 @@ else
     random_shuffle(tests)
 end
 
-for k,test in pairs(tests) do
-    test()
+for k,test in ipairs(tests) do
+    test.run()
 end